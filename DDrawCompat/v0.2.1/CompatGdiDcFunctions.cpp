@@ -76,15 +76,15 @@ namespace Compat21
 #ifdef _DEBUG
 				if (!hasDisplayDcArg(params...))
 				{
-					Compat::LogDebug() << "Skipping redirection since there is no display DC argument";
+					LOG_DBG << "Skipping redirection since there is no display DC argument";
 				}
 				else if (!CompatGdi::isEmulationEnabled())
 				{
-					Compat::LogDebug() << "Skipping redirection since GDI emulation is disabled";
+					LOG_DBG << "Skipping redirection since GDI emulation is disabled";
 				}
 				else
 				{
-					Compat::LogDebug() << "Skipping redirection since the primary surface could not be locked";
+					LOG_DBG << "Skipping redirection since the primary surface could not be locked";
 				}
 				Compat::LogLeave(g_funcNames[origFunc], params...) << result;
 #endif
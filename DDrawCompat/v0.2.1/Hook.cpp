@@ -102,7 +102,7 @@ namespace Compat21
 			FARPROC procAddr = getProcAddress(GetModuleHandle(moduleName), funcName);
 			if (!procAddr)
 			{
-				Compat::LogDebug() << "Failed to load the address of a function: " << funcName;
+				LOG_DBG << "Failed to load the address of a function: " << funcName;
 				return;
 			}
 
@@ -7,9 +7,11 @@
 #include <string>
 
 #include <Windows.h>
-#include <Shlwapi.h>
-#include <initguid.h>
-#include <DbgEng.h>
+extern "C"
+{
+#include "Disasm\disasm.h"
+}
+#include "Utils\Disassembler.h"
 
 #include <DDrawCompat/v0.3.1/Common/Hook.h>
 #include <DDrawCompat/DDrawLog.h>
@@ -18,15 +20,8 @@
 
 namespace
 {
-	IDebugClient4* g_debugClient = nullptr;
-	IDebugControl* g_debugControl = nullptr;
-	IDebugSymbols* g_debugSymbols = nullptr;
-	IDebugDataSpaces4* g_debugDataSpaces = nullptr;
-	ULONG64 g_debugBase = 0;
-	bool g_isDbgEngInitialized = false;
-
 	PIMAGE_NT_HEADERS getImageNtHeaders(HMODULE module);
-	bool initDbgEng();
+	bool initDisasm();
 
 	FARPROC* findProcAddressInIat(HMODULE module, const char* procName)
 	{
@@ -90,23 +85,17 @@ namespace
 	unsigned getInstructionSize(void* instruction)
 	{
 		const unsigned MAX_INSTRUCTION_SIZE = 15;
-		HRESULT result = g_debugDataSpaces->WriteVirtual(g_debugBase, instruction, MAX_INSTRUCTION_SIZE, nullptr);
-		if (FAILED(result))
-		{
-			LOG_ONCE("ERROR: DbgEng: WriteVirtual failed: " << Compat31::hex(result));
-			return 0;
-		}
-
-		ULONG64 endOffset = 0;
-		result = g_debugControl->Disassemble(g_debugBase, 0, nullptr, 0, nullptr, &endOffset);
-		if (FAILED(result))
+		t_disasm da = {};
+		ulong size = Disasm(static_cast<uchar*>(instruction), MAX_INSTRUCTION_SIZE,
+			reinterpret_cast<ulong>(instruction), &da, 0, nullptr, nullptr);
+		if (0 == size || 0 != (da.errors & (DAE_BADCMD | DAE_CROSS | DAE_INTERN)))
 		{
-			LOG_ONCE("ERROR: DbgEng: Disassemble failed: " << Compat31::hex(result) << " "
+			LOG_ONCE("ERROR: Disasm: failed to decode instruction: " << Compat31::hex(da.errors) << " "
 				<< Compat31::hexDump(instruction, MAX_INSTRUCTION_SIZE));
 			return 0;
 		}
 
-		return static_cast<unsigned>(endOffset - g_debugBase);
+		return size;
 	}
 
 	void hookFunction(void*& origFuncPtr, void* newFuncPtr, const char* funcName)
@@ -166,7 +155,7 @@ namespace
 			return;
 		}
 
-		if (!initDbgEng())
+		if (!initDisasm())
 		{
 			return;
 		}
@@ -208,135 +197,24 @@ namespace
 		origFuncPtr = trampoline;
 	}
 
-	bool initDbgEng()
+	bool initDisasm()
 	{
-		if (g_isDbgEngInitialized)
-		{
-			return 0 != g_debugBase;
-		}
-		g_isDbgEngInitialized = true;
-
-		//********** Begin Edit *************
-		typedef HRESULT(STDAPICALLTYPE* PFN_DebugCreate)(_In_ REFIID InterfaceId, _Out_ PVOID* Interface);
-		static PFN_DebugCreate pDebugCreate = nullptr;
-		static bool RunOnce = true;
-		if (RunOnce)
+		// Hooks can be installed at any time, so the reference is kept until the process exits
+		static const bool isDisasmInitialized = []()
 		{
-			// Get System32 path
-			char syspath[MAX_PATH];
-			GetSystemDirectory(syspath, MAX_PATH);
-
-			// Load dbghelp.dll from System32
-			char path[MAX_PATH];
-			strcpy_s(path, MAX_PATH, syspath);
-			PathAppend(path, "dbghelp.dll");
-			HMODULE dll = LoadLibrary(path);
-
-			// Try loading dbgeng.dll from System32
-			strcpy_s(path, MAX_PATH, syspath);
-			PathAppend(path, "dbgeng.dll");
-			dll = LoadLibrary(path);
-			if (dll)
-			{
-				pDebugCreate = (PFN_DebugCreate)GetProcAddress(dll, "DebugCreate");
-			}
-
-			// Try loading dbgeng.dll from local path
-			if (!pDebugCreate)
+			if (!Utils::AcquireDisassembler())
 			{
-				dll = LoadLibrary("dbgeng.dll");
-				if (dll)
-				{
-					pDebugCreate = (PFN_DebugCreate)GetProcAddress(dll, "DebugCreate");
-				}
+				Compat31::Log() << "ERROR: Disasm: failed to prepare the command tables";
+				return false;
 			}
-		}
-		RunOnce = false;
-		if (!pDebugCreate)
-		{
-			Compat31::Log() << "ERROR: DbgEng: failed to get proc address!";
-			return false;
-		}
-		//********** End Edit ***************
-
-		HRESULT result = S_OK;
-		if (FAILED(result = pDebugCreate(IID_IDebugClient4, reinterpret_cast<void**>(&g_debugClient))) ||
-			FAILED(result = g_debugClient->QueryInterface(IID_IDebugControl, reinterpret_cast<void**>(&g_debugControl))) ||
-			FAILED(result = g_debugClient->QueryInterface(IID_IDebugSymbols, reinterpret_cast<void**>(&g_debugSymbols))) ||
-			FAILED(result = g_debugClient->QueryInterface(IID_IDebugDataSpaces4, reinterpret_cast<void**>(&g_debugDataSpaces))))
-		{
-			Compat31::Log() << "ERROR: DbgEng: object creation failed: " << Compat31::hex(result);
-			return false;
-		}
-
-		result = g_debugClient->OpenDumpFileWide(Compat31::getModulePath(Dll::g_currentModule).c_str(), 0);
-		if (FAILED(result))
-		{
-			Compat31::Log() << "ERROR: DbgEng: OpenDumpFile failed: " << Compat31::hex(result);
-			return false;
-		}
-
-		g_debugControl->SetEngineOptions(DEBUG_ENGOPT_DISABLE_MODULE_SYMBOL_LOAD);
-		result = g_debugControl->WaitForEvent(0, INFINITE);
-		if (FAILED(result))
-		{
-			Compat31::Log() << "ERROR: DbgEng: WaitForEvent failed: " << Compat31::hex(result);
-			return false;
-		}
-
-		DEBUG_MODULE_PARAMETERS dmp = {};
-		result = g_debugSymbols->GetModuleParameters(1, 0, 0, &dmp);
-		if (FAILED(result))
-		{
-			Compat31::Log() << "ERROR: DbgEng: GetModuleParameters failed: " << Compat31::hex(result);
-			return false;
-		}
-
-		ULONG size = 0;
-		result = g_debugDataSpaces->GetValidRegionVirtual(dmp.Base, dmp.Size, &g_debugBase, &size);
-		if (FAILED(result) || 0 == g_debugBase)
-		{
-			Compat31::Log() << "ERROR: DbgEng: GetValidRegionVirtual failed: " << Compat31::hex(result);
-			return false;
-		}
-
-		return true;
+			return true;
+		}();
+		return isDisasmInitialized;
 	}
 }
 
 namespace Compat31
 {
-	void closeDbgEng()
-	{
-		if (g_debugClient)
-		{
-			g_debugClient->EndSession(DEBUG_END_PASSIVE);
-		}
-		if (g_debugDataSpaces)
-		{
-			g_debugDataSpaces->Release();
-			g_debugDataSpaces = nullptr;
-		}
-		if (g_debugSymbols)
-		{
-			g_debugSymbols->Release();
-			g_debugSymbols = nullptr;
-		}
-		if (g_debugControl)
-		{
-			g_debugControl->Release();
-			g_debugControl = nullptr;
-		}
-		if (g_debugClient)
-		{
-			g_debugClient->Release();
-			g_debugClient = nullptr;
-		}
-
-		g_debugBase = 0;
-		g_isDbgEngInitialized = false;
-	}
-
 	std::string funcPtrToStr(void* funcPtr)
 	{
 		std::ostringstream oss;
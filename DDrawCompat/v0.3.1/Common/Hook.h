@@ -13,7 +13,6 @@
 
 namespace Compat31
 {
-	void closeDbgEng();
 	std::string funcPtrToStr(void* funcPtr);
 	HMODULE getModuleHandleFromAddress(void* address);
 
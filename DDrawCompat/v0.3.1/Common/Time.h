@@ -18,6 +18,11 @@ namespace Time
 		return qpc * 1000 / g_qpcFrequency;
 	}
 
+	inline long long qpcToUs(long long qpc)
+	{
+		return qpc * 1000000 / g_qpcFrequency;
+	}
+
 	inline long long queryPerformanceCounter()
 	{
 		LARGE_INTEGER qpc = {};
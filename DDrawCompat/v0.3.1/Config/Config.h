@@ -3,6 +3,10 @@
 namespace Config30
 {
 	const unsigned delayedFlipModeTimeout = 200;
+	const unsigned dynamicBufferMaxSize = 64 * 1024 * 1024;
+	const unsigned dynamicBufferMinSize = 64 * 1024;
+	const unsigned dynamicBufferShrinkDelay = 300;
+	const unsigned dynamicBufferStallTime = 1;
 	const unsigned evictionTimeout = 200;
 	const unsigned maxPaletteUpdatesPerMs = 5;
 	const unsigned maxUserModeDisplayDrivers = 3;
@@ -34,6 +34,7 @@ namespace D3dDdi
 		, m_runtimeVersion(data.Version)
 		, m_driverVersion(data.DriverVersion)
 		, m_d3dExtendedCaps{}
+		, m_d3d9IndexCaps{ 0xFFFF, 0xFFFF }
 	{
 		if (m_adapter)
 		{
@@ -47,6 +48,8 @@ namespace D3dDdi
 			getCaps.pData = &m_ddrawCaps;
 			getCaps.DataSize = sizeof(m_ddrawCaps);
 			m_origVtable.pfnGetCaps(m_adapter, &getCaps);
+
+			m_d3d9IndexCaps = D3dDdi::getD3d9IndexCaps(m_origVtable, m_adapter);
 		}
 	}
 
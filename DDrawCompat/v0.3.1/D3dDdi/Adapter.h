@@ -6,6 +6,8 @@
 #include <d3dnthal.h>
 #include <d3dumddi.h>
 
+#include <DDrawCompat/v0.3.1/D3dDdi/D3d9Caps.h>
+
 namespace D3dDdi
 {
 	class Adapter
@@ -21,6 +23,7 @@ namespace D3dDdi
 
 		const D3DNTHAL_D3DEXTENDEDCAPS& getD3dExtendedCaps() const { return m_d3dExtendedCaps; }
 		const DDRAW_CAPS& getDDrawCaps() const { return m_ddrawCaps; }
+		const D3d9IndexCaps& getD3d9IndexCaps() const { return m_d3d9IndexCaps; }
 		const D3DDDI_ADAPTERFUNCS& getOrigVtable() const { return m_origVtable; }
 
 		HRESULT pfnCloseAdapter();
@@ -40,6 +43,7 @@ namespace D3dDdi
 
 		D3DNTHAL_D3DEXTENDEDCAPS m_d3dExtendedCaps;
 		DDRAW_CAPS m_ddrawCaps;
+		D3d9IndexCaps m_d3d9IndexCaps;
 
 		static std::map<HANDLE, Adapter> s_adapters;
 	};
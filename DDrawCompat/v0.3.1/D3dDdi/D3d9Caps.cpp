@@ -0,0 +1,24 @@
+#define WIN32_LEAN_AND_MEAN
+#define CINTERFACE
+
+#include <d3d9.h>
+
+#include <DDrawCompat/v0.3.1/D3dDdi/D3d9Caps.h>
+
+namespace D3dDdi
+{
+	D3d9IndexCaps getD3d9IndexCaps(const D3DDDI_ADAPTERFUNCS& adapterFuncs, HANDLE adapter)
+	{
+		D3DCAPS9 caps = {};
+		D3DDDIARG_GETCAPS getCaps = {};
+		getCaps.Type = D3DDDICAPS_GETD3D9CAPS;
+		getCaps.pData = &caps;
+		getCaps.DataSize = sizeof(caps);
+
+		if (FAILED(adapterFuncs.pfnGetCaps(adapter, &getCaps)) || 0 == caps.MaxPrimitiveCount)
+		{
+			return { 0xFFFF, 0xFFFF };
+		}
+		return { caps.MaxPrimitiveCount, caps.MaxVertexIndex };
+	}
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+// Include after either d3d.h or d3d9.h, the two type headers cannot be mixed in one translation unit
+#include <d3dumddi.h>
+
+namespace D3dDdi
+{
+	struct D3d9IndexCaps
+	{
+		UINT maxPrimitiveCount;
+		UINT maxVertexIndex;
+	};
+
+	D3d9IndexCaps getD3d9IndexCaps(const D3DDDI_ADAPTERFUNCS& adapterFuncs, HANDLE adapter);
+}
@@ -13,6 +13,7 @@
 #include <DDrawCompat/v0.3.1/D3dDdi/Adapter.h>
 #include <DDrawCompat/v0.3.1/D3dDdi/Device.h>
 #include <DDrawCompat/v0.3.1/D3dDdi/DeviceFuncs.h>
+#include <DDrawCompat/v0.3.1/D3dDdi/KernelModeThunks.h>
 #include <DDrawCompat/v0.3.1/D3dDdi/Resource.h>
 #include <DDrawCompat/v0.3.1/D3dDdi/ScopedCriticalSection.h>
 
@@ -203,6 +204,12 @@ namespace D3dDdi
 		return nullptr;
 	}
 
+	Resource* Device::findResource(HANDLE device, HANDLE resource)
+	{
+		auto it = s_devices.find(device);
+		return it != s_devices.end() ? it->second.getResource(resource) : nullptr;
+	}
+
 	Resource* Device::getGdiResource()
 	{
 		return g_gdiResource;
@@ -302,6 +309,8 @@ namespace D3dDdi
 		auto device = m_device;
 		auto pfnDestroyDevice = m_origVtable.pfnDestroyDevice;
 		s_devices.erase(device);
+		Resource::logResidency();
+		KernelModeThunks::logVsyncStats();
 		return pfnDestroyDevice(device);
 	}
 
@@ -401,6 +410,7 @@ namespace D3dDdi
 	HRESULT Device::pfnPresent(const D3DDDIARG_PRESENT* data)
 	{
 		flushPrimitives();
+		m_drawPrimitive.endFrame();
 		prepareForRendering(data->hSrcResource, data->SrcSubResourceIndex, true);
 		return m_origVtable.pfnPresent(m_device, data);
 	}
@@ -408,6 +418,7 @@ namespace D3dDdi
 	HRESULT Device::pfnPresent1(D3DDDIARG_PRESENT1* data)
 	{
 		flushPrimitives();
+		m_drawPrimitive.endFrame();
 		for (UINT i = 0; i < data->SrcResources; ++i)
 		{
 			prepareForRendering(data->phSrcResources[i].hResource, data->phSrcResources[i].SubResourceIndex, true);
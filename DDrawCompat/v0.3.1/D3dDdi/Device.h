@@ -66,6 +66,7 @@ namespace D3dDdi
 
 		static void enableFlush(bool enable) { s_isFlushEnabled = enable; }
 		static Resource* findResource(HANDLE resource);
+		static Resource* findResource(HANDLE device, HANDLE resource);
 		static Resource* getGdiResource();
 		static void setGdiResourceHandle(HANDLE resource);
 
@@ -2,17 +2,29 @@
 #define CINTERFACE
 
 #include <algorithm>
+#include <sstream>
 
 #include <DDrawCompat/DDrawLog.h>
+#include <DDrawCompat/v0.3.1/D3dDdi/Adapter.h>
 #include <DDrawCompat/v0.3.1/D3dDdi/DrawPrimitive.h>
 #include <DDrawCompat/v0.3.1/D3dDdi/Device.h>
 #include <DDrawCompat/v0.3.1/D3dDdi/Resource.h>
 
 namespace
 {
-	const UINT INDEX_BUFFER_SIZE = D3DMAXNUMPRIMITIVES * 3 * sizeof(UINT16);
+	const UINT INDEX_BUFFER_SIZE = 256 * 1024;
+	const UINT MAX_32BIT_BATCHED_PRIMITIVE_COUNT = D3DMAXNUMPRIMITIVES * 4;
 	const UINT VERTEX_BUFFER_SIZE = 1024 * 1024;
 
+	UINT getMaxBatchedPrimitiveCount(const D3dDdi::D3d9IndexCaps& caps)
+	{
+		if (caps.maxVertexIndex <= 0xFFFF)
+		{
+			return D3DMAXNUMPRIMITIVES;
+		}
+		return std::min<UINT>(std::max<UINT>(caps.maxPrimitiveCount, D3DMAXNUMPRIMITIVES), MAX_32BIT_BATCHED_PRIMITIVE_COUNT);
+	}
+
 	UINT getVertexCount(D3DPRIMITIVETYPE primitiveType, UINT primitiveCount)
 	{
 		switch (primitiveType)
@@ -54,24 +66,35 @@ namespace D3dDdi
 	DrawPrimitive::DrawPrimitive(Device& device)
 		: m_device(device)
 		, m_origVtable(device.getOrigVtable())
+		, m_is32BitIndexBatchingUsed(device.getAdapter().getD3d9IndexCaps().maxVertexIndex > 0xFFFF)
+		, m_maxBatchedPrimitiveCount(getMaxBatchedPrimitiveCount(device.getAdapter().getD3d9IndexCaps()))
+		, m_maxBatchedIndex(m_is32BitIndexBatchingUsed ? device.getAdapter().getD3d9IndexCaps().maxVertexIndex : 0xFFFF)
 		, m_vertexBuffer(device, VERTEX_BUFFER_SIZE)
-		, m_indexBuffer(device, m_vertexBuffer ? INDEX_BUFFER_SIZE : 0)
+		, m_indexBuffer(device, m_vertexBuffer ? INDEX_BUFFER_SIZE : 0,
+			m_is32BitIndexBatchingUsed ? D3DDDIFMT_INDEX32 : D3DDDIFMT_INDEX16)
 		, m_streamSource{}
 		, m_batched{}
 		, m_isHwVertexProcessingUsed(false)
+		, m_batchSizeHistogram{}
 	{
 		LOG_ONCE("Dynamic vertex buffers are " << (m_vertexBuffer ? "" : "not ") << "available");
 		LOG_ONCE("Dynamic index buffers are " << (m_indexBuffer ? "" : "not ") << "available");
+		LOG_ONCE("Batching with " << (m_is32BitIndexBatchingUsed ? 32 : 16) << "-bit indices, up to "
+			<< m_maxBatchedPrimitiveCount << " primitives per draw call");
 
 		if (m_indexBuffer)
 		{
-			D3DDDIARG_SETINDICES si = {};
-			si.hIndexBuffer = m_indexBuffer;
-			si.Stride = 2;
-			m_origVtable.pfnSetIndices(m_device, &si);
+			bindIndexBuffer();
 		}
 	}
 
+	DrawPrimitive::~DrawPrimitive()
+	{
+		logBatchSizeHistogram();
+		logDynamicBufferStats("vertex", m_vertexBuffer);
+		logDynamicBufferStats("index", m_indexBuffer);
+	}
+
 	void DrawPrimitive::addSysMemVertexBuffer(HANDLE resource, BYTE* vertices)
 	{
 		m_sysMemVertexBuffers[resource] = vertices;
@@ -93,13 +116,13 @@ namespace D3dDdi
 			INT delta = getBatchedVertexCount() - minIndex;
 			for (UINT i = 0; i < count; ++i)
 			{
-				m_batched.indices.push_back(static_cast<UINT16>(indices[i] + delta));
+				m_batched.indices.push_back(indices[i] + delta);
 			}
 			appendVertices(baseVertexIndex + minIndex, vertexCount);
 			return;
 		}
 
-		static UINT16 indexMap[D3DMAXNUMVERTICES] = {};
+		static UINT indexMap[D3DMAXNUMVERTICES] = {};
 		static BYTE indexCycles[D3DMAXNUMVERTICES] = {};
 		static BYTE currentCycle = 0;
 		static UINT maxVertexCount = 0;
@@ -116,7 +139,7 @@ namespace D3dDdi
 			updateMax(maxVertexCount, vertexCount);
 		}
 
-		UINT16 newIndex = static_cast<UINT16>(getBatchedVertexCount());
+		UINT newIndex = getBatchedVertexCount();
 		for (UINT i = 0; i < count; ++i)
 		{
 			const UINT16 zeroBasedIndex = static_cast<UINT16>(indices[i] - minIndex);
@@ -145,7 +168,7 @@ namespace D3dDdi
 	{
 		for (UINT i = base; i < base + count; ++i)
 		{
-			m_batched.indices.push_back(static_cast<UINT16>(i));
+			m_batched.indices.push_back(i);
 		}
 		updateMin(m_batched.minIndex, base);
 		updateMax(m_batched.maxIndex, base + count - 1);
@@ -157,7 +180,7 @@ namespace D3dDdi
 		rebaseIndices();
 		for (UINT i = 0; i < count; ++i)
 		{
-			m_batched.indices.push_back(static_cast<UINT16>(baseVertexIndex + indices[i]));
+			m_batched.indices.push_back(baseVertexIndex + indices[i]);
 		}
 		updateMin(m_batched.minIndex, baseVertexIndex + minIndex);
 		updateMax(m_batched.maxIndex, baseVertexIndex + maxIndex);
@@ -191,6 +214,15 @@ namespace D3dDdi
 		}
 	}
 
+	void DrawPrimitive::appendLineStrip(INT baseVertexIndex, UINT primitiveCount,
+		const UINT16* indices, UINT minIndex, UINT maxIndex)
+	{
+		convertToLineList();
+		rebaseIndices();
+		appendIndicesAndVertices(indices, primitiveCount + 1, baseVertexIndex, minIndex, maxIndex);
+		convertIndexedLineStripToList(m_batched.primitiveCount, primitiveCount);
+	}
+
 	void DrawPrimitive::appendLineOrTriangleList(INT baseVertexIndex, UINT primitiveCount, UINT vpp,
 		const UINT16* indices, UINT minIndex, UINT maxIndex)
 	{
@@ -206,7 +238,9 @@ namespace D3dDdi
 	bool DrawPrimitive::appendPrimitives(D3DPRIMITIVETYPE primitiveType, INT baseVertexIndex, UINT primitiveCount,
 		const UINT16* indices, UINT minIndex, UINT maxIndex)
 	{
-		if (m_batched.primitiveCount + primitiveCount > D3DMAXNUMPRIMITIVES)
+		if (m_batched.primitiveCount + primitiveCount > m_maxBatchedPrimitiveCount ||
+			!isIndexRangeSupported(baseVertexIndex, getVertexCount(primitiveType, primitiveCount),
+				indices, minIndex, maxIndex))
 		{
 			return false;
 		}
@@ -227,13 +261,19 @@ namespace D3dDdi
 			break;
 
 		case D3DPT_LINESTRIP:
-			return false;
+			if (D3DPT_LINELIST != m_batched.primitiveType && D3DPT_LINESTRIP != m_batched.primitiveType)
+			{
+				return false;
+			}
+			appendLineStrip(baseVertexIndex, primitiveCount, indices, minIndex, maxIndex);
+			break;
 
 		case D3DPT_LINELIST:
-			if (D3DPT_LINELIST != m_batched.primitiveType)
+			if (D3DPT_LINELIST != m_batched.primitiveType && D3DPT_LINESTRIP != m_batched.primitiveType)
 			{
 				return false;
 			}
+			convertToLineList();
 			appendLineOrTriangleList(baseVertexIndex, primitiveCount, 2, indices, minIndex, maxIndex);
 			break;
 
@@ -307,15 +347,15 @@ namespace D3dDdi
 		{
 			if (m_streamSource.vertices)
 			{
-				m_batched.indices.push_back(static_cast<UINT16>(getBatchedVertexCount()));
+				m_batched.indices.push_back(getBatchedVertexCount());
 			}
 			else if (indices)
 			{
-				m_batched.indices.push_back(static_cast<UINT16>(baseVertexIndex + indices[0]));
+				m_batched.indices.push_back(baseVertexIndex + indices[0]);
 			}
 			else
 			{
-				m_batched.indices.push_back(static_cast<UINT16>(baseVertexIndex));
+				m_batched.indices.push_back(baseVertexIndex);
 			}
 		}
 		m_batched.primitiveCount += 3;
@@ -329,6 +369,22 @@ namespace D3dDdi
 		m_batched.vertices.insert(m_batched.vertices.end(), vertices, vertices + count * m_streamSource.stride);
 	}
 
+	void DrawPrimitive::bindIndexBuffer()
+	{
+		D3DDDIARG_SETINDICES si = {};
+		si.hIndexBuffer = m_indexBuffer;
+		si.Stride = m_is32BitIndexBatchingUsed ? 4 : 2;
+		m_origVtable.pfnSetIndices(m_device, &si);
+	}
+
+	void DrawPrimitive::bindVertexBuffer()
+	{
+		D3DDDIARG_SETSTREAMSOURCE ss = {};
+		ss.hVertexBuffer = m_vertexBuffer;
+		ss.Stride = m_streamSource.stride;
+		m_origVtable.pfnSetStreamSource(m_device, &ss);
+	}
+
 	void DrawPrimitive::clearBatchedPrimitives()
 	{
 		m_batched.primitiveCount = 0;
@@ -336,6 +392,23 @@ namespace D3dDdi
 		m_batched.indices.clear();
 	}
 
+	void DrawPrimitive::convertIndexedLineStripToList(UINT startPrimitive, UINT primitiveCount)
+	{
+		const UINT totalPrimitiveCount = startPrimitive + primitiveCount;
+		m_batched.indices.resize(totalPrimitiveCount * 2);
+
+		INT oldIndexPos = startPrimitive * 2 + primitiveCount - 1;
+		INT newIndexPos = (totalPrimitiveCount - 1) * 2;
+
+		while (newIndexPos > oldIndexPos)
+		{
+			m_batched.indices[newIndexPos + 1] = m_batched.indices[oldIndexPos + 1];
+			m_batched.indices[newIndexPos] = m_batched.indices[oldIndexPos];
+			newIndexPos -= 2;
+			oldIndexPos--;
+		}
+	}
+
 	void DrawPrimitive::convertIndexedTriangleFanToList(UINT startPrimitive, UINT primitiveCount)
 	{
 		const UINT totalPrimitiveCount = startPrimitive + primitiveCount;
@@ -344,7 +417,7 @@ namespace D3dDdi
 		INT startIndexPos = startPrimitive * 3;
 		INT oldIndexPos = startIndexPos + primitiveCount - 1;
 		INT newIndexPos = (totalPrimitiveCount - 1) * 3;
-		const UINT16 startIndex = m_batched.indices[startIndexPos];
+		const UINT startIndex = m_batched.indices[startIndexPos];
 
 		while (newIndexPos > startIndexPos)
 		{
@@ -390,6 +463,35 @@ namespace D3dDdi
 		}
 	}
 
+	void DrawPrimitive::convertToLineList()
+	{
+		if (D3DPT_LINESTRIP != m_batched.primitiveType)
+		{
+			return;
+		}
+
+		const bool alreadyIndexed = !m_batched.indices.empty();
+		if (alreadyIndexed)
+		{
+			rebaseIndices();
+			convertIndexedLineStripToList(0, m_batched.primitiveCount);
+		}
+		else
+		{
+			const UINT baseVertexIndex = static_cast<UINT>(m_batched.baseVertexIndex);
+			for (UINT i = baseVertexIndex; i < baseVertexIndex + m_batched.primitiveCount; ++i)
+			{
+				m_batched.indices.push_back(i);
+				m_batched.indices.push_back(i + 1);
+			}
+			m_batched.minIndex = m_batched.baseVertexIndex;
+			m_batched.maxIndex = m_batched.baseVertexIndex + m_batched.primitiveCount;
+			m_batched.baseVertexIndex = 0;
+		}
+
+		m_batched.primitiveType = D3DPT_LINELIST;
+	}
+
 	void DrawPrimitive::convertToTriangleList()
 	{
 		const bool alreadyIndexed = !m_batched.indices.empty();
@@ -411,18 +513,18 @@ namespace D3dDdi
 				UINT i = baseVertexIndex;
 				for (; i < baseVertexIndex + m_batched.primitiveCount - 1; i += 2)
 				{
-					m_batched.indices.push_back(static_cast<UINT16>(i));
-					m_batched.indices.push_back(static_cast<UINT16>(i + 1));
-					m_batched.indices.push_back(static_cast<UINT16>(i + 2));
-					m_batched.indices.push_back(static_cast<UINT16>(i + 1));
-					m_batched.indices.push_back(static_cast<UINT16>(i + 3));
-					m_batched.indices.push_back(static_cast<UINT16>(i + 2));
+					m_batched.indices.push_back(i);
+					m_batched.indices.push_back(i + 1);
+					m_batched.indices.push_back(i + 2);
+					m_batched.indices.push_back(i + 1);
+					m_batched.indices.push_back(i + 3);
+					m_batched.indices.push_back(i + 2);
 				}
 				if (i < baseVertexIndex + m_batched.primitiveCount)
 				{
-					m_batched.indices.push_back(static_cast<UINT16>(i));
-					m_batched.indices.push_back(static_cast<UINT16>(i + 1));
-					m_batched.indices.push_back(static_cast<UINT16>(i + 2));
+					m_batched.indices.push_back(i);
+					m_batched.indices.push_back(i + 1);
+					m_batched.indices.push_back(i + 2);
 				}
 			}
 			break;
@@ -437,9 +539,9 @@ namespace D3dDdi
 			{
 				for (UINT i = m_batched.baseVertexIndex; i < m_batched.baseVertexIndex + m_batched.primitiveCount; ++i)
 				{
-					m_batched.indices.push_back(static_cast<UINT16>(i + 1));
-					m_batched.indices.push_back(static_cast<UINT16>(i + 2));
-					m_batched.indices.push_back(static_cast<UINT16>(m_batched.baseVertexIndex));
+					m_batched.indices.push_back(i + 1);
+					m_batched.indices.push_back(i + 2);
+					m_batched.indices.push_back(m_batched.baseVertexIndex);
 				}
 			}
 			break;
@@ -521,6 +623,34 @@ namespace D3dDdi
 		return S_OK;
 	}
 
+	void DrawPrimitive::endFrame()
+	{
+		if (m_vertexBuffer.endFrame())
+		{
+			if (!m_vertexBuffer)
+			{
+				LOG_ONCE("WARN: Dynamic vertex buffer resize failed");
+				m_indexBuffer.resize(0);
+			}
+			else if (m_streamSource.vertices)
+			{
+				bindVertexBuffer();
+			}
+		}
+
+		if (m_indexBuffer.endFrame())
+		{
+			if (m_indexBuffer)
+			{
+				bindIndexBuffer();
+			}
+			else
+			{
+				LOG_ONCE("WARN: Dynamic index buffer resize failed");
+			}
+		}
+	}
+
 	HRESULT DrawPrimitive::flush(const UINT* flagBuffer)
 	{
 		D3DDDIARG_DRAWPRIMITIVE data = {};
@@ -560,10 +690,21 @@ namespace D3dDdi
 			data.BaseVertexOffset = baseVertexIndex * static_cast<INT>(m_streamSource.stride);
 		}
 
+		const void* indices = m_batched.indices.data();
+		UINT indexSize = sizeof(UINT);
+		if (!m_is32BitIndexBatchingUsed)
+		{
+			m_indices16.resize(m_batched.indices.size());
+			std::transform(m_batched.indices.begin(), m_batched.indices.end(), m_indices16.begin(),
+				[](UINT index) { return static_cast<UINT16>(index); });
+			indices = m_indices16.data();
+			indexSize = sizeof(UINT16);
+		}
+
 		INT startIndex = -1;
 		if ((!m_streamSource.vertices || m_vertexBuffer) && m_indexBuffer && !flagBuffer)
 		{
-			startIndex = loadIndices(m_batched.indices.data(), m_batched.indices.size());
+			startIndex = loadIndices(indices, m_batched.indices.size());
 		}
 
 		HRESULT result = S_OK;
@@ -580,7 +721,7 @@ namespace D3dDdi
 		}
 		else
 		{
-			result = m_origVtable.pfnDrawIndexedPrimitive2(m_device, &data, 2, m_batched.indices.data(), flagBuffer);
+			result = m_origVtable.pfnDrawIndexedPrimitive2(m_device, &data, indexSize, indices, flagBuffer);
 		}
 
 		clearBatchedPrimitives();
@@ -595,6 +736,14 @@ namespace D3dDdi
 		}
 
 		LOG_DEBUG << "Flushing " << m_batched.primitiveCount << " primitives of type " << m_batched.primitiveType;
+
+		UINT bucket = 0;
+		while ((m_batched.primitiveCount >> (bucket + 1)) && bucket + 1 < m_batchSizeHistogram.size())
+		{
+			++bucket;
+		}
+		++m_batchSizeHistogram[bucket];
+
 		return m_batched.indices.empty() ? flush(flagBuffer) : flushIndexed(flagBuffer);
 	}
 
@@ -603,8 +752,45 @@ namespace D3dDdi
 		return m_batched.vertices.size() / m_streamSource.stride;
 	}
 
+	bool DrawPrimitive::isIndexRangeSupported(INT baseVertexIndex, UINT vertexCount,
+		const UINT16* indices, UINT minIndex, UINT maxIndex) const
+	{
+		UINT lastIndex = 0;
+		if (m_streamSource.vertices)
+		{
+			// Reserve room for the vertices repeated when joining triangle strips
+			lastIndex = getBatchedVertexCount() + (indices ? maxIndex - minIndex + 1 : vertexCount) + 1;
+		}
+		else
+		{
+			lastIndex = baseVertexIndex + (indices ? maxIndex : vertexCount - 1);
+			if (m_batched.indices.empty())
+			{
+				updateMax(lastIndex, m_batched.baseVertexIndex +
+					getVertexCount(m_batched.primitiveType, m_batched.primitiveCount) - 1);
+			}
+			else
+			{
+				updateMax(lastIndex, m_batched.baseVertexIndex + m_batched.maxIndex);
+			}
+		}
+		return lastIndex <= m_maxBatchedIndex;
+	}
+
 	INT DrawPrimitive::loadIndices(const void* indices, UINT count)
 	{
+		UINT size = count * (m_is32BitIndexBatchingUsed ? 4 : 2);
+		if (size > m_indexBuffer.getSize())
+		{
+			m_indexBuffer.resize((size + INDEX_BUFFER_SIZE - 1) / INDEX_BUFFER_SIZE * INDEX_BUFFER_SIZE);
+			if (!m_indexBuffer)
+			{
+				LOG_ONCE("WARN: Dynamic index buffer resize failed");
+				return -1;
+			}
+			bindIndexBuffer();
+		}
+
 		INT startIndex = m_indexBuffer.load(indices, count);
 		if (startIndex >= 0)
 		{
@@ -641,10 +827,7 @@ namespace D3dDdi
 				m_vertexBuffer.resize((size + VERTEX_BUFFER_SIZE - 1) / VERTEX_BUFFER_SIZE * VERTEX_BUFFER_SIZE);
 				if (m_vertexBuffer)
 				{
-					D3DDDIARG_SETSTREAMSOURCE ss = {};
-					ss.hVertexBuffer = m_vertexBuffer;
-					ss.Stride = m_streamSource.stride;
-					m_origVtable.pfnSetStreamSource(m_device, &ss);
+					bindVertexBuffer();
 				}
 				else
 				{
@@ -672,6 +855,41 @@ namespace D3dDdi
 		return 0;
 	}
 
+	void DrawPrimitive::logBatchSizeHistogram() const
+	{
+		std::ostringstream oss;
+		for (UINT i = 0; i < m_batchSizeHistogram.size(); ++i)
+		{
+			if (0 != m_batchSizeHistogram[i])
+			{
+				oss << ' ' << (1 << i) << '-' << (2 << i) - 1 << ':' << m_batchSizeHistogram[i];
+			}
+		}
+
+		if (!oss.str().empty())
+		{
+			Compat::Log() << "Batched primitives per draw call:" << oss.str();
+		}
+	}
+
+	void DrawPrimitive::logDynamicBufferStats(const char* name, const DynamicBuffer& buffer) const
+	{
+		auto& stats = buffer.getStats();
+		if (0 == stats.frames)
+		{
+			return;
+		}
+
+		Compat::Log() << "Dynamic " << name << " buffer: size " << buffer.getSize()
+			<< ", frames " << stats.frames
+			<< ", average bytes/frame " << stats.totalBytes / stats.frames
+			<< ", peak bytes/frame " << stats.peakFrameBytes
+			<< ", discards " << stats.discards
+			<< ", wraps " << stats.wraps
+			<< ", stalls " << stats.stalls
+			<< ", resizes " << stats.resizes;
+	}
+
 	void DrawPrimitive::rebaseIndices()
 	{
 		if (0 != m_batched.baseVertexIndex || m_batched.indices.empty())
@@ -685,7 +903,7 @@ namespace D3dDdi
 			{
 				for (auto& index : m_batched.indices)
 				{
-					index = static_cast<UINT16>(m_batched.baseVertexIndex + index);
+					index = m_batched.baseVertexIndex + index;
 				}
 				m_batched.minIndex += m_batched.baseVertexIndex;
 				m_batched.maxIndex += m_batched.baseVertexIndex;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <map>
 #include <vector>
 
@@ -16,10 +17,12 @@ namespace D3dDdi
 	{
 	public:
 		DrawPrimitive(Device& device);
+		~DrawPrimitive();
 
 		void addSysMemVertexBuffer(HANDLE resource, BYTE* vertices);
 		void removeSysMemVertexBuffer(HANDLE resource);
 
+		void endFrame();
 		HRESULT flushPrimitives(const UINT* flagBuffer = nullptr);
 
 		HRESULT draw(D3DDDIARG_DRAWPRIMITIVE data, const UINT* flagBuffer);
@@ -37,7 +40,7 @@ namespace D3dDdi
 			UINT minIndex;
 			UINT maxIndex;
 			std::vector<BYTE> vertices;
-			std::vector<UINT16> indices;
+			std::vector<UINT> indices;
 		};
 
 		struct StreamSource
@@ -56,6 +59,8 @@ namespace D3dDdi
 			INT baseVertexIndex, UINT minIndex, UINT maxIndex);
 		void appendIndicesAndVertices(const UINT16* indices, UINT count,
 			INT baseVertexIndex, UINT minIndex, UINT maxIndex);
+		void appendLineStrip(INT baseVertexIndex, UINT primitiveCount,
+			const UINT16* indices, UINT minIndex, UINT maxIndex);
 		void appendLineOrTriangleList(INT baseVertexIndex, UINT primitiveCount, UINT vpp,
 			const UINT16* indices, UINT minIndex, UINT maxIndex);
 		bool appendPrimitives(D3DPRIMITIVETYPE primitiveType, INT baseVertexIndex, UINT primitiveCount,
@@ -65,15 +70,23 @@ namespace D3dDdi
 		void appendTriangleStrip(INT baseVertexIndex, UINT primitiveCount,
 			const UINT16* indices, UINT minIndex, UINT maxIndex);
 		void appendVertices(UINT base, UINT count);
+		void bindIndexBuffer();
+		void bindVertexBuffer();
 		void clearBatchedPrimitives();
+		void convertIndexedLineStripToList(UINT startPrimitive, UINT primitiveCount);
 		void convertIndexedTriangleFanToList(UINT startPrimitive, UINT primitiveCount);
 		void convertIndexedTriangleStripToList(UINT startPrimitive, UINT primitiveCount);
+		void convertToLineList();
 		void convertToTriangleList();
 		HRESULT flush(const UINT* flagBuffer);
 		HRESULT flushIndexed(const UINT* flagBuffer);
 		INT loadIndices(const void* indices, UINT count);
 		INT loadVertices(UINT count);
 		UINT getBatchedVertexCount() const;
+		bool isIndexRangeSupported(INT baseVertexIndex, UINT vertexCount,
+			const UINT16* indices, UINT minIndex, UINT maxIndex) const;
+		void logBatchSizeHistogram() const;
+		void logDynamicBufferStats(const char* name, const DynamicBuffer& buffer) const;
 		void rebaseIndices();
 		void repeatLastBatchedVertex();
 
@@ -81,11 +94,16 @@ namespace D3dDdi
 
 		HANDLE m_device;
 		const D3DDDI_DEVICEFUNCS& m_origVtable;
+		const bool m_is32BitIndexBatchingUsed;
+		const UINT m_maxBatchedPrimitiveCount;
+		const UINT m_maxBatchedIndex;
 		DynamicVertexBuffer m_vertexBuffer;
 		DynamicIndexBuffer m_indexBuffer;
 		StreamSource m_streamSource;
 		std::map<HANDLE, BYTE*> m_sysMemVertexBuffers;
 		BatchedPrimitives m_batched;
 		bool m_isHwVertexProcessingUsed;
+		std::vector<UINT16> m_indices16;
+		std::array<UINT, 20> m_batchSizeHistogram;
 	};
 }
@@ -1,11 +1,23 @@
 #define WIN32_LEAN_AND_MEAN
 #define CINTERFACE
 
+#include <DDrawCompat/v0.3.1/Common/Time.h>
+#include <DDrawCompat/v0.3.1/Config/Config.h>
 #include <DDrawCompat/v0.3.1/D3dDdi/Device.h>
 #include <DDrawCompat/v0.3.1/D3dDdi/DynamicBuffer.h>
 
 namespace
 {
+	UINT getTargetSize(UINT frameBytes)
+	{
+		UINT size = Config30::dynamicBufferMinSize;
+		while (size < 2 * frameBytes && size < Config30::dynamicBufferMaxSize)
+		{
+			size *= 2;
+		}
+		return size;
+	}
+
 	D3DDDI_RESOURCEFLAGS getIndexBufferFlag()
 	{
 		D3DDDI_RESOURCEFLAGS flags = {};
@@ -31,10 +43,64 @@ namespace D3dDdi
 		, m_resourceFlag(resourceFlag)
 		, m_stride(0)
 		, m_pos(0)
+		, m_frameBytes(0)
+		, m_windowPeakFrameBytes(0)
+		, m_shrinkFrameCount(0)
+		, m_stats{}
 	{
 		resize(size);
 	}
 
+	bool DynamicBuffer::endFrame()
+	{
+		const UINT frameBytes = m_frameBytes;
+		m_frameBytes = 0;
+		++m_stats.frames;
+		m_stats.totalBytes += frameBytes;
+		if (frameBytes > m_stats.peakFrameBytes)
+		{
+			m_stats.peakFrameBytes = frameBytes;
+		}
+
+		if (!m_resource)
+		{
+			return false;
+		}
+
+		if (frameBytes > m_size)
+		{
+			const UINT size = getTargetSize(frameBytes);
+			if (size > m_size)
+			{
+				resize(size);
+				return true;
+			}
+			return false;
+		}
+
+		if (frameBytes > m_windowPeakFrameBytes)
+		{
+			m_windowPeakFrameBytes = frameBytes;
+		}
+
+		const UINT size = getTargetSize(m_windowPeakFrameBytes);
+		if (size > m_size / 4)
+		{
+			m_shrinkFrameCount = 0;
+			m_windowPeakFrameBytes = frameBytes;
+			return false;
+		}
+
+		++m_shrinkFrameCount;
+		if (m_shrinkFrameCount < Config30::dynamicBufferShrinkDelay)
+		{
+			return false;
+		}
+
+		resize(size);
+		return true;
+	}
+
 	void* DynamicBuffer::lock(UINT size)
 	{
 		D3DDDIARG_LOCK lock = {};
@@ -46,6 +112,7 @@ namespace D3dDdi
 		if (0 == m_pos)
 		{
 			lock.Flags.Discard = 1;
+			++m_stats.discards;
 		}
 		else
 		{
@@ -53,7 +120,13 @@ namespace D3dDdi
 			lock.Flags.NoOverwrite = 1;
 		}
 
+		const auto qpcStart = Time::queryPerformanceCounter();
 		HRESULT result = m_device.getOrigVtable().pfnLock(m_device, &lock);
+		if (Time::queryPerformanceCounter() - qpcStart >= Time::msToQpc(Config30::dynamicBufferStallTime))
+		{
+			++m_stats.stalls;
+		}
+
 		if (FAILED(result))
 		{
 			return nullptr;
@@ -67,6 +140,7 @@ namespace D3dDdi
 		if (m_pos + size > m_size)
 		{
 			m_pos = 0;
+			++m_stats.wraps;
 		}
 
 		UINT pos = m_pos;
@@ -79,12 +153,16 @@ namespace D3dDdi
 		memcpy(dst, src, size);
 		unlock();
 		m_pos += size;
+		m_frameBytes += size;
 		return pos / m_stride;
 	}
 
 	void DynamicBuffer::resize(UINT size)
 	{
 		m_size = 0;
+		m_pos = 0;
+		m_windowPeakFrameBytes = 0;
+		m_shrinkFrameCount = 0;
 		if (0 == size)
 		{
 			m_resource.reset();
@@ -110,6 +188,7 @@ namespace D3dDdi
 		{
 			m_resource.reset(cr.hResource);
 			m_size = size;
+			++m_stats.resizes;
 		}
 	}
 
@@ -126,10 +205,10 @@ namespace D3dDdi
 		m_device.getOrigVtable().pfnUnlock(m_device, &unlock);
 	}
 
-	DynamicIndexBuffer::DynamicIndexBuffer(Device& device, UINT size)
-		: DynamicBuffer(device, size, D3DDDIFMT_INDEX16, getIndexBufferFlag())
+	DynamicIndexBuffer::DynamicIndexBuffer(Device& device, UINT size, D3DDDIFORMAT format)
+		: DynamicBuffer(device, size, format, getIndexBufferFlag())
 	{
-		m_stride = 2;
+		m_stride = D3DDDIFMT_INDEX32 == format ? 4 : 2;
 	}
 
 	DynamicVertexBuffer::DynamicVertexBuffer(Device& device, UINT size)
@@ -13,7 +13,20 @@ namespace D3dDdi
 	class DynamicBuffer
 	{
 	public:
+		struct Stats
+		{
+			UINT frames;
+			UINT discards;
+			UINT wraps;
+			UINT stalls;
+			UINT resizes;
+			UINT peakFrameBytes;
+			ULONGLONG totalBytes;
+		};
+
+		bool endFrame();
 		UINT getSize() const { return m_size; }
+		const Stats& getStats() const { return m_stats; }
 		INT load(const void* src, UINT count);
 		void resize(UINT size);
 
@@ -33,12 +46,16 @@ namespace D3dDdi
 		D3DDDI_RESOURCEFLAGS m_resourceFlag;
 		UINT m_stride;
 		UINT m_pos;
+		UINT m_frameBytes;
+		UINT m_windowPeakFrameBytes;
+		UINT m_shrinkFrameCount;
+		Stats m_stats;
 	};
 
 	class DynamicIndexBuffer : public DynamicBuffer
 	{
 	public:
-		DynamicIndexBuffer(Device& device, UINT size);
+		DynamicIndexBuffer(Device& device, UINT size, D3DDDIFORMAT format);
 	};
 
 	class DynamicVertexBuffer : public DynamicBuffer
@@ -1,7 +1,10 @@
 #define WIN32_LEAN_AND_MEAN
 #define CINTERFACE
 
+#include <algorithm>
 #include <atomic>
+#include <cstdlib>
+#include <sstream>
 #include <string>
 
 #include <DDrawCompat/DDrawLog.h>
@@ -36,11 +39,23 @@ namespace
 	std::string g_lastDDrawCreateDcDevice;
 
 	std::atomic<long long> g_qpcLastVsync = 0;
+	std::atomic<long long> g_qpcLastPresent = 0;
 	UINT g_vsyncCounter = 0;
 	CONDITION_VARIABLE g_vsyncCounterCv = CONDITION_VARIABLE_INIT;
 	Compat31::SrwLock g_vsyncCounterSrwLock;
+	D3dDdi::KernelModeThunks::VsyncStats g_vsyncStats = {};
 
-	void waitForVerticalBlank();
+	// Consecutive intervals counted as missed vblanks. After a refresh rate drop every interval is long,
+	// so after VSYNC_RESEED_COUNT of them the average is re-seeded and they are no longer counted as missed.
+	const UINT VSYNC_RESEED_COUNT = 8;
+	struct LongVsyncIntervals
+	{
+		UINT count;
+		UINT missedVsyncCount;
+		long long totalUs;
+	} g_longVsyncIntervals = {};
+
+	bool waitForVerticalBlank();
 
 	NTSTATUS APIENTRY closeAdapter(const D3DKMT_CLOSEADAPTER* pData)
 	{
@@ -235,24 +250,92 @@ namespace
 		}
 	}
 
+	template <UINT size>
+	void addToHistogram(UINT(&histogram)[size], const long long(&limits)[size], long long value)
+	{
+		UINT i = 0;
+		while (value > limits[i])
+		{
+			++i;
+		}
+		++histogram[i];
+	}
+
+	void updateVsyncStats(long long qpcVsync, long long qpcPrevVsync, long long qpcPresent)
+	{
+		auto& stats = g_vsyncStats;
+		++stats.vsyncCount;
+
+		if (0 != qpcPrevVsync)
+		{
+			const long long intervalUs = Time::qpcToUs(qpcVsync - qpcPrevVsync);
+			if (0 == stats.avgIntervalUs)
+			{
+				stats.avgIntervalUs = intervalUs;
+			}
+			else if (intervalUs > stats.avgIntervalUs * 3 / 2)
+			{
+				const UINT missedVsyncCount = static_cast<UINT>((intervalUs + stats.avgIntervalUs / 2) / stats.avgIntervalUs - 1);
+				stats.missedVsyncCount += missedVsyncCount;
+
+				auto& longIntervals = g_longVsyncIntervals;
+				++longIntervals.count;
+				longIntervals.missedVsyncCount += missedVsyncCount;
+				longIntervals.totalUs += intervalUs;
+				if (longIntervals.count >= VSYNC_RESEED_COUNT)
+				{
+					stats.missedVsyncCount -= longIntervals.missedVsyncCount;
+					stats.avgIntervalUs = longIntervals.totalUs / longIntervals.count;
+					longIntervals = {};
+				}
+			}
+			else
+			{
+				g_longVsyncIntervals = {};
+				const long long jitterUs = std::abs(intervalUs - stats.avgIntervalUs);
+				stats.maxJitterUs = std::max<long long>(stats.maxJitterUs, jitterUs);
+				addToHistogram(stats.jitterHistogram, stats.JITTER_BUCKETS, jitterUs);
+				stats.avgIntervalUs += (intervalUs - stats.avgIntervalUs) / 16;
+			}
+		}
+
+		if (0 != qpcPresent)
+		{
+			const long long latencyUs = Time::qpcToUs(qpcVsync - qpcPresent);
+			++stats.presentCount;
+			stats.totalPresentLatencyUs += latencyUs;
+			stats.maxPresentLatencyUs = std::max<long long>(stats.maxPresentLatencyUs, latencyUs);
+			addToHistogram(stats.presentLatencyHistogram, stats.LATENCY_BUCKETS, latencyUs);
+		}
+	}
+
 	unsigned WINAPI vsyncThreadProc(LPVOID /*lpParameter*/)
 	{
+		long long qpcPrevVsync = 0;
 		while (true)
 		{
-			waitForVerticalBlank();
-			g_qpcLastVsync = Time::queryPerformanceCounter();
+			const bool isVsync = waitForVerticalBlank();
+			const long long qpcVsync = Time::queryPerformanceCounter();
+			g_qpcLastVsync = qpcVsync;
+			const long long qpcPresent = g_qpcLastPresent.exchange(0);
 
 			{
 				Compat31::ScopedSrwLockExclusive lock(g_vsyncCounterSrwLock);
 				++g_vsyncCounter;
+				if (isVsync)
+				{
+					updateVsyncStats(qpcVsync, qpcPrevVsync, qpcPresent);
+				}
 			}
 
+			qpcPrevVsync = isVsync ? qpcVsync : 0;
+
 			WakeAllConditionVariable(&g_vsyncCounterCv);
 		}
 		return 0;
 	}
 
-	void waitForVerticalBlank()
+	bool waitForVerticalBlank()
 	{
 		D3DKMT_WAITFORVERTICALBLANKEVENT data = {};
 
@@ -272,7 +355,9 @@ namespace
 		if (!data.hAdapter || FAILED(D3DKMTWaitForVerticalBlankEvent(&data)))
 		{
 			Sleep(16);
+			return false;
 		}
+		return true;
 	}
 }
 
@@ -315,6 +400,12 @@ namespace D3dDdi
 			return g_vsyncCounter;
 		}
 
+		VsyncStats getVsyncStats()
+		{
+			Compat31::ScopedSrwLockShared lock(g_vsyncCounterSrwLock);
+			return g_vsyncStats;
+		}
+
 		void installHooks()
 		{
 			Compat31::hookIatFunction(Dll::g_origDDrawModule, "CreateDCA", ddrawCreateDcA);
@@ -327,6 +418,38 @@ namespace D3dDdi
 			Dll::createThread(&vsyncThreadProc, nullptr, THREAD_PRIORITY_TIME_CRITICAL);
 		}
 
+		void logVsyncStats()
+		{
+			const auto stats = getVsyncStats();
+			if (0 == stats.vsyncCount)
+			{
+				return;
+			}
+
+			std::ostringstream jitter;
+			std::ostringstream latency;
+			for (UINT i = 0; i < VsyncStats::BUCKET_COUNT; ++i)
+			{
+				jitter << ' ' << stats.jitterHistogram[i];
+				latency << ' ' << stats.presentLatencyHistogram[i];
+			}
+
+			Compat31::Log() << "Vsync: " << stats.vsyncCount << " vblanks, " << stats.missedVsyncCount << " missed"
+				<< ", average interval " << stats.avgIntervalUs << " us, max jitter " << stats.maxJitterUs << " us";
+			Compat31::Log() << "Vsync jitter histogram (<=50/100/250/500/1000/2000/4000/more us):" << jitter.str();
+			if (0 != stats.presentCount)
+			{
+				Compat31::Log() << "Present to vblank latency: " << stats.presentCount << " presents, average "
+					<< stats.totalPresentLatencyUs / stats.presentCount << " us, max " << stats.maxPresentLatencyUs << " us";
+				Compat31::Log() << "Present latency histogram (<=1/2/4/8/12/16/33/more ms):" << latency.str();
+			}
+		}
+
+		void notifyPresent()
+		{
+			g_qpcLastPresent = Time::queryPerformanceCounter();
+		}
+
 		void setDcFormatOverride(UINT format)
 		{
 			g_dcFormatOverride = static_cast<D3DDDIFORMAT>(format);
@@ -1,15 +1,38 @@
 #pragma once
 
+#include <climits>
+
 #include <Windows.h>
 
 namespace D3dDdi
 {
 	namespace KernelModeThunks
 	{
+		struct VsyncStats
+		{
+			// Upper bucket limits in microseconds, the last bucket is unbounded
+			static constexpr long long JITTER_BUCKETS[] = { 50, 100, 250, 500, 1000, 2000, 4000, LLONG_MAX };
+			static constexpr long long LATENCY_BUCKETS[] = { 1000, 2000, 4000, 8000, 12000, 16000, 33000, LLONG_MAX };
+			static const UINT BUCKET_COUNT = 8;
+
+			UINT vsyncCount;
+			UINT missedVsyncCount;
+			long long avgIntervalUs;
+			long long maxJitterUs;
+			UINT jitterHistogram[BUCKET_COUNT];
+			UINT presentCount;
+			long long totalPresentLatencyUs;
+			long long maxPresentLatencyUs;
+			UINT presentLatencyHistogram[BUCKET_COUNT];
+		};
+
 		RECT getMonitorRect();
 		long long getQpcLastVsync();
 		UINT getVsyncCounter();
+		VsyncStats getVsyncStats();
 		void installHooks();
+		void logVsyncStats();
+		void notifyPresent();
 		void setDcFormatOverride(UINT format);
 		void setDcPaletteOverride(bool enable);
 		void waitForVsync();
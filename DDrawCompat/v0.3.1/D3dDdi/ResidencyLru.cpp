@@ -0,0 +1,151 @@
+#include <DDrawCompat/v0.3.1/D3dDdi/ResidencyLru.h>
+
+namespace D3dDdi
+{
+	ResidencyLru::ResidencyLru(EvictFunc evict)
+		: m_evict(evict)
+		, m_budget(~0ull)
+		, m_redundantBytes(0)
+		, m_residentBytes{}
+		, m_evictedBytes(0)
+	{
+	}
+
+	void ResidencyLru::add(const Key& key, unsigned long long size, bool isRedundant)
+	{
+		remove(key);
+
+		Entry& entry = m_entries[key];
+		entry.size = size;
+		entry.isResident = true;
+		entry.isRedundant = false;
+		entry.lruPos = m_lru.insert(m_lru.begin(), key);
+		m_residentBytes[SYSMEM] += size;
+		m_residentBytes[VIDMEM] += size;
+
+		setRedundant(entry, isRedundant);
+		enforceBudget(key);
+	}
+
+	void ResidencyLru::enforceBudget()
+	{
+		auto it = m_lru.end();
+		while (m_redundantBytes > m_budget && it != m_lru.begin())
+		{
+			--it;
+			Entry& entry = m_entries.find(*it)->second;
+			if (!entry.isRedundant || m_pins.find(*it) != m_pins.end() || !m_evict(*it))
+			{
+				continue;
+			}
+
+			it = m_lru.erase(it);
+			entry.isResident = false;
+			entry.lruPos = m_lru.end();
+			m_residentBytes[SYSMEM] -= entry.size;
+			m_redundantBytes -= entry.size;
+			m_evictedBytes += entry.size;
+		}
+	}
+
+	void ResidencyLru::enforceBudget(const Key& inUse)
+	{
+		++m_pins[inUse];
+		enforceBudget();
+		auto it = m_pins.find(inUse);
+		if (0 == --it->second)
+		{
+			m_pins.erase(it);
+		}
+	}
+
+	bool ResidencyLru::isResident(const Key& key) const
+	{
+		auto it = m_entries.find(key);
+		return it != m_entries.end() && it->second.isResident;
+	}
+
+	void ResidencyLru::pin(const Key& key)
+	{
+		++m_pins[key];
+	}
+
+	void ResidencyLru::remove(const Key& key)
+	{
+		auto it = m_entries.find(key);
+		if (it == m_entries.end())
+		{
+			return;
+		}
+
+		Entry& entry = it->second;
+		if (entry.isResident)
+		{
+			setRedundant(entry, false);
+			m_lru.erase(entry.lruPos);
+			m_residentBytes[SYSMEM] -= entry.size;
+		}
+		m_residentBytes[VIDMEM] -= entry.size;
+		m_entries.erase(it);
+	}
+
+	void ResidencyLru::setBudget(unsigned long long budget)
+	{
+		m_budget = budget;
+		enforceBudget();
+	}
+
+	void ResidencyLru::setRedundant(Entry& entry, bool isRedundant)
+	{
+		if (entry.isResident && isRedundant != entry.isRedundant)
+		{
+			if (isRedundant)
+			{
+				m_redundantBytes += entry.size;
+			}
+			else
+			{
+				m_redundantBytes -= entry.size;
+			}
+		}
+		entry.isRedundant = isRedundant;
+	}
+
+	void ResidencyLru::unpin(const Key& key)
+	{
+		auto it = m_pins.find(key);
+		if (it != m_pins.end() && 0 == --it->second)
+		{
+			m_pins.erase(it);
+			enforceBudget();
+		}
+	}
+
+	void ResidencyLru::update(const Key& key, bool isRedundant)
+	{
+		auto it = m_entries.find(key);
+		if (it != m_entries.end())
+		{
+			setRedundant(it->second, isRedundant);
+			enforceBudget();
+		}
+	}
+
+	void ResidencyLru::use(const Key& key, bool isRedundant)
+	{
+		auto it = m_entries.find(key);
+		if (it == m_entries.end())
+		{
+			return;
+		}
+
+		Entry& entry = it->second;
+		if (entry.isResident)
+		{
+			m_lru.splice(m_lru.begin(), m_lru, entry.lruPos);
+		}
+
+		setRedundant(entry, isRedundant);
+		enforceBudget(key);
+	}
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <functional>
+#include <list>
+#include <unordered_map>
+
+namespace D3dDdi
+{
+	// Tracks the system memory copies kept next to video memory resources, and keeps the size of the
+	// copies that hold nothing the video memory copy lacks (redundant copies) within a budget by
+	// releasing the least recently used one. Keys include the device, because resource handles are
+	// only unique per device. Only depends on the standard library, so it can be built and tested
+	// without a driver (see ResidencyLruTest).
+	class ResidencyLru
+	{
+	public:
+		enum Pool
+		{
+			SYSMEM,
+			VIDMEM
+		};
+
+		struct Key
+		{
+			const void* device;
+			const void* resource;
+
+			bool operator==(const Key& other) const
+			{
+				return device == other.device && resource == other.resource;
+			}
+		};
+
+		// Releases the memory of the system memory copy. Returns false if it cannot be released right
+		// now (e.g. it is locked). Must not call back into the ResidencyLru.
+		typedef std::function<bool(const Key& key)> EvictFunc;
+
+		// Keeps the copy of a resource resident while it is in use, e.g. the other side of a blit
+		class Pin
+		{
+		public:
+			Pin(ResidencyLru& lru, const Key& key) : m_lru(lru), m_key(key) { m_lru.pin(m_key); }
+			~Pin() { m_lru.unpin(m_key); }
+
+			Pin(const Pin&) = delete;
+			Pin& operator=(const Pin&) = delete;
+
+		private:
+			ResidencyLru& m_lru;
+			Key m_key;
+		};
+
+		ResidencyLru(EvictFunc evict);
+
+		ResidencyLru(const ResidencyLru&) = delete;
+		ResidencyLru& operator=(const ResidencyLru&) = delete;
+
+		void add(const Key& key, unsigned long long size, bool isRedundant);
+		bool isResident(const Key& key) const;
+		void pin(const Key& key);
+		void remove(const Key& key);
+		void setBudget(unsigned long long budget);
+		void unpin(const Key& key);
+		void update(const Key& key, bool isRedundant);
+		void use(const Key& key, bool isRedundant);
+
+		unsigned long long getBudget() const { return m_budget; }
+		unsigned long long getEvictedBytes() const { return m_evictedBytes; }
+		unsigned long long getRedundantBytes() const { return m_redundantBytes; }
+		unsigned long long getResidentBytes(Pool pool) const { return m_residentBytes[pool]; }
+
+	private:
+		struct KeyHash
+		{
+			std::size_t operator()(const Key& key) const
+			{
+				return std::hash<const void*>()(key.device) ^ (std::hash<const void*>()(key.resource) << 1);
+			}
+		};
+
+		struct Entry
+		{
+			unsigned long long size;
+			bool isResident;
+			bool isRedundant;
+			std::list<Key>::iterator lruPos;
+		};
+
+		void enforceBudget();
+		void enforceBudget(const Key& inUse);
+		void setRedundant(Entry& entry, bool isRedundant);
+
+		EvictFunc m_evict;
+		unsigned long long m_budget;
+		unsigned long long m_redundantBytes;
+		unsigned long long m_residentBytes[2];
+		unsigned long long m_evictedBytes;
+		std::list<Key> m_lru;
+		std::unordered_map<Key, Entry, KeyHash> m_entries;
+		std::unordered_map<Key, unsigned, KeyHash> m_pins;
+	};
+}
@@ -0,0 +1,204 @@
+// Unit tests for the system memory copy LRU in ResidencyLru.h. The LRU only uses the standard library,
+// so the tests build without the driver headers, from this folder:
+//   g++ -std=c++17 -O2 -I../../../.. -o residencylrutest ResidencyLruTest.cpp ../ResidencyLru.cpp
+//   cl /std:c++17 /EHsc /O2 /I..\..\..\.. ResidencyLruTest.cpp ..\ResidencyLru.cpp
+//
+// Usage: residencylrutest
+
+#include <cstdio>
+#include <set>
+#include <vector>
+
+#include <DDrawCompat/v0.3.1/D3dDdi/ResidencyLru.h>
+
+using D3dDdi::ResidencyLru;
+
+namespace
+{
+	int g_failures = 0;
+
+	void check(bool condition, const char* expr, int line)
+	{
+		if (!condition)
+		{
+			std::printf("FAILED line %d: %s\n", line, expr);
+			++g_failures;
+		}
+	}
+
+#define CHECK(expr) check(expr, #expr, __LINE__)
+
+	const void* const DEVICE1 = reinterpret_cast<const void*>(0x1000);
+	const void* const DEVICE2 = reinterpret_cast<const void*>(0x2000);
+
+	ResidencyLru::Key key(const void* device, std::size_t resource)
+	{
+		return { device, reinterpret_cast<const void*>(resource) };
+	}
+
+	// Stands in for Resource::evictSysMemCopy: records what was released and refuses locked resources
+	struct Evictor
+	{
+		std::vector<ResidencyLru::Key> evicted;
+		std::set<const void*> locked;
+
+		ResidencyLru::EvictFunc func()
+		{
+			return [this](const ResidencyLru::Key& key)
+			{
+				if (locked.count(key.resource))
+				{
+					return false;
+				}
+				evicted.push_back(key);
+				return true;
+			};
+		}
+	};
+
+	void testEvictsLeastRecentlyUsed()
+	{
+		Evictor evictor;
+		ResidencyLru lru(evictor.func());
+		lru.setBudget(200);
+		lru.add(key(DEVICE1, 1), 100, true);
+		lru.add(key(DEVICE1, 2), 100, true);
+		lru.use(key(DEVICE1, 1), true);
+		lru.add(key(DEVICE1, 3), 100, true);
+
+		CHECK(1 == evictor.evicted.size());
+		CHECK(evictor.evicted[0] == key(DEVICE1, 2));
+		CHECK(!lru.isResident(key(DEVICE1, 2)));
+		CHECK(lru.isResident(key(DEVICE1, 1)));
+		CHECK(200 == lru.getRedundantBytes());
+		CHECK(200 == lru.getResidentBytes(ResidencyLru::SYSMEM));
+		CHECK(300 == lru.getResidentBytes(ResidencyLru::VIDMEM));
+		CHECK(100 == lru.getEvictedBytes());
+	}
+
+	void testKeepsCopiesWithUniqueData()
+	{
+		Evictor evictor;
+		ResidencyLru lru(evictor.func());
+		lru.add(key(DEVICE1, 1), 100, false);
+		lru.add(key(DEVICE1, 2), 100, true);
+		lru.setBudget(0);
+
+		CHECK(1 == evictor.evicted.size());
+		CHECK(lru.isResident(key(DEVICE1, 1)));
+		CHECK(0 == lru.getRedundantBytes());
+
+		lru.update(key(DEVICE1, 1), true);
+		CHECK(2 == evictor.evicted.size());
+		CHECK(!lru.isResident(key(DEVICE1, 1)));
+	}
+
+	void testKeysIncludeDevice()
+	{
+		Evictor evictor;
+		ResidencyLru lru(evictor.func());
+		lru.add(key(DEVICE1, 1), 100, true);
+		lru.add(key(DEVICE2, 1), 50, true);
+		CHECK(150 == lru.getResidentBytes(ResidencyLru::SYSMEM));
+
+		lru.remove(key(DEVICE2, 1));
+		CHECK(lru.isResident(key(DEVICE1, 1)));
+		CHECK(100 == lru.getResidentBytes(ResidencyLru::SYSMEM));
+
+		lru.setBudget(0);
+		CHECK(1 == evictor.evicted.size());
+		CHECK(evictor.evicted[0] == key(DEVICE1, 1));
+	}
+
+	void testKeepsCopyInUse()
+	{
+		Evictor evictor;
+		ResidencyLru lru(evictor.func());
+		lru.setBudget(0);
+		lru.add(key(DEVICE1, 1), 100, true);
+		CHECK(evictor.evicted.empty());
+
+		lru.use(key(DEVICE1, 1), true);
+		CHECK(evictor.evicted.empty());
+
+		lru.add(key(DEVICE1, 2), 100, true);
+		CHECK(1 == evictor.evicted.size());
+		CHECK(evictor.evicted[0] == key(DEVICE1, 1));
+		CHECK(lru.isResident(key(DEVICE1, 2)));
+	}
+
+	void testKeepsPinnedCopies()
+	{
+		Evictor evictor;
+		ResidencyLru lru(evictor.func());
+		lru.add(key(DEVICE1, 1), 100, true);
+		lru.add(key(DEVICE1, 2), 100, true);
+		{
+			ResidencyLru::Pin pin1(lru, key(DEVICE1, 1));
+			ResidencyLru::Pin pin2(lru, key(DEVICE1, 2));
+			lru.setBudget(0);
+			CHECK(evictor.evicted.empty());
+		}
+		CHECK(2 == evictor.evicted.size());
+		CHECK(0 == lru.getRedundantBytes());
+	}
+
+	void testSkipsLockedCopies()
+	{
+		Evictor evictor;
+		ResidencyLru lru(evictor.func());
+		lru.add(key(DEVICE1, 1), 100, true);
+		lru.add(key(DEVICE1, 2), 100, true);
+		evictor.locked.insert(key(DEVICE1, 1).resource);
+		lru.setBudget(100);
+
+		CHECK(1 == evictor.evicted.size());
+		CHECK(evictor.evicted[0] == key(DEVICE1, 2));
+		CHECK(lru.isResident(key(DEVICE1, 1)));
+	}
+
+	void testReaddAfterEviction()
+	{
+		Evictor evictor;
+		ResidencyLru lru(evictor.func());
+		lru.setBudget(100);
+		lru.add(key(DEVICE1, 1), 100, true);
+		lru.add(key(DEVICE1, 2), 100, true);
+		CHECK(!lru.isResident(key(DEVICE1, 1)));
+
+		lru.use(key(DEVICE1, 1), true);
+		CHECK(!lru.isResident(key(DEVICE1, 1)));
+		CHECK(100 == lru.getResidentBytes(ResidencyLru::SYSMEM));
+
+		lru.add(key(DEVICE1, 1), 100, true);
+		CHECK(lru.isResident(key(DEVICE1, 1)));
+		CHECK(!lru.isResident(key(DEVICE1, 2)));
+		CHECK(100 == lru.getResidentBytes(ResidencyLru::SYSMEM));
+		CHECK(200 == lru.getResidentBytes(ResidencyLru::VIDMEM));
+
+		lru.remove(key(DEVICE1, 1));
+		lru.remove(key(DEVICE1, 2));
+		CHECK(0 == lru.getResidentBytes(ResidencyLru::SYSMEM));
+		CHECK(0 == lru.getResidentBytes(ResidencyLru::VIDMEM));
+		CHECK(0 == lru.getRedundantBytes());
+	}
+}
+
+int main()
+{
+	testEvictsLeastRecentlyUsed();
+	testKeepsCopiesWithUniqueData();
+	testKeysIncludeDevice();
+	testKeepsCopyInUse();
+	testKeepsPinnedCopies();
+	testSkipsLockedCopies();
+	testReaddAfterEviction();
+
+	if (0 != g_failures)
+	{
+		std::printf("%d check(s) failed\n", g_failures);
+		return 1;
+	}
+	std::printf("All tests passed\n");
+	return 0;
+}
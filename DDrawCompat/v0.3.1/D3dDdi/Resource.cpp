@@ -76,6 +76,14 @@ namespace
 		return flags;
 	}
 
+	bool evictSysMemCopy(const D3dDdi::ResidencyLru::Key& key)
+	{
+		auto resource = D3dDdi::Device::findResource(const_cast<void*>(key.device), const_cast<void*>(key.resource));
+		return resource && resource->evictSysMemCopy();
+	}
+
+	D3dDdi::ResidencyLru g_residency(&evictSysMemCopy);
+
 	void heapFree(void* p)
 	{
 		HeapFree(GetProcessHeap(), 0, p);
@@ -146,6 +154,7 @@ namespace D3dDdi
 		, m_fixedData(data)
 		, m_lockBuffer(nullptr, &heapFree)
 		, m_lockResource(nullptr, ResourceDeleter(device))
+		, m_isSysMemEvicted(false)
 	{
 		if (m_origData.Flags.VertexBuffer &&
 			m_origData.Flags.MightDrawFromLocked &&
@@ -190,6 +199,26 @@ namespace D3dDdi
 	{
 	}
 
+	// The moved-from resource must not remove the residency entry it shares with this one
+	Resource::Resource(Resource&& other)
+		: m_device(other.m_device)
+		, m_handle(other.m_handle)
+		, m_origData(std::move(other.m_origData))
+		, m_fixedData(std::move(other.m_fixedData))
+		, m_formatInfo(other.m_formatInfo)
+		, m_lockBuffer(std::move(other.m_lockBuffer))
+		, m_lockData(std::move(other.m_lockData))
+		, m_lockResource(std::move(other.m_lockResource))
+		, m_isSysMemEvicted(other.m_isSysMemEvicted)
+	{
+		other.m_isSysMemEvicted = false;
+	}
+
+	Resource::~Resource()
+	{
+		removeResidency();
+	}
+
 	HRESULT Resource::blt(D3DDDIARG_BLT data)
 	{
 		if (!isValidRect(data.DstSubResourceIndex, data.DstRect))
@@ -248,6 +277,7 @@ namespace D3dDdi
 		}
 		lockData.isVidMemUpToDate &= data.Flags.ReadOnly;
 		lockData.qpcLastForcedLock = Time::queryPerformanceCounter();
+		useSysMemCopy();
 
 		unsigned char* ptr = static_cast<unsigned char*>(lockData.data);
 		if (data.Flags.AreaValid)
@@ -301,6 +331,7 @@ namespace D3dDdi
 					m_formatInfo.bytesPerPixel, colorConvert(m_formatInfo, data.Color));
 
 				m_lockData[data.SubResourceIndex].isVidMemUpToDate = false;
+				useSysMemCopy();
 				return LOG_RESULT(S_OK);
 			}
 		}
@@ -429,6 +460,11 @@ namespace D3dDdi
 			m_lockBuffer.reset();
 			m_lockData.clear();
 		}
+		else if (D3DDDIFMT_P8 != m_fixedData.Format)
+		{
+			// presentationBlt reads the system memory copy of palettized surfaces directly, so it is kept
+			g_residency.add(getResidencyKey(), bufferSize, isSysMemCopyRedundant());
+		}
 	}
 
 	void Resource::createSysMemResource(const std::vector<D3DDDI_SURFACEINFO>& surfaceInfo)
@@ -462,16 +498,59 @@ namespace D3dDdi
 #endif
 	}
 
+	bool Resource::evictSysMemCopy()
+	{
+		if (!m_lockBuffer || !isSysMemCopyRedundant())
+		{
+			return false;
+		}
+
+		for (const auto& lockData : m_lockData)
+		{
+			if (0 != lockData.lockCount)
+			{
+				return false;
+			}
+		}
+
+		m_lockResource.reset();
+		m_lockBuffer.reset();
+		for (auto& lockData : m_lockData)
+		{
+			lockData.data = nullptr;
+			lockData.isSysMemUpToDate = false;
+		}
+		m_isSysMemEvicted = true;
+		return true;
+	}
+
 	void* Resource::getLockPtr(UINT subResourceIndex)
 	{
 		return m_lockData.empty() ? nullptr : m_lockData[subResourceIndex].data;
 	}
 
+	ResidencyLru::Key Resource::getResidencyKey() const
+	{
+		return { static_cast<HANDLE>(m_device), m_handle };
+	}
+
 	bool Resource::isOversized() const
 	{
 		return m_fixedData.SurfCount != m_origData.SurfCount;
 	}
 
+	bool Resource::isSysMemCopyRedundant() const
+	{
+		for (const auto& lockData : m_lockData)
+		{
+			if (!lockData.isVidMemUpToDate)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
 	bool Resource::isValidRect(UINT subResourceIndex, const RECT& rect)
 	{
 		return rect.left >= 0 && rect.top >= 0 && rect.left < rect.right && rect.top < rect.bottom &&
@@ -492,6 +571,7 @@ namespace D3dDdi
 			return splitLock(data, m_device.getOrigVtable().pfnLock);
 		}
 
+		restoreSysMemCopy();
 		if (m_lockResource)
 		{
 			return bltLock(data);
@@ -500,6 +580,14 @@ namespace D3dDdi
 		return m_device.getOrigVtable().pfnLock(m_device, &data);
 	}
 
+	void Resource::logResidency()
+	{
+		Compat::Log() << "Resident surface copies: system memory " << g_residency.getResidentBytes(ResidencyLru::SYSMEM)
+			<< " bytes, video memory " << g_residency.getResidentBytes(ResidencyLru::VIDMEM)
+			<< " bytes, redundant " << g_residency.getRedundantBytes()
+			<< " bytes, released " << g_residency.getEvictedBytes() << " bytes";
+	}
+
 	void Resource::prepareForGdiRendering(bool isReadOnly)
 	{
 		if (!m_lockResource)
@@ -513,6 +601,7 @@ namespace D3dDdi
 		}
 		m_lockData[0].isVidMemUpToDate &= isReadOnly;
 		m_lockData[0].qpcLastForcedLock = Time::queryPerformanceCounter();
+		useSysMemCopy();
 	}
 
 	void Resource::prepareForRendering(UINT subResourceIndex, bool isReadOnly)
@@ -524,6 +613,7 @@ namespace D3dDdi
 				copyToVidMem(subResourceIndex);
 			}
 			m_lockData[subResourceIndex].isSysMemUpToDate &= isReadOnly;
+			updateResidency();
 		}
 	}
 
@@ -569,15 +659,41 @@ namespace D3dDdi
 			srcResource.m_lockData[data.SrcSubResourceIndex].isSysMemUpToDate)
 		{
 			srcResource.copyToVidMem(data.SrcSubResourceIndex);
+			srcResource.updateResidency();
 		}
 		return m_device.getOrigVtable().pfnBlt(m_device, &data);
 	}
 
+	void Resource::removeResidency()
+	{
+		if (m_lockBuffer || m_isSysMemEvicted)
+		{
+			g_residency.remove(getResidencyKey());
+		}
+	}
+
+	void Resource::restoreSysMemCopy()
+	{
+		if (!m_isSysMemEvicted)
+		{
+			return;
+		}
+
+		m_isSysMemEvicted = false;
+		createLockResource();
+		for (auto& lockData : m_lockData)
+		{
+			lockData.isSysMemUpToDate = false;
+		}
+	}
+
 	void Resource::setAsGdiResource(bool isGdiResource)
 	{
+		removeResidency();
 		m_lockResource.reset();
 		m_lockData.clear();
 		m_lockBuffer.reset();
+		m_isSysMemEvicted = false;
 		if (isGdiResource)
 		{
 			createGdiLockResource();
@@ -655,28 +771,44 @@ namespace D3dDdi
 			!m_lockData.empty() &&
 			!srcResource.m_lockData.empty())
 		{
-			auto& dstLockData = m_lockData[data.DstSubResourceIndex];
-			auto& srcLockData = srcResource.m_lockData[data.SrcSubResourceIndex];
-
 			bool isSysMemBltPreferred = true;
+			bool isForced = false;
 			auto now = Time::queryPerformanceCounter();
 			if (D3DDDIFMT_P8 != m_fixedData.Format)
 			{
 				if (data.Flags.MirrorLeftRight || data.Flags.MirrorUpDown ||
 					(data.Flags.SrcColorKey && !m_device.isSrcColorKeySupported()))
 				{
-					dstLockData.qpcLastForcedLock = now;
-					srcLockData.qpcLastForcedLock = now;
+					isForced = true;
 				}
 				else
 				{
+					auto& dstLockData = m_lockData[data.DstSubResourceIndex];
 					isSysMemBltPreferred = dstLockData.isSysMemUpToDate &&
 						Time::qpcToMs(now - dstLockData.qpcLastForcedLock) <= Config30::evictionTimeout;
 				}
 			}
 
+			// Keeps either copy from being released to make room for the other one
+			ResidencyLru::Pin dstPin(g_residency, getResidencyKey());
+			ResidencyLru::Pin srcPin(g_residency, srcResource.getResidencyKey());
+			if (isSysMemBltPreferred)
+			{
+				// Copies released by the budget are recreated, which resets their lock data
+				restoreSysMemCopy();
+				srcResource.restoreSysMemCopy();
+				isSysMemBltPreferred = !m_lockData.empty() && !srcResource.m_lockData.empty();
+			}
+			if (isSysMemBltPreferred && isForced)
+			{
+				m_lockData[data.DstSubResourceIndex].qpcLastForcedLock = now;
+				srcResource.m_lockData[data.SrcSubResourceIndex].qpcLastForcedLock = now;
+			}
+
 			if (isSysMemBltPreferred)
 			{
+				auto& dstLockData = m_lockData[data.DstSubResourceIndex];
+				auto& srcLockData = srcResource.m_lockData[data.SrcSubResourceIndex];
 				if (!dstLockData.isSysMemUpToDate)
 				{
 					copyToSysMem(data.DstSubResourceIndex);
@@ -688,6 +820,9 @@ namespace D3dDdi
 					srcResource.copyToSysMem(data.SrcSubResourceIndex);
 				}
 
+				useSysMemCopy();
+				srcResource.useSysMemCopy();
+
 				auto dstBuf = static_cast<BYTE*>(dstLockData.data) +
 					data.DstRect.top * dstLockData.pitch + data.DstRect.left * m_formatInfo.bytesPerPixel;
 				auto srcBuf = static_cast<const BYTE*>(srcLockData.data) +
@@ -715,6 +850,11 @@ namespace D3dDdi
 		return m_device.getOrigVtable().pfnBlt(m_device, &data);
 	}
 
+	void Resource::setCopyBudget(unsigned long long budget)
+	{
+		g_residency.setBudget(budget);
+	}
+
 	template <typename Arg>
 	HRESULT Resource::splitLock(Arg& data, HRESULT(APIENTRY *lockFunc)(HANDLE, Arg*))
 	{
@@ -750,4 +890,20 @@ namespace D3dDdi
 
 		return m_device.getOrigVtable().pfnUnlock(m_device, &data);
 	}
+
+	void Resource::updateResidency()
+	{
+		if (m_lockBuffer)
+		{
+			g_residency.update(getResidencyKey(), isSysMemCopyRedundant());
+		}
+	}
+
+	void Resource::useSysMemCopy()
+	{
+		if (m_lockBuffer)
+		{
+			g_residency.use(getResidencyKey(), isSysMemCopyRedundant());
+		}
+	}
 }
@@ -7,6 +7,7 @@
 #include <d3dumddi.h>
 
 #include <DDrawCompat/v0.3.1/D3dDdi/FormatInfo.h>
+#include <DDrawCompat/v0.3.1/D3dDdi/ResidencyLru.h>
 
 namespace D3dDdi
 {
@@ -21,13 +22,16 @@ namespace D3dDdi
 		Resource(const Resource&) = delete;
 		Resource& operator=(const Resource&) = delete;
 
-		Resource(Resource&&) = default;
+		Resource(Resource&& other);
 		Resource& operator=(Resource&&) = default;
 
+		~Resource();
+
 		operator HANDLE() const { return m_handle; }
 
 		HRESULT blt(D3DDDIARG_BLT data);
 		HRESULT colorFill(D3DDDIARG_COLORFILL data);
+		bool evictSysMemCopy();
 		void* getLockPtr(UINT subResourceIndex);
 		HRESULT lock(D3DDDIARG_LOCK& data);
 		void prepareForGdiRendering(bool isReadOnly);
@@ -35,6 +39,9 @@ namespace D3dDdi
 		void setAsGdiResource(bool isGdiResource);
 		HRESULT unlock(const D3DDDIARG_UNLOCK& data);
 
+		static void logResidency();
+		static void setCopyBudget(unsigned long long budget);
+
 	private:
 		class Data : public D3DDDIARG_CREATERESOURCE2
 		{
@@ -84,15 +91,21 @@ namespace D3dDdi
 		void createGdiLockResource();
 		void createLockResource();
 		void createSysMemResource(const std::vector<D3DDDI_SURFACEINFO>& surfaceInfo);
+		ResidencyLru::Key getResidencyKey() const;
 		bool isOversized() const;
+		bool isSysMemCopyRedundant() const;
 		bool isValidRect(UINT subResourceIndex, const RECT& rect);
 		HRESULT presentationBlt(const D3DDDIARG_BLT& data, Resource& srcResource);
+		void removeResidency();
+		void restoreSysMemCopy();
 		HRESULT splitBlt(D3DDDIARG_BLT& data, UINT& subResourceIndex, RECT& rect, RECT& otherRect);
 
 		template <typename Arg>
 		HRESULT splitLock(Arg& data, HRESULT(APIENTRY *lockFunc)(HANDLE, Arg*));
 
 		HRESULT sysMemPreferredBlt(const D3DDDIARG_BLT& data, Resource& srcResource);
+		void updateResidency();
+		void useSysMemCopy();
 
 		Device& m_device;
 		HANDLE m_handle;
@@ -102,5 +115,6 @@ namespace D3dDdi
 		std::unique_ptr<void, void(*)(void*)> m_lockBuffer;
 		std::vector<LockData> m_lockData;
 		std::unique_ptr<void, ResourceDeleter> m_lockResource;
+		bool m_isSysMemEvicted;
 	};
 }
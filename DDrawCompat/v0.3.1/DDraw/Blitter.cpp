@@ -7,15 +7,13 @@
 
 #include <intrin.h>
 
-#include <DDrawCompat/v0.3.1/Common/ScopedCriticalSection.h>
 #include <DDrawCompat/v0.3.1/DDraw/Blitter.h>
+#include <DDrawCompat/v0.3.1/DDraw/BlitterAvx2.h>
 
 #pragma warning(disable : 4127)
 
 namespace
 {
-	Compat31::CriticalSection g_overlappingBltCs;
-
 #pragma pack(1)
 	class UInt24
 	{
@@ -472,6 +470,27 @@ namespace
 		}
 	}
 
+	bool isAvx2Supported()
+	{
+		int cpuInfo[4] = {};
+		__cpuid(cpuInfo, 0);
+		if (cpuInfo[0] < 7)
+		{
+			return false;
+		}
+
+		// AVX2 also needs the OS to save the YMM registers
+		__cpuid(cpuInfo, 1);
+		const int osxsaveAndAvx = (1 << 27) | (1 << 28);
+		if ((cpuInfo[2] & osxsaveAndAvx) != osxsaveAndAvx || (_xgetbv(0) & 6) != 6)
+		{
+			return false;
+		}
+
+		__cpuidex(cpuInfo, 7, 0);
+		return 0 != (cpuInfo[1] & (1 << 5));
+	}
+
 	auto getVectorizedBltFuncs()
 	{
 		typename MultiDimArray<decltype(&vectorizedBltFunc<BYTE, 1, false, false, false, false>), 4, 5, 2, 2, 2, 2>::type vectorizedBltFuncs;
@@ -496,6 +515,32 @@ namespace
 				}
 			}
 		}
+
+		// Rows of 16 bytes or more use the AVX2 kernels where the CPU supports them
+		if (isAvx2Supported())
+		{
+			for (int bytesPerPixel = 1; bytesPerPixel <= 4; ++bytesPerPixel)
+			{
+				for (int stretch = 0; stretch <= 1; ++stretch)
+				{
+					for (int mirror = 0; mirror <= 1; ++mirror)
+					{
+						for (int useDstColorKey = 0; useDstColorKey <= 1; ++useDstColorKey)
+						{
+							for (int useSrcColorKey = 0; useSrcColorKey <= 1; ++useSrcColorKey)
+							{
+								auto avx2BltFunc = DDraw::Blitter::Avx2::getBltFunc(bytesPerPixel,
+									0 != stretch, 0 != mirror, 0 != useDstColorKey, 0 != useSrcColorKey);
+								if (avx2BltFunc)
+								{
+									vectorizedBltFuncs[bytesPerPixel - 1][4][stretch][mirror][useDstColorKey][useSrcColorKey] = avx2BltFunc;
+								}
+							}
+						}
+					}
+				}
+			}
+		}
 		return vectorizedBltFuncs;
 	}
 
@@ -570,10 +615,39 @@ namespace
 				}
 				return true;
 			}
+
+			if (dstWidth == absSrcWidth && dstHeight == absSrcHeight)
+			{
+				// Color keyed blits only need one source row buffered at a time, if the rows
+				// are processed in the direction that reads each source row before it is overwritten
+				const DWORD rowByteWidth = dstWidth * bytesPerPixel;
+				thread_local std::vector<BYTE> tmpRow;
+				if (tmpRow.size() < rowByteWidth)
+				{
+					tmpRow.resize(rowByteWidth);
+				}
+
+				LONG step = pitch;
+				if (dst > src)
+				{
+					dst += (dstHeight - 1) * pitch;
+					src += (dstHeight - 1) * pitch;
+					step = -step;
+				}
+
+				for (DWORD y = dstHeight; y != 0; --y)
+				{
+					std::memcpy(tmpRow.data(), src, rowByteWidth);
+					blt(dst, pitch, dstWidth, 1, tmpRow.data(), rowByteWidth, srcWidth, 1,
+						bytesPerPixel, dstColorKey, srcColorKey);
+					dst += step;
+					src += step;
+				}
+				return true;
+			}
 		}
 
-		Compat31::ScopedCriticalSection lock(g_overlappingBltCs);
-		static std::vector<BYTE> tmpSurface;
+		thread_local std::vector<BYTE> tmpSurface;
 		const LONG srcByteWidth = absSrcWidth * bytesPerPixel;
 		if (tmpSurface.size() < absSrcHeight * srcByteWidth)
 		{
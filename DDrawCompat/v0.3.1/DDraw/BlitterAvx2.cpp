@@ -0,0 +1,288 @@
+#define WIN32_LEAN_AND_MEAN
+#define CINTERFACE
+
+#include <type_traits>
+
+#include <immintrin.h>
+
+#include <DDrawCompat/v0.3.1/DDraw/BlitterAvx2.h>
+
+// This file is compiled with /arch:AVX2, so nothing in it may run before the CPU has been checked.
+// Only the kernels returned by getBltFunc are called, and only after Blitter.cpp has detected AVX2.
+// Avoid including headers with inline functions that other files also use, since the linker could
+// pick the AVX2 compiled copy for them.
+
+#pragma warning(disable : 4127)
+
+namespace
+{
+	struct Vec128
+	{
+		typedef __m128i Type;
+		static const int size = 16;
+
+		static Type load(const void* p) { return _mm_loadu_si128(static_cast<const __m128i*>(p)); }
+		static void store(void* p, Type a) { _mm_storeu_si128(static_cast<__m128i*>(p), a); }
+		static Type bitAnd(Type a, Type b) { return _mm_and_si128(a, b); }
+		static Type bitAndNot(Type a, Type b) { return _mm_andnot_si128(a, b); }
+		static Type blend(Type a, Type b, Type mask) { return _mm_blendv_epi8(a, b, mask); }
+
+		template <typename Pixel>
+		static Type set1(DWORD a)
+		{
+			if (1 == sizeof(Pixel)) return _mm_set1_epi8(static_cast<char>(a));
+			if (2 == sizeof(Pixel)) return _mm_set1_epi16(static_cast<short>(a));
+			return _mm_set1_epi32(a);
+		}
+
+		template <typename Pixel>
+		static Type cmpeq(Type a, Type b)
+		{
+			if (1 == sizeof(Pixel)) return _mm_cmpeq_epi8(a, b);
+			if (2 == sizeof(Pixel)) return _mm_cmpeq_epi16(a, b);
+			return _mm_cmpeq_epi32(a, b);
+		}
+
+		template <typename Pixel>
+		static Type reverse(Type a)
+		{
+			if (1 == sizeof(Pixel)) return _mm_shuffle_epi8(a, _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0));
+			if (2 == sizeof(Pixel)) return _mm_shuffle_epi8(a, _mm_setr_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1));
+			return _mm_shuffle_epi32(a, _MM_SHUFFLE(0, 1, 2, 3));
+		}
+
+		static Type gather(const DWORD* src, int offset, int delta)
+		{
+			__m128i offsets = _mm_add_epi32(_mm_set1_epi32(offset),
+				_mm_mullo_epi32(_mm_set1_epi32(delta), _mm_setr_epi32(0, 1, 2, 3)));
+			return _mm_i32gather_epi32(reinterpret_cast<const int*>(src), _mm_srai_epi32(offsets, 16), 4);
+		}
+	};
+
+	struct Vec256
+	{
+		typedef __m256i Type;
+		static const int size = 32;
+
+		static Type load(const void* p) { return _mm256_loadu_si256(static_cast<const __m256i*>(p)); }
+		static void store(void* p, Type a) { _mm256_storeu_si256(static_cast<__m256i*>(p), a); }
+		static Type bitAnd(Type a, Type b) { return _mm256_and_si256(a, b); }
+		static Type bitAndNot(Type a, Type b) { return _mm256_andnot_si256(a, b); }
+		static Type blend(Type a, Type b, Type mask) { return _mm256_blendv_epi8(a, b, mask); }
+
+		template <typename Pixel>
+		static Type set1(DWORD a)
+		{
+			if (1 == sizeof(Pixel)) return _mm256_set1_epi8(static_cast<char>(a));
+			if (2 == sizeof(Pixel)) return _mm256_set1_epi16(static_cast<short>(a));
+			return _mm256_set1_epi32(a);
+		}
+
+		template <typename Pixel>
+		static Type cmpeq(Type a, Type b)
+		{
+			if (1 == sizeof(Pixel)) return _mm256_cmpeq_epi8(a, b);
+			if (2 == sizeof(Pixel)) return _mm256_cmpeq_epi16(a, b);
+			return _mm256_cmpeq_epi32(a, b);
+		}
+
+		template <typename Pixel>
+		static Type reverse(Type a)
+		{
+			if (4 == sizeof(Pixel))
+			{
+				return _mm256_permutevar8x32_epi32(a, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+			}
+
+			// Reverse within each 128-bit lane, then swap the lanes
+			const __m256i mask = _mm256_broadcastsi128_si256(1 == sizeof(Pixel)
+				? _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+				: _mm_setr_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1));
+			return _mm256_permute4x64_epi64(_mm256_shuffle_epi8(a, mask), _MM_SHUFFLE(1, 0, 3, 2));
+		}
+
+		static Type gather(const DWORD* src, int offset, int delta)
+		{
+			__m256i offsets = _mm256_add_epi32(_mm256_set1_epi32(offset),
+				_mm256_mullo_epi32(_mm256_set1_epi32(delta), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)));
+			return _mm256_i32gather_epi32(reinterpret_cast<const int*>(src), _mm256_srai_epi32(offsets, 16), 4);
+		}
+	};
+
+	template <typename Vec, typename Pixel>
+	__forceinline typename Vec::Type compareColorKey(typename Vec::Type vec, typename Vec::Type colorKey)
+	{
+		if (4 == sizeof(Pixel))
+		{
+			vec = Vec::bitAnd(vec, Vec::template set1<Pixel>(0x00FFFFFF));
+		}
+		return Vec::template cmpeq<Pixel>(vec, colorKey);
+	}
+
+	template <typename Vec, typename Pixel, bool useDstColorKey, bool useSrcColorKey>
+	__forceinline typename Vec::Type bltVector(typename Vec::Type dst, typename Vec::Type src,
+		typename Vec::Type dstColorKey, typename Vec::Type srcColorKey)
+	{
+		if (useDstColorKey && useSrcColorKey)
+		{
+			typename Vec::Type mask = Vec::bitAndNot(compareColorKey<Vec, Pixel>(src, srcColorKey),
+				compareColorKey<Vec, Pixel>(dst, dstColorKey));
+			return Vec::blend(dst, src, mask);
+		}
+		else if (useDstColorKey)
+		{
+			return Vec::blend(dst, src, compareColorKey<Vec, Pixel>(dst, dstColorKey));
+		}
+		else if (useSrcColorKey)
+		{
+			return Vec::blend(src, dst, compareColorKey<Vec, Pixel>(src, srcColorKey));
+		}
+		else
+		{
+			return src;
+		}
+	}
+
+	template <typename Vec, typename Pixel, bool stretch, bool mirror, bool useDstColorKey, bool useSrcColorKey>
+	__forceinline void bltVector(Pixel* dst, const Pixel* src, DWORD x, int offset, int delta,
+		typename Vec::Type dstColorKey, typename Vec::Type srcColorKey)
+	{
+		const int pixelsPerVector = Vec::size / sizeof(Pixel);
+
+		typename Vec::Type s;
+		if (stretch)
+		{
+			s = Vec::gather(reinterpret_cast<const DWORD*>(src), offset + static_cast<int>(x) * delta, delta);
+		}
+		else if (mirror)
+		{
+			s = Vec::template reverse<Pixel>(Vec::load(src - x - (pixelsPerVector - 1)));
+		}
+		else
+		{
+			s = Vec::load(src + x);
+		}
+
+		if (useDstColorKey || useSrcColorKey)
+		{
+			s = bltVector<Vec, Pixel, useDstColorKey, useSrcColorKey>(Vec::load(dst + x), s, dstColorKey, srcColorKey);
+		}
+		Vec::store(dst + x, s);
+	}
+
+	// The last vector is aligned to the end of the row and may overlap the previous one,
+	// which is harmless because blitting a pixel a second time gives the same result.
+	template <typename Vec, typename Pixel, bool stretch, bool mirror, bool useDstColorKey, bool useSrcColorKey>
+	__forceinline void bltVectorRow(Pixel* dst, const Pixel* src, DWORD width, int offset, int delta,
+		typename Vec::Type dstColorKey, typename Vec::Type srcColorKey)
+	{
+		const DWORD pixelsPerVector = Vec::size / sizeof(Pixel);
+		const DWORD lastX = width - pixelsPerVector;
+
+		for (DWORD x = 0; x < lastX; x += pixelsPerVector)
+		{
+			bltVector<Vec, Pixel, stretch, mirror, useDstColorKey, useSrcColorKey>(
+				dst, src, x, offset, delta, dstColorKey, srcColorKey);
+		}
+		bltVector<Vec, Pixel, stretch, mirror, useDstColorKey, useSrcColorKey>(
+			dst, src, lastX, offset, delta, dstColorKey, srcColorKey);
+	}
+
+	template <typename Vec, typename Pixel, bool stretch, bool mirror, bool useDstColorKey, bool useSrcColorKey>
+	__forceinline void vectorizedBlt(BYTE* dst, DWORD dstPitch, DWORD dstWidth, DWORD dstHeight,
+		const BYTE* src, DWORD srcPitch, int offsetX, int deltaX, int offsetY, int deltaY,
+		DWORD dstColorKey, DWORD srcColorKey)
+	{
+		const typename Vec::Type dstColorKeyVec = Vec::template set1<Pixel>(dstColorKey);
+		const typename Vec::Type srcColorKeyVec = Vec::template set1<Pixel>(srcColorKey);
+
+		for (DWORD i = dstHeight; i != 0; --i)
+		{
+			bltVectorRow<Vec, Pixel, stretch, mirror, useDstColorKey, useSrcColorKey>(
+				reinterpret_cast<Pixel*>(dst),
+				reinterpret_cast<const Pixel*>(src + (offsetY >> 16) * static_cast<int>(srcPitch)),
+				dstWidth, offsetX, deltaX, dstColorKeyVec, srcColorKeyVec);
+			dst += dstPitch;
+			offsetY += deltaY;
+		}
+	}
+
+	template <typename Pixel, bool stretch, bool mirror, bool useDstColorKey, bool useSrcColorKey>
+	void vectorizedBltFunc(void* dst, DWORD dstPitch, DWORD dstWidth, DWORD dstHeight,
+		const void* src, DWORD srcPitch, int offsetX, int deltaX, int offsetY, int deltaY,
+		DWORD dstColorKey, DWORD srcColorKey)
+	{
+		if (dstWidth * sizeof(Pixel) >= Vec256::size)
+		{
+			vectorizedBlt<Vec256, Pixel, stretch, mirror, useDstColorKey, useSrcColorKey>(
+				static_cast<BYTE*>(dst), dstPitch, dstWidth, dstHeight,
+				static_cast<const BYTE*>(src), srcPitch, offsetX, deltaX, offsetY, deltaY, dstColorKey, srcColorKey);
+		}
+		else
+		{
+			vectorizedBlt<Vec128, Pixel, stretch, mirror, useDstColorKey, useSrcColorKey>(
+				static_cast<BYTE*>(dst), dstPitch, dstWidth, dstHeight,
+				static_cast<const BYTE*>(src), srcPitch, offsetX, deltaX, offsetY, deltaY, dstColorKey, srcColorKey);
+		}
+		_mm256_zeroupper();
+	}
+
+	void vectorizedBltFunc24(void* dst, DWORD dstPitch, DWORD dstWidth, DWORD dstHeight,
+		const void* src, DWORD srcPitch, int offsetX, int deltaX, int offsetY, int deltaY,
+		DWORD dstColorKey, DWORD srcColorKey)
+	{
+		vectorizedBltFunc<BYTE, false, false, false, false>(dst, dstPitch, dstWidth * 3, dstHeight,
+			src, srcPitch, offsetX, deltaX, offsetY, deltaY, dstColorKey, srcColorKey);
+	}
+
+	template <typename Pixel, bool stretch, bool mirror, bool useDstColorKey>
+	DDraw::Blitter::Avx2::BltFunc getBltFunc(bool useSrcColorKey)
+	{
+		return useSrcColorKey
+			? &vectorizedBltFunc<Pixel, stretch, mirror, useDstColorKey, true>
+			: &vectorizedBltFunc<Pixel, stretch, mirror, useDstColorKey, false>;
+	}
+
+	template <typename Pixel, bool stretch, bool mirror>
+	DDraw::Blitter::Avx2::BltFunc getBltFunc(bool useDstColorKey, bool useSrcColorKey)
+	{
+		return useDstColorKey
+			? getBltFunc<Pixel, stretch, mirror, true>(useSrcColorKey)
+			: getBltFunc<Pixel, stretch, mirror, false>(useSrcColorKey);
+	}
+
+	template <typename Pixel, bool stretch>
+	DDraw::Blitter::Avx2::BltFunc getBltFunc(bool mirror, bool useDstColorKey, bool useSrcColorKey)
+	{
+		return mirror
+			? getBltFunc<Pixel, stretch, true>(useDstColorKey, useSrcColorKey)
+			: getBltFunc<Pixel, stretch, false>(useDstColorKey, useSrcColorKey);
+	}
+}
+
+namespace DDraw
+{
+	namespace Blitter
+	{
+		namespace Avx2
+		{
+			BltFunc getBltFunc(DWORD bytesPerPixel, bool stretch, bool mirror, bool useDstColorKey, bool useSrcColorKey)
+			{
+				// Stretching gathers whole dwords, which would read past the end of the source row for smaller pixels
+				if (stretch)
+				{
+					return 4 == bytesPerPixel ? ::getBltFunc<DWORD, true>(mirror, useDstColorKey, useSrcColorKey) : nullptr;
+				}
+
+				switch (bytesPerPixel)
+				{
+				case 1: return ::getBltFunc<BYTE, false>(mirror, useDstColorKey, useSrcColorKey);
+				case 2: return ::getBltFunc<WORD, false>(mirror, useDstColorKey, useSrcColorKey);
+				case 3: return (mirror || useDstColorKey || useSrcColorKey) ? nullptr : &vectorizedBltFunc24;
+				case 4: return ::getBltFunc<DWORD, false>(mirror, useDstColorKey, useSrcColorKey);
+				}
+				return nullptr;
+			}
+		}
+	}
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+// Only BlitterAvx2Bench builds the kernels outside Windows
+#include <cstdint>
+typedef uint8_t BYTE;
+typedef uint16_t WORD;
+typedef uint32_t DWORD;
+#define __forceinline inline __attribute__((always_inline))
+#endif
+
+namespace DDraw
+{
+	namespace Blitter
+	{
+		namespace Avx2
+		{
+			typedef void(*BltFunc)(void* dst, DWORD dstPitch, DWORD dstWidth, DWORD dstHeight,
+				const void* src, DWORD srcPitch, int offsetX, int deltaX, int offsetY, int deltaY,
+				DWORD dstColorKey, DWORD srcColorKey);
+
+			// Returns nullptr for the combinations that have no AVX2 kernel.
+			// The returned kernels require a destination row of at least 16 bytes.
+			BltFunc getBltFunc(DWORD bytesPerPixel, bool stretch, bool mirror, bool useDstColorKey, bool useSrcColorKey);
+		}
+	}
+}
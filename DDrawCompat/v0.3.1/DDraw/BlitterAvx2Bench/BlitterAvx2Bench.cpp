@@ -0,0 +1,320 @@
+// Checks the AVX2 blit kernels in BlitterAvx2.cpp against a scalar reference and times both for every
+// kernel getBltFunc returns, at several row widths. Blitter.cpp sets up the offsets and deltas the same
+// way before it calls a kernel. BlitterAvx2.cpp must be the only file built for AVX2, from this folder:
+//   g++ -std=c++17 -O2 -mavx2 -I../../../.. -c ../BlitterAvx2.cpp
+//   g++ -std=c++17 -O2 -fno-tree-vectorize -I../../../.. -o blitteravx2bench BlitterAvx2Bench.cpp BlitterAvx2.o
+//   cl /std:c++17 /EHsc /O2 /arch:AVX2 /I..\..\..\.. /c ..\BlitterAvx2.cpp
+//   cl /std:c++17 /EHsc /O2 /I..\..\..\.. BlitterAvx2Bench.cpp BlitterAvx2.obj
+//
+// Usage: blitteravx2bench [megapixels per measurement]
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#include <DDrawCompat/v0.3.1/DDraw/BlitterAvx2.h>
+
+using DDraw::Blitter::Avx2::BltFunc;
+
+namespace
+{
+	const DWORD g_widths[] = { 16, 40, 256, 1920 };
+
+	bool isAvx2Supported()
+	{
+#ifdef _MSC_VER
+		int cpuInfo[4] = {};
+		__cpuid(cpuInfo, 0);
+		if (cpuInfo[0] < 7)
+		{
+			return false;
+		}
+		__cpuid(cpuInfo, 1);
+		const int osxsaveAndAvx = (1 << 27) | (1 << 28);
+		if ((cpuInfo[2] & osxsaveAndAvx) != osxsaveAndAvx || (_xgetbv(0) & 6) != 6)
+		{
+			return false;
+		}
+		__cpuidex(cpuInfo, 7, 0);
+		return 0 != (cpuInfo[1] & (1 << 5));
+#else
+		return __builtin_cpu_supports("avx2");
+#endif
+	}
+
+	template <typename Pixel>
+	bool isColorKey(Pixel pixel, DWORD colorKey)
+	{
+		return 4 == sizeof(Pixel)
+			? (pixel & 0x00FFFFFF) == colorKey
+			: pixel == static_cast<Pixel>(colorKey);
+	}
+
+	// One pixel at a time, the result every kernel has to match
+	template <typename Pixel, bool stretch, bool mirror, bool useDstColorKey, bool useSrcColorKey>
+	void scalarBltFunc(void* dst, DWORD dstPitch, DWORD dstWidth, DWORD dstHeight,
+		const void* src, DWORD srcPitch, int offsetX, int deltaX, int offsetY, int deltaY,
+		DWORD dstColorKey, DWORD srcColorKey)
+	{
+		for (DWORD y = 0; y < dstHeight; ++y)
+		{
+			Pixel* d = reinterpret_cast<Pixel*>(static_cast<BYTE*>(dst) + y * dstPitch);
+			const Pixel* s = reinterpret_cast<const Pixel*>(static_cast<const BYTE*>(src) + (offsetY >> 16) * static_cast<int>(srcPitch));
+			for (DWORD x = 0; x < dstWidth; ++x)
+			{
+				const Pixel sp = stretch ? s[(offsetX + static_cast<int>(x) * deltaX) >> 16] : mirror ? *(s - x) : s[x];
+				if ((!useDstColorKey || isColorKey(d[x], dstColorKey)) &&
+					(!useSrcColorKey || !isColorKey(sp, srcColorKey)))
+				{
+					d[x] = sp;
+				}
+			}
+			offsetY += deltaY;
+		}
+	}
+
+	void scalarBltFunc24(void* dst, DWORD dstPitch, DWORD dstWidth, DWORD dstHeight,
+		const void* src, DWORD srcPitch, int offsetX, int deltaX, int offsetY, int deltaY,
+		DWORD dstColorKey, DWORD srcColorKey)
+	{
+		scalarBltFunc<BYTE, false, false, false, false>(dst, dstPitch, dstWidth * 3, dstHeight,
+			src, srcPitch, offsetX, deltaX, offsetY, deltaY, dstColorKey, srcColorKey);
+	}
+
+	template <typename Pixel, bool stretch, bool mirror>
+	BltFunc getScalarBltFunc(bool useDstColorKey, bool useSrcColorKey)
+	{
+		if (useDstColorKey)
+		{
+			return useSrcColorKey ? &scalarBltFunc<Pixel, stretch, mirror, true, true> : &scalarBltFunc<Pixel, stretch, mirror, true, false>;
+		}
+		return useSrcColorKey ? &scalarBltFunc<Pixel, stretch, mirror, false, true> : &scalarBltFunc<Pixel, stretch, mirror, false, false>;
+	}
+
+	template <typename Pixel>
+	BltFunc getScalarBltFunc(bool stretch, bool mirror, bool useDstColorKey, bool useSrcColorKey)
+	{
+		if (stretch)
+		{
+			return mirror ? getScalarBltFunc<Pixel, true, true>(useDstColorKey, useSrcColorKey)
+				: getScalarBltFunc<Pixel, true, false>(useDstColorKey, useSrcColorKey);
+		}
+		return mirror ? getScalarBltFunc<Pixel, false, true>(useDstColorKey, useSrcColorKey)
+			: getScalarBltFunc<Pixel, false, false>(useDstColorKey, useSrcColorKey);
+	}
+
+	BltFunc getScalarBltFunc(DWORD bytesPerPixel, bool stretch, bool mirror, bool useDstColorKey, bool useSrcColorKey)
+	{
+		switch (bytesPerPixel)
+		{
+		case 1: return getScalarBltFunc<BYTE>(stretch, mirror, useDstColorKey, useSrcColorKey);
+		case 2: return getScalarBltFunc<WORD>(stretch, mirror, useDstColorKey, useSrcColorKey);
+		case 3: return &scalarBltFunc24;
+		case 4: return getScalarBltFunc<DWORD>(stretch, mirror, useDstColorKey, useSrcColorKey);
+		}
+		return nullptr;
+	}
+
+	struct Kernel
+	{
+		DWORD bytesPerPixel;
+		bool stretch;
+		bool mirror;
+		bool useDstColorKey;
+		bool useSrcColorKey;
+		BltFunc scalar;
+		BltFunc avx2;
+	};
+
+	std::vector<Kernel> getKernels()
+	{
+		std::vector<Kernel> kernels;
+		for (DWORD bytesPerPixel = 1; bytesPerPixel <= 4; ++bytesPerPixel)
+		{
+			for (int flags = 0; flags < 16; ++flags)
+			{
+				Kernel k = { bytesPerPixel, 0 != (flags & 8), 0 != (flags & 4), 0 != (flags & 2), 0 != (flags & 1) };
+				k.avx2 = DDraw::Blitter::Avx2::getBltFunc(bytesPerPixel, k.stretch, k.mirror, k.useDstColorKey, k.useSrcColorKey);
+				if (k.avx2)
+				{
+					k.scalar = getScalarBltFunc(bytesPerPixel, k.stretch, k.mirror, k.useDstColorKey, k.useSrcColorKey);
+					kernels.push_back(k);
+				}
+			}
+		}
+		return kernels;
+	}
+
+	// Source and destination surfaces for one blit, with the kernel arguments set up like Blitter.cpp does
+	struct Blit
+	{
+		static const DWORD padding = 64;
+
+		DWORD dstWidth, dstHeight, dstPitch;
+		DWORD srcPitch;
+		std::vector<BYTE> src, dst;
+		const BYTE* srcStart;
+		int offsetX, deltaX, offsetY, deltaY;
+		DWORD dstColorKey, srcColorKey;
+
+		Blit(const Kernel& k, DWORD width, DWORD height, DWORD srcWidth, DWORD srcHeight, bool mirrorUpDown, std::mt19937& rng)
+			: dstWidth(width), dstHeight(height)
+		{
+			dstPitch = width * k.bytesPerPixel + padding;
+			srcPitch = srcWidth * k.bytesPerPixel + padding;
+			dst.resize(dstPitch * (height + 2));
+			src.resize(srcPitch * (srcHeight + 2));
+
+			// Few distinct values, so both color keys match often. The top byte of 32-bit pixels is ignored by the keys.
+			dstColorKey = rng() & 0x00FFFFFF;
+			srcColorKey = rng() & 0x00FFFFFF;
+			fill(dst, k.bytesPerPixel, dstColorKey, rng);
+			fill(src, k.bytesPerPixel, srcColorKey, rng);
+
+			deltaX = (srcWidth << 16) / width;
+			deltaY = (srcHeight << 16) / height;
+			offsetX = deltaX / 2;
+			offsetY = deltaY / 2;
+			if (k.mirror)
+			{
+				offsetX += static_cast<int>(width - 1) * deltaX;
+				deltaX = -deltaX;
+			}
+			if (mirrorUpDown)
+			{
+				offsetY += static_cast<int>(height - 1) * deltaY;
+				deltaY = -deltaY;
+			}
+
+			srcStart = src.data() + srcPitch + padding / 2 + (offsetY >> 16) * srcPitch + (offsetX >> 16) * k.bytesPerPixel;
+			offsetX &= 0x0000FFFF;
+			offsetY &= 0x0000FFFF;
+		}
+
+		static void fill(std::vector<BYTE>& buffer, DWORD bytesPerPixel, DWORD colorKey, std::mt19937& rng)
+		{
+			const DWORD values[] = { colorKey, colorKey | 0xFF000000, static_cast<DWORD>(rng()), static_cast<DWORD>(rng()) };
+			for (std::size_t i = 0; i + bytesPerPixel <= buffer.size(); i += bytesPerPixel)
+			{
+				const DWORD value = values[rng() % 4];
+				std::memcpy(&buffer[i], &value, bytesPerPixel);
+			}
+		}
+
+		BYTE* dstStart()
+		{
+			return dst.data() + dstPitch + padding / 2;
+		}
+
+		void run(BltFunc func)
+		{
+			func(dstStart(), dstPitch, dstWidth, dstHeight, srcStart, srcPitch,
+				offsetX, deltaX, offsetY, deltaY, dstColorKey, srcColorKey);
+		}
+	};
+
+	// Runs both kernels on the same input and compares the whole destination, padding included
+	bool check(const Kernel& k, DWORD width, DWORD height, DWORD srcWidth, DWORD srcHeight, bool mirrorUpDown, std::mt19937& rng)
+	{
+		Blit scalar(k, width, height, srcWidth, srcHeight, mirrorUpDown, rng);
+		Blit avx2 = scalar;
+		avx2.srcStart = avx2.src.data() + (scalar.srcStart - scalar.src.data());
+
+		scalar.run(k.scalar);
+		avx2.run(k.avx2);
+		if (scalar.dst != avx2.dst)
+		{
+			std::printf("FAILED %u bpp, stretch %d, mirror %d/%d, dst key %d, src key %d, %ux%u from %ux%u\n",
+				k.bytesPerPixel, k.stretch, k.mirror, mirrorUpDown, k.useDstColorKey, k.useSrcColorKey,
+				width, height, srcWidth, srcHeight);
+			return false;
+		}
+		return true;
+	}
+
+	double timeNsPerPixel(Blit& blit, BltFunc func, double megapixels)
+	{
+		const std::size_t pixels = blit.dstWidth * blit.dstHeight;
+		const std::size_t passes = static_cast<std::size_t>(std::ceil(megapixels * 1000000 / pixels));
+		blit.run(func);
+		const auto start = std::chrono::steady_clock::now();
+		for (std::size_t i = 0; i < passes; ++i)
+		{
+			blit.run(func);
+		}
+		const auto end = std::chrono::steady_clock::now();
+		return std::chrono::duration<double, std::nano>(end - start).count() / (passes * pixels);
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	if (!isAvx2Supported())
+	{
+		std::printf("This CPU does not support AVX2\n");
+		return 1;
+	}
+
+	const double megapixels = argc > 1 ? std::atof(argv[1]) : 8;
+	const std::vector<Kernel> kernels = getKernels();
+	std::mt19937 rng(1);
+
+	// Random sizes and stretch factors, down to the 16 byte minimum row the kernels accept
+	const int fuzzCount = 3000;
+	for (int i = 0; i < fuzzCount; ++i)
+	{
+		const Kernel& k = kernels[rng() % kernels.size()];
+		const DWORD minWidth = (16 + k.bytesPerPixel - 1) / k.bytesPerPixel;
+		const DWORD width = minWidth + rng() % 200;
+		const DWORD height = 1 + rng() % 8;
+		const DWORD srcWidth = k.stretch ? 1 + rng() % (2 * width) : width;
+		const DWORD srcHeight = 1 + rng() % (2 * height);
+		if (!check(k, width, height, srcWidth, k.stretch ? srcHeight : height, 0 != (rng() & 1), rng))
+		{
+			return 1;
+		}
+	}
+	std::printf("%d random blits match the scalar kernels\n\n", fuzzCount);
+
+	std::printf("bpp stretch mirror dstkey srckey  speedup at width");
+	for (DWORD width : g_widths)
+	{
+		std::printf(" %6u", width);
+	}
+	std::printf("   ns/pixel scalar -> avx2 at %u\n", g_widths[sizeof(g_widths) / sizeof(g_widths[0]) - 1]);
+
+	double logSpeedupSum = 0;
+	int measurements = 0;
+	for (const Kernel& k : kernels)
+	{
+		std::printf("%3u %7d %6d %6d %6d %16s", k.bytesPerPixel, k.stretch, k.mirror, k.useDstColorKey, k.useSrcColorKey, "");
+		double scalarNs = 0, avx2Ns = 0;
+		for (DWORD width : g_widths)
+		{
+			const DWORD height = std::max<DWORD>(1, 256 * 1024 / width);
+			const DWORD srcWidth = k.stretch ? width * 3 / 4 : width;
+			if (!check(k, width, height, srcWidth, height, false, rng))
+			{
+				return 1;
+			}
+
+			Blit blit(k, width, height, srcWidth, height, false, rng);
+			scalarNs = timeNsPerPixel(blit, k.scalar, megapixels);
+			avx2Ns = timeNsPerPixel(blit, k.avx2, megapixels);
+			std::printf(" %5.1fx", scalarNs / avx2Ns);
+			logSpeedupSum += std::log(scalarNs / avx2Ns);
+			++measurements;
+		}
+		std::printf("   %6.3f -> %6.3f\n", scalarNs, avx2Ns);
+	}
+	std::printf("\nGeometric mean speedup over %d kernels and widths: %.1fx\n", measurements, std::exp(logSpeedupSum / measurements));
+	return 0;
+}
@@ -0,0 +1,186 @@
+// Multi-threaded contention benchmark for the overlapping blits in Blitter.cpp. Every thread scrolls its own
+// surface onto itself, once through a global lock like the removed g_overlappingBltCs and once through the
+// per-thread buffers doOverlappingBlt uses now. It also checks that concurrent overlapping blits give the
+// same result as blitting from a separate copy of the source. Build from this folder:
+//   cl /std:c++17 /EHsc /O2 /arch:AVX2 /I..\..\..\.. /c ..\BlitterAvx2.cpp
+//   cl /std:c++17 /EHsc /O2 /I..\..\..\.. BlitterOverlapBench.cpp ..\Blitter.cpp BlitterAvx2.obj user32.lib
+//
+// Usage: blitteroverlapbench [blits per thread] [max threads]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <DDrawCompat/v0.3.1/DDraw/Blitter.h>
+
+namespace
+{
+	const DWORD g_bytesPerPixel = 4;
+	const DWORD g_surfaceWidth = 800;
+	const DWORD g_surfaceHeight = 600;
+	const DWORD g_pitch = g_surfaceWidth * g_bytesPerPixel;
+	const DWORD g_colorKey = 0x00FF00FF;
+	const int g_checkedBlits = 20;
+
+	struct OverlapCase
+	{
+		const char* name;
+		DWORD dstX, dstY, dstWidth, dstHeight;
+		LONG srcWidth, srcHeight;
+		bool useSrcColorKey;
+	};
+
+	// The first case takes the row buffer, the others copy the whole source to the scratch surface first
+	const OverlapCase g_cases[] = {
+		{ "keyed scroll", 0, 8, 640, 480, 640, 480, true },
+		{ "mirrored scroll", 8, 8, 640, 480, -640, 480, false },
+		{ "stretched", 8, 8, 640, 480, 480, 360, false }
+	};
+
+	std::mutex g_globalLock;
+
+	std::vector<BYTE> createSurface()
+	{
+		std::vector<BYTE> surface(g_pitch * g_surfaceHeight);
+		DWORD* pixels = reinterpret_cast<DWORD*>(surface.data());
+		for (DWORD i = 0; i < g_surfaceWidth * g_surfaceHeight; ++i)
+		{
+			// Every seventh pixel is the color key
+			pixels[i] = 0 == i % 7 ? g_colorKey : i * 2654435761u;
+		}
+		return surface;
+	}
+
+	void bltOverlapping(const OverlapCase& c, std::vector<BYTE>& surface)
+	{
+		DDraw::Blitter::blt(surface.data() + c.dstY * g_pitch + c.dstX * g_bytesPerPixel, g_pitch, c.dstWidth, c.dstHeight,
+			surface.data(), g_pitch, c.srcWidth, c.srcHeight,
+			g_bytesPerPixel, nullptr, c.useSrcColorKey ? &g_colorKey : nullptr);
+	}
+
+	// What the overlapping blit has to produce: the same blit from an unmodified copy of the source
+	std::vector<BYTE> getExpectedSurface(const OverlapCase& c, const std::vector<BYTE>& surface)
+	{
+		std::vector<BYTE> src(surface);
+		std::vector<BYTE> expected(surface);
+		DDraw::Blitter::blt(expected.data() + c.dstY * g_pitch + c.dstX * g_bytesPerPixel, g_pitch, c.dstWidth, c.dstHeight,
+			src.data(), g_pitch, c.srcWidth, c.srcHeight,
+			g_bytesPerPixel, nullptr, c.useSrcColorKey ? &g_colorKey : nullptr);
+		return expected;
+	}
+
+	template <typename Func>
+	double runThreads(int threadCount, Func func)
+	{
+		std::vector<std::thread> threads;
+		std::atomic<int> ready(0);
+		std::atomic<bool> go(false);
+		for (int i = 0; i < threadCount; ++i)
+		{
+			threads.emplace_back([&]()
+				{
+					++ready;
+					while (!go)
+					{
+						std::this_thread::yield();
+					}
+					func();
+				});
+		}
+
+		while (ready != threadCount)
+		{
+			std::this_thread::yield();
+		}
+		const auto start = std::chrono::steady_clock::now();
+		go = true;
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	double timeBlits(const OverlapCase& c, int threadCount, int blitsPerThread, bool useGlobalLock)
+	{
+		return runThreads(threadCount, [&]()
+			{
+				std::vector<BYTE> surface(createSurface());
+				for (int i = 0; i < blitsPerThread; ++i)
+				{
+					if (useGlobalLock)
+					{
+						std::lock_guard<std::mutex> lock(g_globalLock);
+						bltOverlapping(c, surface);
+					}
+					else
+					{
+						bltOverlapping(c, surface);
+					}
+				}
+			});
+	}
+
+	bool checkConcurrentBlits(const OverlapCase& c, int threadCount, const std::vector<BYTE>& expected)
+	{
+		std::atomic<int> mismatches(0);
+		runThreads(threadCount, [&]()
+			{
+				const std::vector<BYTE> initial(createSurface());
+				std::vector<BYTE> surface(initial.size());
+				for (int i = 0; i < g_checkedBlits; ++i)
+				{
+					std::memcpy(surface.data(), initial.data(), initial.size());
+					bltOverlapping(c, surface);
+					if (surface != expected)
+					{
+						++mismatches;
+					}
+				}
+			});
+
+		if (0 != mismatches)
+		{
+			std::printf("FAILED %s with %d threads: %d of %d blits differ from the non-overlapping blit\n",
+				c.name, threadCount, mismatches.load(), threadCount * g_checkedBlits);
+			return false;
+		}
+		return true;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	const int blitsPerThread = argc > 1 ? std::atoi(argv[1]) : 200;
+	const int maxThreads = argc > 2 ? std::atoi(argv[2]) : std::max(8, static_cast<int>(std::thread::hardware_concurrency()));
+
+	std::printf("%u logical processors, %d blits of %ux%u at %u bpp per thread\n\n",
+		std::thread::hardware_concurrency(), blitsPerThread, g_cases[0].dstWidth, g_cases[0].dstHeight, g_bytesPerPixel * 8);
+	std::printf("%-16s %7s %20s %20s %8s\n", "case", "threads", "global lock blits/s", "per-thread blits/s", "speedup");
+
+	for (const OverlapCase& c : g_cases)
+	{
+		const std::vector<BYTE> expected(getExpectedSurface(c, createSurface()));
+		for (int threadCount = 1; threadCount <= maxThreads; threadCount *= 2)
+		{
+			if (!checkConcurrentBlits(c, threadCount, expected))
+			{
+				return 1;
+			}
+
+			const double lockedSeconds = timeBlits(c, threadCount, blitsPerThread, true);
+			const double unlockedSeconds = timeBlits(c, threadCount, blitsPerThread, false);
+			const double blits = static_cast<double>(threadCount) * blitsPerThread;
+			std::printf("%-16s %7d %20.0f %20.0f %7.2fx\n", c.name, threadCount,
+				blits / lockedSeconds, blits / unlockedSeconds, lockedSeconds / unlockedSeconds);
+		}
+	}
+	std::printf("\nConcurrent overlapping blits match the non-overlapping blit in every case\n");
+	return 0;
+}
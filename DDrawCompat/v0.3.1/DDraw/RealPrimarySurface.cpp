@@ -163,6 +163,10 @@ namespace
 
 		if (!g_frontBuffer || !src || DDraw::RealPrimarySurface::isLost())
 		{
+			if (g_frontBuffer)
+			{
+				Gdi::VirtualScreen::addDirtyRegion(D3dDdi::KernelModeThunks::getMonitorRect());
+			}
 			Gdi::Window::present(nullptr);
 			return;
 		}
@@ -196,6 +200,7 @@ namespace
 		{
 			g_frontBuffer->Flip(g_frontBuffer, getBackBuffer(), DDFLIP_WAIT);
 		}
+		D3dDdi::KernelModeThunks::notifyPresent();
 		g_presentEndVsyncCount = D3dDdi::KernelModeThunks::getVsyncCounter() + max(flipInterval, 1);
 	}
 
@@ -98,6 +98,7 @@ namespace DDraw
 		if (SUCCEEDED(result))
 		{
 			bltToGdi(This, lpDestRect, lpDDSrcSurface, lpSrcRect, dwFlags, lpDDBltFx);
+			Gdi::VirtualScreen::setDirty();
 			RealPrimarySurface::update();
 		}
 		return result;
@@ -115,6 +116,7 @@ namespace DDraw
 		HRESULT result = SurfaceImpl::BltFast(This, dwX, dwY, lpDDSrcSurface, lpSrcRect, dwTrans);
 		if (SUCCEEDED(result))
 		{
+			Gdi::VirtualScreen::setDirty();
 			RealPrimarySurface::update();
 		}
 		return result;
@@ -148,6 +150,7 @@ namespace DDraw
 		}
 
 		PrimarySurface::updateFrontResource();
+		Gdi::VirtualScreen::setDirty();
 		return RealPrimarySurface::flip(surfaceTargetOverride, dwFlags);
 	}
 
@@ -198,6 +201,7 @@ namespace DDraw
 		if (SUCCEEDED(result))
 		{
 			restorePrimaryCaps(lpDDSurfaceDesc->ddsCaps.dwCaps);
+			Gdi::VirtualScreen::setDirty();
 		}
 		return result;
 	}
@@ -208,6 +212,7 @@ namespace DDraw
 		HRESULT result = SurfaceImpl::ReleaseDC(This, hDC);
 		if (SUCCEEDED(result))
 		{
+			Gdi::VirtualScreen::setDirty();
 			RealPrimarySurface::update();
 		}
 		return result;
@@ -251,6 +256,7 @@ namespace DDraw
 		HRESULT result = SurfaceImpl::Unlock(This, lpRect);
 		if (SUCCEEDED(result))
 		{
+			Gdi::VirtualScreen::setDirty();
 			RealPrimarySurface::update();
 		}
 		return result;
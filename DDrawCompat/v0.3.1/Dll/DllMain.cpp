@@ -24,6 +24,7 @@
 #include <DDrawCompat/v0.3.1/Common/Path.h>
 #include <DDrawCompat/v0.3.1/Common/Time.h>
 #include <DDrawCompat/v0.3.1/D3dDdi/Hooks.h>
+#include <DDrawCompat/v0.3.1/D3dDdi/Resource.h>
 #include <DDrawCompat/v0.3.1/DDraw/DirectDraw.h>
 #include <DDrawCompat/v0.3.1/DDraw/Hooks.h>
 #include <DDrawCompat/v0.3.1/Direct3d/Hooks.h>
@@ -31,6 +32,7 @@
 #include <DDrawCompat/v0.3.1/Gdi/Gdi.h>
 #include <DDrawCompat/v0.3.1/Gdi/PresentationWindow.h>
 #include <DDrawCompat/v0.3.1/Gdi/VirtualScreen.h>
+#include <DDrawCompat/v0.3.1/Gdi/Window.h>
 #include <DDrawCompat/v0.3.1/Win32/DisplayMode.h>
 #include <DDrawCompat/v0.3.1/Win32/MemoryManagement.h>
 #include <DDrawCompat/v0.3.1/Win32/MsgHooks.h>
@@ -72,6 +74,7 @@ namespace Compat31
 			static bool isAlreadyInstalled = false;
 			if (!isAlreadyInstalled)
 			{
+				const auto qpcStart = Time::queryPerformanceCounter();
 				//********** Begin Edit *************
 				if (!Config.Dd7to9)
 				{
@@ -83,6 +86,9 @@ namespace Compat31
 				//********** End Edit ***************
 				Compat31::Log() << "Installing Direct3D driver hooks";
 				D3dDdi::installHooks();
+				//********** Begin Edit *************
+				D3dDdi::Resource::setCopyBudget(Config.DDrawCompatCopyBudget ? Config.DDrawCompatCopyBudget * 1024ull * 1024 : ~0ull);
+				//********** End Edit ***************
 				Compat31::Log() << "Installing Win32 hooks";
 				Win32::WaitFunctions::installHooks();
 
@@ -127,12 +133,12 @@ namespace Compat31
 					Gdi::installHooks();
 				}
 				//********** End Edit ***************
-				Compat31::closeDbgEng();
 				if (!Config.Dd7to9)
 				{
 					Gdi::PresentationWindow::startThread();
 				}
-				Compat31::Log() << "Finished installing hooks";
+				Compat31::Log() << "Finished installing hooks in "
+					<< Time::qpcToMs(Time::queryPerformanceCounter() - qpcStart) << " ms";
 				isAlreadyInstalled = true;
 			}
 		}
@@ -300,7 +306,6 @@ namespace Compat31
 			Win32::MemoryManagement::installHooks();
 			Win32::MsgHooks::installHooks();
 			Time::init();
-			Compat31::closeDbgEng();
 
 			//********** Begin Edit *************
 			if (Config.DisableMaxWindowedModeNotSet)
@@ -313,6 +318,7 @@ namespace Compat31
 		}
 		else if (fdwReason == DLL_PROCESS_DETACH)
 		{
+			Gdi::Window::logPresentStats();
 			Compat31::Log() << "DDrawCompat detached successfully";
 		}
 		else if (fdwReason == DLL_THREAD_DETACH)
@@ -1,6 +1,8 @@
 #define WIN32_LEAN_AND_MEAN
 #define CINTERFACE
 
+#include <algorithm>
+
 #include <DDrawCompat/v0.3.1/D3dDdi/Device.h>
 #include <DDrawCompat/v0.3.1/D3dDdi/Resource.h>
 #include <DDrawCompat/v0.3.1/D3dDdi/ScopedCriticalSection.h>
@@ -8,6 +10,46 @@
 #include <DDrawCompat/v0.3.1/DDraw/Surfaces/PrimarySurface.h>
 #include <DDrawCompat/v0.3.1/Gdi/CompatDc.h>
 #include <DDrawCompat/v0.3.1/Gdi/Dc.h>
+#include <DDrawCompat/v0.3.1/Gdi/Region.h>
+#include <DDrawCompat/v0.3.1/Gdi/VirtualScreen.h>
+
+namespace
+{
+	const int APIRGN = 3;
+
+	void addDirtyRegion(HDC compatDc)
+	{
+		Gdi::Region dirtyRegion;
+		if (1 != GetRandomRgn(compatDc, dirtyRegion, APIRGN))
+		{
+			dirtyRegion = Gdi::VirtualScreen::getRegion();
+			const RECT bounds = Gdi::VirtualScreen::getBounds();
+			dirtyRegion.offset(-bounds.left, -bounds.top);
+		}
+
+		// Bounds are returned in logical coordinates, which can't be mapped back with a world transform
+		RECT boundsRect = {};
+		const UINT boundsFlags = GetBoundsRect(compatDc, &boundsRect, DCB_RESET);
+		SetBoundsRect(compatDc, nullptr, DCB_DISABLE);
+		if ((boundsFlags & DCB_SET) && !(boundsFlags & DCB_DISABLE) && GM_ADVANCED != GetGraphicsMode(compatDc))
+		{
+			LPtoDP(compatDc, reinterpret_cast<POINT*>(&boundsRect), 2);
+			RECT deviceRect = {
+				std::min<LONG>(boundsRect.left, boundsRect.right) - 1,
+				std::min<LONG>(boundsRect.top, boundsRect.bottom) - 1,
+				std::max<LONG>(boundsRect.left, boundsRect.right) + 1,
+				std::max<LONG>(boundsRect.top, boundsRect.bottom) + 1 };
+			dirtyRegion &= deviceRect;
+		}
+
+		if (!dirtyRegion.isEmpty())
+		{
+			const RECT bounds = Gdi::VirtualScreen::getBounds();
+			dirtyRegion.offset(bounds.left, bounds.top);
+			Gdi::VirtualScreen::addDirtyRegion(dirtyRegion);
+		}
+	}
+}
 
 namespace Gdi
 {
@@ -24,6 +66,10 @@ namespace Gdi
 			{
 				gdiResource->prepareForGdiRendering(isReadOnly);
 			}
+			if (!isReadOnly)
+			{
+				SetBoundsRect(m_compatDc, nullptr, DCB_RESET | DCB_ENABLE);
+			}
 		}
 		else
 		{
@@ -37,6 +83,10 @@ namespace Gdi
 		{
 			D3dDdi::ScopedCriticalSection lock;
 			auto gdiResource = D3dDdi::Device::getGdiResource();
+			if (!m_isReadOnly)
+			{
+				addDirtyRegion(m_compatDc);
+			}
 			if (!m_isReadOnly && (!gdiResource || DDraw::PrimarySurface::getFrontResource() == *gdiResource))
 			{
 				DDraw::RealPrimarySurface::scheduleUpdate();
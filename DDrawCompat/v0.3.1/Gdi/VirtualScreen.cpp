@@ -26,6 +26,7 @@ namespace
 
 	Compat31::CriticalSection g_cs;
 	Gdi::Region g_region;
+	Gdi::Region g_dirtyRegion;
 	RECT g_bounds = {};
 	DWORD g_bpp = 0;
 	LONG g_width = 0;
@@ -100,6 +101,12 @@ namespace Gdi
 {
 	namespace VirtualScreen
 	{
+		void addDirtyRegion(const Region& region)
+		{
+			Compat31::ScopedCriticalSection lock(g_cs);
+			g_dirtyRegion |= region;
+		}
+
 		HDC createDc(bool useDefaultPalette)
 		{
 			Compat31::ScopedCriticalSection lock(g_cs);
@@ -229,6 +236,21 @@ namespace Gdi
 			update();
 		}
 
+		void setDirty()
+		{
+			Compat31::ScopedCriticalSection lock(g_cs);
+			g_dirtyRegion = g_region;
+		}
+
+		Region takeDirtyRegion()
+		{
+			Compat31::ScopedCriticalSection lock(g_cs);
+			Region dirtyRegion;
+			swap(dirtyRegion, g_dirtyRegion);
+			dirtyRegion &= g_region;
+			return dirtyRegion;
+		}
+
 		bool update()
 		{
 			LOG_FUNC("VirtualScreen::update");
@@ -253,6 +275,7 @@ namespace Gdi
 				g_region = Region();
 				EnumDisplayMonitors(nullptr, nullptr, addMonitorRectToRegion, reinterpret_cast<LPARAM>(&g_region));
 				GetRgnBox(g_region, &g_bounds);
+				g_dirtyRegion = g_region;
 
 				g_bpp = Win32::DisplayMode::getBpp();
 				g_width = g_bounds.right - g_bounds.left;
@@ -297,6 +320,7 @@ namespace Gdi
 			if (0 != memcmp(g_systemPalette, systemPalette, sizeof(systemPalette)))
 			{
 				memcpy(g_systemPalette, systemPalette, sizeof(systemPalette));
+				g_dirtyRegion = g_region;
 				for (auto& dc : g_dcs)
 				{
 					if (!dc.second.useDefaultPalette)
@@ -10,6 +10,7 @@ namespace Gdi
 
 	namespace VirtualScreen
 	{
+		void addDirtyRegion(const Region& region);
 		HDC createDc(bool useDefaultPalette);
 		HBITMAP createDib(bool useDefaultPalette);
 		HBITMAP createOffScreenDib(LONG width, LONG height, bool useDefaultPalette);
@@ -21,6 +22,9 @@ namespace Gdi
 		DDSURFACEDESC2 getSurfaceDesc(const RECT& rect);
 
 		void init();
+		// For writes to the primary, which shares the virtual screen memory but does not go through a compat DC
+		void setDirty();
+		Region takeDirtyRegion();
 		bool update();
 		void updatePalette(PALETTEENTRY(&palette)[256]);
 	}
@@ -57,6 +57,18 @@ namespace
 
 	std::map<HWND, Window> g_windows;
 	std::vector<Window*> g_windowZOrder;
+	Gdi::Region g_lastExcludeRegion;
+
+	struct PresentStats
+	{
+		DWORD presents;
+		ULONGLONG presentedPixels;
+		ULONGLONG totalPixels;
+		ULONGLONG lastLoggedPixels;
+		DWORD lastLogTime;
+	};
+
+	PresentStats g_presentStats = {};
 
 	std::map<HWND, Window>::iterator addWindow(HWND hwnd)
 	{
@@ -90,6 +102,35 @@ namespace
 		return true;
 	}
 
+	// Called under the D3dDdi critical section, so the region data buffer is reused between presents
+	ULONGLONG getArea(const Gdi::Region& region)
+	{
+		static std::vector<BYTE> buffer;
+		const DWORD size = GetRegionData(region, 0, nullptr);
+		if (0 == size)
+		{
+			return 0;
+		}
+
+		if (buffer.size() < size)
+		{
+			buffer.resize(size);
+		}
+		auto& data = *reinterpret_cast<RGNDATA*>(buffer.data());
+		if (0 == GetRegionData(region, size, &data))
+		{
+			return 0;
+		}
+
+		ULONGLONG area = 0;
+		auto rects = reinterpret_cast<const RECT*>(data.Buffer);
+		for (DWORD i = 0; i < data.rdh.nCount; ++i)
+		{
+			area += static_cast<ULONGLONG>(rects[i].right - rects[i].left) * (rects[i].bottom - rects[i].top);
+		}
+		return area;
+	}
+
 	Gdi::Region getWindowRegion(HWND hwnd)
 	{
 		Gdi::Region rgn;
@@ -263,6 +304,12 @@ namespace
 		std::swap(it->second.clientRect, wi.rcClient);
 		swap(it->second.visibleRegion, visibleRegion);
 
+		if (setPresentationWindowRgn || !EqualRect(&it->second.windowRect, &wi.rcWindow) ||
+			it->second.visibleRegion != visibleRegion)
+		{
+			Gdi::VirtualScreen::addDirtyRegion(it->second.visibleRegion);
+		}
+
 		if (!isLayered)
 		{
 			if (!it->second.visibleRegion.isEmpty())
@@ -413,6 +460,15 @@ namespace Gdi
 			std::unique_ptr<HDC__, void(*)(HDC)> virtualScreenDc(nullptr, &Gdi::VirtualScreen::deleteDc);
 			RECT virtualScreenBounds = Gdi::VirtualScreen::getBounds();
 
+			Gdi::Region dirtyRegion(Gdi::VirtualScreen::takeDirtyRegion());
+			if (excludeRegion != g_lastExcludeRegion)
+			{
+				dirtyRegion = Gdi::VirtualScreen::getRegion();
+				g_lastExcludeRegion = excludeRegion;
+			}
+
+			++g_presentStats.presents;
+			const ULONGLONG presentedPixels = g_presentStats.presentedPixels;
 			for (auto window : g_windowZOrder)
 			{
 				if (!window->presentationWindow)
@@ -425,10 +481,14 @@ namespace Gdi
 				{
 					visibleRegion -= excludeRegion;
 				}
+				g_presentStats.totalPixels += getArea(visibleRegion);
+
+				visibleRegion &= dirtyRegion;
 				if (visibleRegion.isEmpty())
 				{
 					continue;
 				}
+				g_presentStats.presentedPixels += getArea(visibleRegion);
 
 				if (!virtualScreenDc)
 				{
@@ -436,6 +496,7 @@ namespace Gdi
 					virtualScreenDc.reset(Gdi::VirtualScreen::createDc(useDefaultPalette));
 					if (!virtualScreenDc)
 					{
+						Gdi::VirtualScreen::addDirtyRegion(dirtyRegion);
 						return;
 					}
 				}
@@ -443,11 +504,39 @@ namespace Gdi
 				HDC dc = GetWindowDC(window->presentationWindow);
 				RECT rect = window->windowRect;
 				visibleRegion.offset(-rect.left, -rect.top);
+				RECT dirtyRect = {};
+				GetRgnBox(visibleRegion, &dirtyRect);
 				SelectClipRgn(dc, visibleRegion);
-				CALL_ORIG_FUNC(BitBlt)(dc, 0, 0, rect.right - rect.left, rect.bottom - rect.top, virtualScreenDc.get(),
-					rect.left - virtualScreenBounds.left, rect.top - virtualScreenBounds.top, SRCCOPY);
+				CALL_ORIG_FUNC(BitBlt)(dc, dirtyRect.left, dirtyRect.top,
+					dirtyRect.right - dirtyRect.left, dirtyRect.bottom - dirtyRect.top, virtualScreenDc.get(),
+					rect.left + dirtyRect.left - virtualScreenBounds.left,
+					rect.top + dirtyRect.top - virtualScreenBounds.top, SRCCOPY);
 				CALL_ORIG_FUNC(ReleaseDC)(window->presentationWindow, dc);
 			}
+
+			// Logged once per second, or sooner when a present copies a different number of pixels
+			const ULONGLONG pixels = g_presentStats.presentedPixels - presentedPixels;
+			const DWORD currentTime = GetTickCount();
+			if (pixels != g_presentStats.lastLoggedPixels || currentTime - g_presentStats.lastLogTime >= 1000)
+			{
+				g_presentStats.lastLoggedPixels = pixels;
+				g_presentStats.lastLogTime = currentTime;
+				LOG_DEBUG << "Presented " << g_presentStats.presentedPixels << " of " << g_presentStats.totalPixels
+					<< " window pixels in " << g_presentStats.presents << " presents";
+			}
+		}
+
+		void logPresentStats()
+		{
+			if (0 == g_presentStats.presents)
+			{
+				return;
+			}
+
+			Compat31::Log() << "GDI window presents: " << g_presentStats.presents
+				<< ", presented " << g_presentStats.presentedPixels << " of " << g_presentStats.totalPixels << " pixels ("
+				<< (g_presentStats.totalPixels ? g_presentStats.presentedPixels * 100 / g_presentStats.totalPixels : 0)
+				<< "%)";
 		}
 
 		void presentLayered(CompatRef<IDirectDrawSurface7> dst, POINT offset)
@@ -9,6 +9,7 @@ namespace Gdi
 {
 	namespace Window
 	{
+		void logPresentStats();
 		void onStyleChanged(HWND hwnd, WPARAM wParam);
 		void onSyncPaint(HWND hwnd);
 		void present(CompatRef<IDirectDrawSurface7> dst, CompatRef<IDirectDrawSurface7> src,
@@ -16,11 +16,9 @@
 
 #include "IAMMediaStream.h"
 
-#define LogDebug Log
-
 HRESULT m_IAMMediaStream::QueryInterface(REFIID riid, LPVOID FAR * ppvObj)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ") " << riid;
+	LOG_INF << __FUNCTION__ << " (" << this << ") " << riid;
 
 	if (ppvObj && (riid == WrapperID || riid == IID_IUnknown))
 	{
@@ -36,14 +34,14 @@ HRESULT m_IAMMediaStream::QueryInterface(REFIID riid, LPVOID FAR * ppvObj)
 
 ULONG m_IAMMediaStream::AddRef()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_INF << __FUNCTION__ << " (" << this << ")";
 
 	return InterlockedIncrement(&RefCount);
 }
 
 ULONG m_IAMMediaStream::Release()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_INF << __FUNCTION__ << " (" << this << ")";
 
 	ULONG ref = InterlockedDecrement(&RefCount);
 
@@ -59,7 +57,7 @@ HRESULT m_IAMMediaStream::GetMultiMediaStream(IMultiMediaStream **ppMultiMediaSt
 {
 	UNREFERENCED_PARAMETER(ppMultiMediaStream);
 
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_INF << __FUNCTION__ << " (" << this << ")";
 
 	LOG_LIMIT(100, __FUNCTION__ << " Not Implemented");
 
@@ -71,7 +69,7 @@ HRESULT m_IAMMediaStream::GetInformation(MSPID *pPurposeId, STREAM_TYPE *pType)
 	UNREFERENCED_PARAMETER(pPurposeId);
 	UNREFERENCED_PARAMETER(pType);
 
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_INF << __FUNCTION__ << " (" << this << ")";
 
 	LOG_LIMIT(100, __FUNCTION__ << " Not Implemented");
 
@@ -83,7 +81,7 @@ HRESULT m_IAMMediaStream::SetSameFormat(IMediaStream *pStreamThatHasDesiredForma
 	UNREFERENCED_PARAMETER(pStreamThatHasDesiredFormat);
 	UNREFERENCED_PARAMETER(dwFlags);
 
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_INF << __FUNCTION__ << " (" << this << ")";
 
 	LOG_LIMIT(100, __FUNCTION__ << " Not Implemented");
 
@@ -95,7 +93,7 @@ HRESULT m_IAMMediaStream::AllocateSample(DWORD dwFlags, IStreamSample **ppSample
 	UNREFERENCED_PARAMETER(dwFlags);
 	UNREFERENCED_PARAMETER(ppSample);
 
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_INF << __FUNCTION__ << " (" << this << ")";
 
 	LOG_LIMIT(100, __FUNCTION__ << " Not Implemented");
 
@@ -108,7 +106,7 @@ HRESULT m_IAMMediaStream::CreateSharedSample(IStreamSample *pExistingSample, DWO
 	UNREFERENCED_PARAMETER(dwFlags);
 	UNREFERENCED_PARAMETER(ppNewSample);
 
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_INF << __FUNCTION__ << " (" << this << ")";
 
 	LOG_LIMIT(100, __FUNCTION__ << " Not Implemented");
 
@@ -119,7 +117,7 @@ HRESULT m_IAMMediaStream::SendEndOfStream(DWORD dwFlags)
 {
 	UNREFERENCED_PARAMETER(dwFlags);
 
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_INF << __FUNCTION__ << " (" << this << ")";
 
 	LOG_LIMIT(100, __FUNCTION__ << " Not Implemented");
 
@@ -134,7 +132,7 @@ HRESULT m_IAMMediaStream::Initialize(IUnknown *pSourceObject, DWORD dwFlags, REF
 	UNREFERENCED_PARAMETER(PurposeId);
 	UNREFERENCED_PARAMETER(StreamType);
 
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_INF << __FUNCTION__ << " (" << this << ")";
 
 	LOG_LIMIT(100, __FUNCTION__ << " Not Implemented");
 
@@ -145,7 +143,7 @@ HRESULT m_IAMMediaStream::SetState(FILTER_STATE State)
 {
 	UNREFERENCED_PARAMETER(State);
 
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_INF << __FUNCTION__ << " (" << this << ")";
 
 	LOG_LIMIT(100, __FUNCTION__ << " Not Implemented");
 
@@ -156,7 +154,7 @@ HRESULT m_IAMMediaStream::JoinAMMultiMediaStream(IAMMultiMediaStream *pAMMultiMe
 {
 	UNREFERENCED_PARAMETER(pAMMultiMediaStream);
 
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_INF << __FUNCTION__ << " (" << this << ")";
 
 	LOG_LIMIT(100, __FUNCTION__ << " Not Implemented");
 
@@ -167,7 +165,7 @@ HRESULT m_IAMMediaStream::JoinFilter(IMediaStreamFilter *pMediaStreamFilter)
 {
 	UNREFERENCED_PARAMETER(pMediaStreamFilter);
 
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_INF << __FUNCTION__ << " (" << this << ")";
 
 	LOG_LIMIT(100, __FUNCTION__ << " Not Implemented");
 
@@ -178,7 +176,7 @@ HRESULT m_IAMMediaStream::JoinFilterGraph(IFilterGraph *pFilterGraph)
 {
 	UNREFERENCED_PARAMETER(pFilterGraph);
 
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_INF << __FUNCTION__ << " (" << this << ")";
 
 	LOG_LIMIT(100, __FUNCTION__ << " Not Implemented");
 
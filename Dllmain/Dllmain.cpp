@@ -18,12 +18,17 @@
 #include <Windows.h>
 #include <Shlwapi.h>
 #include "Settings\Settings.h"
+#include "Settings\LiveConfig.h"
 #include "Wrappers\wrapper.h"
 #include "External\Hooking\Hook.h"
 #include "DDrawCompat\DDrawCompatExternal.h"
 #include "DxWnd\DxWndExternal.h"
 #include "Utils\Utils.h"
 #include "Logging\Logging.h"
+#include "Logging\AsyncLog.h"
+#include "Logging\Trace.h"
+#include "Logging\CallStats.h"
+#include "Logging\ChromeTrace.h"
 // Wrappers last
 #include "IClassFactory\IClassFactory.h"
 #include "GDI\GDI.h"
@@ -51,7 +56,7 @@
 		if (prodAddr) \
 		{ \
 			procName ## _var = prodAddr; \
-			Logging::LogDebug() << __FUNCTION__ << " " << #procName << " addr: " << prodAddr; \
+			LOG_DBG << __FUNCTION__ << " " << #procName << " addr: " << prodAddr; \
 		} \
 	}
 
@@ -59,12 +64,12 @@
 	if (GetProcAddress(dll, #procName)) \
 	{ \
 		FARPROC prodAddr = (FARPROC)Hook::HotPatch(Hook::GetProcAddress(dll, #procName), #procName, procName ## _funct, true); \
-		Logging::LogDebug() << __FUNCTION__ << " " << #procName << " addr: " << prodAddr; \
+		LOG_DBG << __FUNCTION__ << " " << #procName << " addr: " << prodAddr; \
 	}
 
 void WINAPI DxWrapperSettings(DXWAPPERSETTINGS *DxSettings)
 {
-	Logging::LogDebug() << __FUNCTION__ << " Called!";
+	LOG_DBG << __FUNCTION__ << " Called!";
 	if (!DxSettings)
 	{
 		return;
@@ -126,7 +131,18 @@ bool APIENTRY DllMain(HMODULE hModule, DWORD fdwReason, LPVOID lpReserved)
 
 		// Init logs
 		Logging::EnableLogging = !Config.DisableLogging;
+		Logging::LogLevel = Config.LogLevel;
 		Logging::InitLog();
+		if (Config.AsyncLogging)
+		{
+			Logging::StartAsyncLog(Config.AsyncLogging == 2);
+		}
+		if (Config.BinaryTrace)
+		{
+			Logging::StartTrace();
+		}
+		Logging::StartCallStats(Config.CallStatsInterval);
+		Logging::StartChromeTrace(Config.ChromeTraceFrames, Config.ChromeTraceKey);
 		Logging::Log() << "Starting DxWrapper v" << APP_VERSION;
 		{
 			char path[MAX_PATH];
@@ -587,6 +603,7 @@ bool APIENTRY DllMain(HMODULE hModule, DWORD fdwReason, LPVOID lpReserved)
 		// Stop threads
 		Utils::Fullscreen::StopThread();
 		Utils::WriteMemory::StopThread();
+		Settings::StopLiveConfig();
 
 		// Unload and Unhook DxWnd
 		if (Config.DxWnd)
@@ -636,7 +653,12 @@ bool APIENTRY DllMain(HMODULE hModule, DWORD fdwReason, LPVOID lpReserved)
 		}
 
 		// Final log
+		Wrapper::LogResolveStats();
 		Logging::Log() << "DxWrapper terminated!";
+		Logging::StopChromeTrace();
+		Logging::StopCallStats();
+		Logging::StopTrace();
+		Logging::StopAsyncLog();
 		break;
 	}
 	return true;
@@ -30,7 +30,7 @@ using namespace GdiWrapper;
 
 int WINAPI gdi_GetDeviceCaps(HDC hdc, int index)
 {
-	Logging::LogDebug() << __FUNCTION__ << " " << hdc << " " << index;
+	LOG_DBG << __FUNCTION__ << " " << hdc << " " << index;
 
 	static GetDeviceCapsProc m_pGetDeviceCaps = (Wrapper::ValidProcAddress(GetDeviceCaps_out)) ? (GetDeviceCapsProc)GetDeviceCaps_out : nullptr;
 
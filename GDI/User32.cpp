@@ -40,7 +40,7 @@ HWND WINAPI user_CreateWindowExT(D m_pCreateWindowEx, DWORD dwExStyle, T lpClass
 {
 	// lpClassName: A null-terminated string or a class atom created by a previous call to the RegisterClass or RegisterClassEx function.
 
-	Logging::LogDebug() << __FUNCTION__ << " " << GetClassName(lpClassName) << " " << lpWindowName << " " << Logging::hex(dwExStyle) << " " << Logging::hex(dwStyle) << " " << X << "x" << Y << " " << nWidth << "x" << nHeight << " " << Logging::hex((DWORD)hWndParent) << " " << hWndParent << " " << hMenu << " " << hInstance;
+	LOG_DBG << __FUNCTION__ << " " << GetClassName(lpClassName) << " " << lpWindowName << " " << Logging::hex(dwExStyle) << " " << Logging::hex(dwStyle) << " " << X << "x" << Y << " " << nWidth << "x" << nHeight << " " << Logging::hex((DWORD)hWndParent) << " " << hWndParent << " " << hMenu << " " << hInstance;
 
 	if (!m_pCreateWindowEx)
 	{
@@ -86,7 +86,7 @@ HWND WINAPI user_CreateWindowExW(DWORD dwExStyle, LPCWSTR lpClassName, LPCWSTR l
 
 BOOL WINAPI user_DestroyWindow(HWND hWnd)
 {
-	Logging::LogDebug() << __FUNCTION__ << " " << hWnd;
+	LOG_DBG << __FUNCTION__ << " " << hWnd;
 
 	static DestroyWindowProc m_pDestroyWindow = (Wrapper::ValidProcAddress(DestroyWindow_out)) ? (DestroyWindowProc)DestroyWindow_out : nullptr;
 
@@ -118,7 +118,7 @@ BOOL WINAPI user_DestroyWindow(HWND hWnd)
 
 int WINAPI user_GetSystemMetrics(int nIndex)
 {
-	Logging::LogDebug() << __FUNCTION__ << " " << nIndex;
+	LOG_DBG << __FUNCTION__ << " " << nIndex;
 
 	static GetSystemMetricsProc m_pGetSystemMetrics = (Wrapper::ValidProcAddress(GetSystemMetrics_out)) ? (GetSystemMetricsProc)GetSystemMetrics_out : nullptr;
 
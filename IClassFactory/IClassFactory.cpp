@@ -53,7 +53,7 @@ REFIID ConvertAllREFIID(REFIID riid)
 
 HRESULT m_IClassFactory::QueryInterface(REFIID riid, LPVOID FAR * ppvObj)
 {
-	Logging::LogDebug() << __FUNCTION__;
+	LOG_DBG << __FUNCTION__;
 
 	if (!ppvObj)
 	{
@@ -69,7 +69,7 @@ HRESULT m_IClassFactory::QueryInterface(REFIID riid, LPVOID FAR * ppvObj)
 		return S_OK;
 	}
 
-	Logging::LogDebug() << "Query for " << riid << " from " << WrapperID;
+	LOG_DBG << "Query for " << riid << " from " << WrapperID;
 
 	if (!ProxyInterface)
 	{
@@ -104,7 +104,7 @@ HRESULT m_IClassFactory::QueryInterface(REFIID riid, LPVOID FAR * ppvObj)
 			return S_OK;
 		}
 
-		Logging::LogDebug() << "Query failed for " << riid << " Error " << Logging::hex(hr);
+		LOG_DBG << "Query failed for " << riid << " Error " << Logging::hex(hr);
 	}
 
 	return hr;
@@ -112,7 +112,7 @@ HRESULT m_IClassFactory::QueryInterface(REFIID riid, LPVOID FAR * ppvObj)
 
 ULONG m_IClassFactory::AddRef()
 {
-	Logging::LogDebug() << __FUNCTION__;
+	LOG_DBG << __FUNCTION__;
 
 	if (!ProxyInterface)
 	{
@@ -124,7 +124,7 @@ ULONG m_IClassFactory::AddRef()
 
 ULONG m_IClassFactory::Release()
 {
-	Logging::LogDebug() << __FUNCTION__;
+	LOG_DBG << __FUNCTION__;
 
 	ULONG ref;
 
@@ -151,7 +151,7 @@ ULONG m_IClassFactory::Release()
 
 HRESULT m_IClassFactory::CreateInstance(IUnknown *pUnkOuter, REFIID riid, void **ppvObject)
 {
-	Logging::LogDebug() << __FUNCTION__ << " " << ClassID << " --> " << riid;
+	LOG_DBG << __FUNCTION__ << " " << ClassID << " --> " << riid;
 
 	if (!ProxyInterface)
 	{
@@ -192,7 +192,7 @@ HRESULT m_IClassFactory::CreateInstance(IUnknown *pUnkOuter, REFIID riid, void *
 			}
 		}
 
-		Logging::LogDebug() << "Query failed for " << riid << " Error " << Logging::hex(hr);
+		LOG_DBG << "Query failed for " << riid << " Error " << Logging::hex(hr);
 	}
 
 	return hr;
@@ -200,7 +200,7 @@ HRESULT m_IClassFactory::CreateInstance(IUnknown *pUnkOuter, REFIID riid, void *
 
 HRESULT m_IClassFactory::LockServer(BOOL fLock)
 {
-	Logging::LogDebug() << __FUNCTION__;
+	LOG_DBG << __FUNCTION__;
 
 	if (!ProxyInterface)
 	{
@@ -213,7 +213,7 @@ HRESULT m_IClassFactory::LockServer(BOOL fLock)
 
 HRESULT WINAPI CoCreateInstanceHandle(REFCLSID rclsid, LPUNKNOWN pUnkOuter, DWORD dwClsContext, REFIID riid, LPVOID *ppv)
 {
-	Logging::LogDebug() << __FUNCTION__ " " << riid;
+	LOG_DBG << __FUNCTION__ " " << riid;
 
 	if (!p_CoCreateInstance)
 	{
@@ -27,7 +27,7 @@ private:
 public:
 	m_IClassFactory(IClassFactory *aOriginal, IQueryInterfaceProc p_QueryInterface) : ProxyInterface(aOriginal), IQueryInterface(p_QueryInterface)
 	{
-		Logging::LogDebug() << "Create " << __FUNCTION__;
+		LOG_DBG << "Create " << __FUNCTION__;
 		if (!ProxyInterface || !IQueryInterface)
 		{
 			ProxyInterface = nullptr;
@@ -88,7 +88,7 @@ void LoadD3dx9()
 
 HRESULT WINAPI D3DXCreateTexture(LPDIRECT3DDEVICE9 pDevice, UINT Width, UINT Height, UINT MipLevels, DWORD Usage, D3DFORMAT Format, D3DPOOL Pool, LPDIRECT3DTEXTURE9* ppTexture)
 {
-	Logging::LogDebug() << __FUNCTION__;
+	LOG_DBG << __FUNCTION__;
 
 	LoadD3dx9();
 
@@ -110,7 +110,7 @@ HRESULT WINAPI D3DXCreateTexture(LPDIRECT3DDEVICE9 pDevice, UINT Width, UINT Hei
 
 HRESULT WINAPI D3DXLoadSurfaceFromMemory(LPDIRECT3DSURFACE9 pDestSurface, const PALETTEENTRY* pDestPalette, const RECT* pDestRect, LPCVOID pSrcMemory, D3DFORMAT SrcFormat, UINT SrcPitch, const PALETTEENTRY* pSrcPalette, const RECT* pSrcRect, DWORD Filter, D3DCOLOR ColorKey)
 {
-	Logging::LogDebug() << __FUNCTION__;
+	LOG_DBG << __FUNCTION__;
 
 	LoadD3dx9();
 
@@ -132,7 +132,7 @@ HRESULT WINAPI D3DXLoadSurfaceFromMemory(LPDIRECT3DSURFACE9 pDestSurface, const
 
 HRESULT WINAPI D3DXLoadSurfaceFromSurface(LPDIRECT3DSURFACE9 pDestSurface, const PALETTEENTRY* pDestPalette, const RECT* pDestRect, LPDIRECT3DSURFACE9 pSrcSurface, const PALETTEENTRY* pSrcPalette, const RECT* pSrcRect, DWORD Filter, D3DCOLOR ColorKey)
 {
-	Logging::LogDebug() << __FUNCTION__;
+	LOG_DBG << __FUNCTION__;
 
 	LoadD3dx9();
 
@@ -154,7 +154,7 @@ HRESULT WINAPI D3DXLoadSurfaceFromSurface(LPDIRECT3DSURFACE9 pDestSurface, const
 
 HRESULT WINAPI D3DXSaveSurfaceToFileInMemory(LPD3DXBUFFER* ppDestBuf, D3DXIMAGE_FILEFORMAT DestFormat, LPDIRECT3DSURFACE9 pSrcSurface, const PALETTEENTRY* pSrcPalette, const RECT* SrcRect)
 {
-	Logging::LogDebug() << __FUNCTION__;
+	LOG_DBG << __FUNCTION__;
 
 	LoadD3dx9();
 
@@ -176,7 +176,7 @@ HRESULT WINAPI D3DXSaveSurfaceToFileInMemory(LPD3DXBUFFER* ppDestBuf, D3DXIMAGE_
 
 HRESULT WINAPI D3DXSaveTextureToFileInMemory(LPD3DXBUFFER* ppDestBuf, D3DXIMAGE_FILEFORMAT DestFormat, LPDIRECT3DBASETEXTURE9 pSrcTexture, const PALETTEENTRY* pSrcPalette)
 {
-	Logging::LogDebug() << __FUNCTION__;
+	LOG_DBG << __FUNCTION__;
 
 	LoadD3dx9();
 
@@ -198,14 +198,14 @@ HRESULT WINAPI D3DXSaveTextureToFileInMemory(LPD3DXBUFFER* ppDestBuf, D3DXIMAGE_
 
 HRESULT WINAPI D3DXAssembleShader(LPCSTR pSrcData, UINT SrcDataLen, const D3DXMACRO* pDefines, LPD3DXINCLUDE pInclude, DWORD Flags, LPD3DXBUFFER* ppShader, LPD3DXBUFFER* ppErrorMsgs)
 {
-	Logging::LogDebug() << __FUNCTION__;
+	LOG_DBG << __FUNCTION__;
 
 	return D3DAssemble(pSrcData, SrcDataLen, nullptr, pDefines, (ID3DInclude*)pInclude, Flags, ppShader, ppErrorMsgs);
 }
 
 HRESULT WINAPI D3DXDisassembleShader(const DWORD* pShader, BOOL EnableColorCode, LPCSTR pComments, LPD3DXBUFFER* ppDisassembly)
 {
-	Logging::LogDebug() << __FUNCTION__;
+	LOG_DBG << __FUNCTION__;
 
 	if (!pShader)
 	{
@@ -263,7 +263,7 @@ HRESULT WINAPI D3DXDisassembleShader(const DWORD* pShader, BOOL EnableColorCode,
 
 HRESULT WINAPI D3DAssemble(const void* pSrcData, SIZE_T SrcDataSize, const char* pFileName, const D3D_SHADER_MACRO* pDefines, ID3DInclude* pInclude, UINT Flags, ID3DBlob** ppShader, ID3DBlob** ppErrorMsgs)
 {
-	Logging::LogDebug() << __FUNCTION__;
+	LOG_DBG << __FUNCTION__;
 
 	LoadD3dx9();
 
@@ -285,7 +285,7 @@ HRESULT WINAPI D3DAssemble(const void* pSrcData, SIZE_T SrcDataSize, const char*
 
 HRESULT WINAPI D3DCompile(LPCVOID pSrcData, SIZE_T SrcDataSize, LPCSTR pSourceName, const D3D_SHADER_MACRO* pDefines, ID3DInclude* pInclude, LPCSTR pEntrypoint, LPCSTR pTarget, UINT Flags1, UINT Flags2, ID3DBlob** ppCode, ID3DBlob** ppErrorMsgs)
 {
-	Logging::LogDebug() << __FUNCTION__;
+	LOG_DBG << __FUNCTION__;
 
 	LoadD3dx9();
 
@@ -307,7 +307,7 @@ HRESULT WINAPI D3DCompile(LPCVOID pSrcData, SIZE_T SrcDataSize, LPCSTR pSourceNa
 
 HRESULT WINAPI D3DDisassemble(LPCVOID pSrcData, SIZE_T SrcDataSize, UINT Flags, LPCSTR szComments, ID3DBlob** ppDisassembly)
 {
-	Logging::LogDebug() << __FUNCTION__;
+	LOG_DBG << __FUNCTION__;
 
 	LoadD3dx9();
 
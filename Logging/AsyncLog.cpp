@@ -0,0 +1,318 @@
+/**
+* Copyright (C) 2022 Elisha Riedlinger
+*
+* This software is  provided 'as-is', without any express  or implied  warranty. In no event will the
+* authors be held liable for any damages arising from the use of this software.
+* Permission  is granted  to anyone  to use  this software  for  any  purpose,  including  commercial
+* applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*   1. The origin of this software must not be misrepresented; you must not claim that you  wrote the
+*      original  software. If you use this  software  in a product, an  acknowledgment in the product
+*      documentation would be appreciated but is not required.
+*   2. Altered source versions must  be plainly  marked as such, and  must not be  misrepresented  as
+*      being the original software.
+*   3. This notice may not be removed or altered from any source distribution.
+*/
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include "AsyncLog.h"
+
+extern std::ofstream LOG;
+
+namespace
+{
+	constexpr DWORD RingSize = 8192;		// Must be a power of two
+	constexpr DWORD WriterWaitTime = 10;	// Time in ms the writer sleeps when no lines are queued
+	constexpr DWORD StopWaitTime = 500;		// Time in ms StopAsyncLog waits for the writer thread to exit
+	constexpr DWORD FlushWaitTime = 100;	// Time in ms a flush waits for the drain lock before giving up
+
+	// One slot of the bounded multi-producer queue, Sequence tells whether the slot is free or holds a line
+	struct LOGRECORD
+	{
+		std::atomic<DWORD> Sequence = 0;
+		DWORD ThreadId = 0;
+		DWORD ThreadToken = 0;
+		DWORD ThreadSequence = 0;
+		std::string Line;
+	};
+
+	LOGRECORD *Ring = nullptr;
+	std::atomic<DWORD> EnqueuePos = 0;
+	DWORD DequeuePos = 0;
+
+	bool BlockWhenFull = false;
+	std::atomic<bool> StopWriter = false;
+	std::atomic<DWORD> DroppedLines = 0;
+	std::atomic<DWORD> NextThreadToken = 0;
+	HANDLE WriterEvent = nullptr;
+	HANDLE WriterThread = nullptr;
+	CRITICAL_SECTION DrainLock;
+
+	std::streambuf *FileBuffer = nullptr;
+	std::unordered_map<DWORD, DWORD> LastThreadSequence;	// Keyed by thread token, thread ids get reused
+
+	thread_local std::string PendingLine;
+	thread_local DWORD ThreadToken = 0;
+	thread_local DWORD ThreadSequence = 0;
+
+	bool TryPush(std::string &Line, DWORD Sequence)
+	{
+		DWORD pos = EnqueuePos.load(std::memory_order_relaxed);
+		LOGRECORD *rec;
+		while (true)
+		{
+			rec = &Ring[pos & (RingSize - 1)];
+			const int diff = static_cast<int>(rec->Sequence.load(std::memory_order_acquire) - pos);
+			if (diff == 0)
+			{
+				if (EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				{
+					break;
+				}
+			}
+			else if (diff < 0)
+			{
+				return false;
+			}
+			else
+			{
+				pos = EnqueuePos.load(std::memory_order_relaxed);
+			}
+		}
+
+		rec->ThreadId = GetCurrentThreadId();
+		rec->ThreadToken = ThreadToken;
+		rec->ThreadSequence = Sequence;
+		rec->Line.swap(Line);
+		rec->Sequence.store(pos + 1, std::memory_order_release);
+
+		// Wake the writer every half ring of lines instead of waiting for its timeout
+		if ((pos & (RingSize / 2 - 1)) == 0)
+		{
+			SetEvent(WriterEvent);
+		}
+		return true;
+	}
+
+	void Submit(std::string &Line)
+	{
+		if (!ThreadToken)
+		{
+			ThreadToken = ++NextThreadToken;
+		}
+		const DWORD Sequence = ++ThreadSequence;
+		while (!TryPush(Line, Sequence))
+		{
+			if (!BlockWhenFull || StopWriter)
+			{
+				// Dropped lines show up as a gap in this thread's sequence
+				DroppedLines++;
+				break;
+			}
+			SetEvent(WriterEvent);
+			Sleep(1);
+		}
+		Line.clear();
+	}
+
+	// Single consumer, both the writer thread and flushing threads drain under DrainLock
+	void DrainRing()
+	{
+		bool Written = false;
+		while (true)
+		{
+			LOGRECORD &rec = Ring[DequeuePos & (RingSize - 1)];
+			if (static_cast<int>(rec.Sequence.load(std::memory_order_acquire) - (DequeuePos + 1)) < 0)
+			{
+				break;
+			}
+
+			DWORD &LastSequence = LastThreadSequence[rec.ThreadToken];
+			if (rec.ThreadSequence != LastSequence + 1)
+			{
+				const std::string Dropped = "Async log: dropped " + std::to_string(rec.ThreadSequence - LastSequence - 1) +
+					" lines from thread " + std::to_string(rec.ThreadId) + "\n";
+				FileBuffer->sputn(Dropped.c_str(), Dropped.size());
+			}
+			LastSequence = rec.ThreadSequence;
+
+			FileBuffer->sputn(rec.Line.c_str(), rec.Line.size());
+			rec.Line.clear();
+			rec.Sequence.store(DequeuePos + RingSize, std::memory_order_release);
+			DequeuePos++;
+			Written = true;
+		}
+
+		if (Written)
+		{
+			FileBuffer->pubsync();
+		}
+	}
+
+	void Drain()
+	{
+		EnterCriticalSection(&DrainLock);
+		DrainRing();
+		LeaveCriticalSection(&DrainLock);
+	}
+
+	// The lock holder may have crashed or been terminated, so only wait for the lock for a while
+	bool TryEnterDrainLock(DWORD Timeout)
+	{
+		for (DWORD x = 0; x < Timeout; x++)
+		{
+			if (TryEnterCriticalSection(&DrainLock))
+			{
+				return true;
+			}
+			Sleep(1);
+		}
+		return TryEnterCriticalSection(&DrainLock) != FALSE;
+	}
+
+	DWORD WINAPI WriterThreadProc(LPVOID)
+	{
+		while (!StopWriter)
+		{
+			WaitForSingleObject(WriterEvent, WriterWaitTime);
+			Drain();
+		}
+		return 0;
+	}
+
+	// Collects each thread's output until a full line is written and then queues it for the writer thread
+	class AsyncLogBuffer : public std::streambuf
+	{
+	protected:
+		int_type overflow(int_type ch) override
+		{
+			if (ch != traits_type::eof())
+			{
+				PendingLine += static_cast<char>(ch);
+				if (ch == '\n')
+				{
+					Submit(PendingLine);
+				}
+			}
+			return traits_type::not_eof(ch);
+		}
+
+		std::streamsize xsputn(const char *s, std::streamsize n) override
+		{
+			const char *end = s + n;
+			while (s < end)
+			{
+				const char *eol = static_cast<const char*>(memchr(s, '\n', end - s));
+				if (!eol)
+				{
+					PendingLine.append(s, end);
+					break;
+				}
+				PendingLine.append(s, eol + 1);
+				Submit(PendingLine);
+				s = eol + 1;
+			}
+			return n;
+		}
+	};
+
+	AsyncLogBuffer AsyncBuffer;
+}
+
+// Redirects the log file through a ring buffer that is written out by a background thread
+void Logging::StartAsyncLog(bool BlockOnOverflow)
+{
+	if (Ring || !LOG.is_open())
+	{
+		return;
+	}
+
+	Ring = new LOGRECORD[RingSize];
+	for (DWORD x = 0; x < RingSize; x++)
+	{
+		Ring[x].Sequence = x;
+	}
+	BlockWhenFull = BlockOnOverflow;
+	InitializeCriticalSection(&DrainLock);
+
+	WriterEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+	FileBuffer = LOG.rdbuf();
+	static_cast<std::ostream&>(LOG).rdbuf(&AsyncBuffer);
+
+	WriterThread = CreateThread(nullptr, 0, WriterThreadProc, nullptr, 0, nullptr);
+	if (!WriterThread)
+	{
+		static_cast<std::ostream&>(LOG).rdbuf(FileBuffer);
+		CloseHandle(WriterEvent);
+		WriterEvent = nullptr;
+		DeleteCriticalSection(&DrainLock);
+		delete[] Ring;
+		Ring = nullptr;
+	}
+}
+
+// Writes all queued lines from the calling thread, used by the exception handler before the process goes down
+void Logging::FlushAsyncLog()
+{
+	if (!Ring)
+	{
+		return;
+	}
+
+	if (!PendingLine.empty())
+	{
+		PendingLine += '\n';
+		Submit(PendingLine);
+	}
+
+	// Lines stay queued if the lock can't be taken, that is better than hanging the exception handler
+	if (TryEnterDrainLock(FlushWaitTime))
+	{
+		DrainRing();
+		LeaveCriticalSection(&DrainLock);
+	}
+}
+
+void Logging::StopAsyncLog()
+{
+	if (!Ring || !WriterThread)
+	{
+		return;
+	}
+
+	StopWriter = true;
+	SetEvent(WriterEvent);
+
+	if (!PendingLine.empty())
+	{
+		PendingLine += '\n';
+		Submit(PendingLine);
+	}
+
+	// The writer drains once more before it exits. During process termination it is already gone and the wait returns at once.
+	const bool WriterExited = (WaitForSingleObject(WriterThread, StopWaitTime) == WAIT_OBJECT_0);
+	CloseHandle(WriterThread);
+	WriterThread = nullptr;
+
+	// A writer that is still running owns the file buffer, so leave the log redirected and skip the final drain
+	if (!WriterExited || !TryEnterDrainLock(StopWaitTime))
+	{
+		return;
+	}
+	DrainRing();
+	static_cast<std::ostream&>(LOG).rdbuf(FileBuffer);
+	if (DroppedLines)
+	{
+		LOG << "Async log: dropped " << DroppedLines << " lines in total" << std::endl;
+	}
+	LeaveCriticalSection(&DrainLock);
+	DeleteCriticalSection(&DrainLock);
+	CloseHandle(WriterEvent);
+	WriterEvent = nullptr;
+}
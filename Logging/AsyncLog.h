@@ -0,0 +1,8 @@
+#pragma once
+
+namespace Logging
+{
+	void StartAsyncLog(bool BlockOnOverflow);
+	void FlushAsyncLog();
+	void StopAsyncLog();
+}
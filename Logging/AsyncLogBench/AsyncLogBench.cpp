@@ -0,0 +1,149 @@
+/**
+* Copyright (C) 2022 Elisha Riedlinger
+*
+* This software is  provided 'as-is', without any express  or implied  warranty. In no event will the
+* authors be held liable for any damages arising from the use of this software.
+* Permission  is granted  to anyone  to use  this software  for  any  purpose,  including  commercial
+* applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*   1. The origin of this software must not be misrepresented; you must not claim that you  wrote the
+*      original  software. If you use this  software  in a product, an  acknowledgment in the product
+*      documentation would be appreciated but is not required.
+*   2. Altered source versions must  be plainly  marked as such, and  must not be  misrepresented  as
+*      being the original software.
+*   3. This notice may not be removed or altered from any source distribution.
+*
+* Log throughput benchmark for AsyncLog.cpp. Several threads write log lines, first straight to the file
+* under a lock with a flush per line, then through the async ring in both overflow modes. Threads are
+* started again for every round, so reused thread ids must not be reported as dropped lines.
+*   cl /std:c++17 /EHsc /O2 AsyncLogBench.cpp
+*
+* Usage: asynclogbench [lines per thread] [threads] [rounds]
+*/
+
+#include "../AsyncLog.cpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+std::ofstream LOG;
+
+namespace
+{
+	const char *LogFile = "asynclogbench.log";
+
+	// Same shape as a typical wrapper log line
+	void WriteLines(std::ostream &Out, DWORD Lines, DWORD Thread, std::mutex *Lock)
+	{
+		for (DWORD x = 0; x < Lines; x++)
+		{
+			if (Lock)
+			{
+				Lock->lock();
+			}
+			Out << "IDirectDrawSurface7::Blt (" << Thread << ") lpDestRect = 0x0 lpDDSrcSurface = 0x" << std::hex << (x * 64) <<
+				std::dec << " dwFlags = 16777216 line " << x << std::endl;
+			if (Lock)
+			{
+				Lock->unlock();
+			}
+		}
+	}
+
+	double Run(int Mode, DWORD Lines, DWORD Threads, DWORD Rounds)
+	{
+		LOG.open(LogFile, std::ios::out | std::ios::trunc);
+		if (Mode != 0)
+		{
+			Logging::StartAsyncLog(Mode == 2);
+		}
+
+		std::mutex Lock;
+		auto Start = std::chrono::steady_clock::now();
+		for (DWORD Round = 0; Round < Rounds; Round++)
+		{
+			std::vector<std::thread> Workers;
+			for (DWORD t = 0; t < Threads; t++)
+			{
+				Workers.emplace_back([&, t]()
+				{
+					// Each thread has its own stream on the log's current buffer, ofstream::rdbuf would be the file
+					std::ostream Out(static_cast<std::ostream&>(LOG).rdbuf());
+					WriteLines(Out, Lines, t, Mode == 0 ? &Lock : nullptr);
+				});
+			}
+			for (auto &Worker : Workers)
+			{
+				Worker.join();
+			}
+		}
+		if (Mode != 0)
+		{
+			Logging::StopAsyncLog();
+		}
+		double Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - Start).count();
+		LOG.close();
+		// StopAsyncLog waited for the writer thread, reset the rest for the next mode
+		StopWriter = false;
+		DroppedLines = 0;
+		EnqueuePos = 0;
+		DequeuePos = 0;
+		LastThreadSequence.clear();
+		delete[] Ring;
+		Ring = nullptr;
+		return Seconds;
+	}
+
+	// Counts lines written, the drops reported as gaps in a thread's lines and the total drops. Lines dropped at
+	// the end of a thread leave no gap, so the gaps can be fewer than the total but never more.
+	void CheckLog(DWORD &Written, unsigned long long &GapDrops, unsigned long long &TotalDrops)
+	{
+		Written = 0;
+		GapDrops = 0;
+		TotalDrops = 0;
+		std::ifstream In(LogFile);
+		std::string Line;
+		while (std::getline(In, Line))
+		{
+			const char Dropped[] = "Async log: dropped ";
+			if (Line.compare(0, sizeof(Dropped) - 1, Dropped) != 0)
+			{
+				Written++;
+			}
+			else if (Line.find(" lines from ") != std::string::npos)
+			{
+				GapDrops += strtoull(Line.c_str() + sizeof(Dropped) - 1, nullptr, 10);
+			}
+			else
+			{
+				TotalDrops += strtoull(Line.c_str() + sizeof(Dropped) - 1, nullptr, 10);
+			}
+		}
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	const DWORD Lines = (argc > 1) ? atoi(argv[1]) : 20000;
+	const DWORD Threads = (argc > 2) ? atoi(argv[2]) : 4;
+	const DWORD Rounds = (argc > 3) ? atoi(argv[3]) : 5;
+	const DWORD Total = Lines * Threads * Rounds;
+
+	// Mode 0 writes straight to the file, 1 and 2 are the AsyncLogging setting values
+	const char *Names[] = { "direct, flush per line", "async, drop when full", "async, wait when full" };
+	for (int Mode = 0; Mode < 3; Mode++)
+	{
+		const double Seconds = Run(Mode, Lines, Threads, Rounds);
+		DWORD Written = 0;
+		unsigned long long GapDrops = 0, TotalDrops = 0;
+		CheckLog(Written, GapDrops, TotalDrops);
+		const bool Consistent = Written + TotalDrops == Total && GapDrops <= TotalDrops;
+		printf("%-24s %8.0f lines/ms, %u of %u lines written, %llu dropped (%llu reported as gaps)%s\n", Names[Mode],
+			Total / Seconds / 1000, Written, Total, TotalDrops, GapDrops, Consistent ? "" : " MISMATCH");
+	}
+	remove(LogFile);
+	return 0;
+}
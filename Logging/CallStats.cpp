@@ -0,0 +1,277 @@
+/**
+* Copyright (C) 2022 Elisha Riedlinger
+*
+* This software is  provided 'as-is', without any express  or implied  warranty. In no event will the
+* authors be held liable for any damages arising from the use of this software.
+* Permission  is granted  to anyone  to use  this software  for  any  purpose,  including  commercial
+* applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*   1. The origin of this software must not be misrepresented; you must not claim that you  wrote the
+*      original  software. If you use this  software  in a product, an  acknowledgment in the product
+*      documentation would be appreciated but is not required.
+*   2. Altered source versions must  be plainly  marked as such, and  must not be  misrepresented  as
+*      being the original software.
+*   3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <intrin.h>
+#include <fstream>
+#include "CallStats.h"
+#include "Logging.h"
+
+bool Logging::CallStatsEnabled = false;
+
+namespace
+{
+	constexpr LONG MaxCallSites = 1024;
+	constexpr DWORD BucketCount = 20;		// Bucket 0 is below 1us, bucket n holds [2^(n-1), 2^n) us, the last one everything above
+
+	struct CALLCOUNTERS
+	{
+		ULONGLONG Count;
+		ULONGLONG TotalTicks;
+		ULONGLONG MaxTicks;
+		DWORD Buckets[BucketCount];
+	};
+
+	// Only the owning thread writes its counters, the dump reads them without locking and may see a call half counted
+	struct THREADCALLSTATS
+	{
+		CALLCOUNTERS Counters[MaxCallSites] = {};
+		THREADCALLSTATS *Next = nullptr;
+		THREADCALLSTATS *Prev = nullptr;
+	};
+
+	CRITICAL_SECTION StatsLock;
+	THREADCALLSTATS *ThreadStats = nullptr;
+	CALLCOUNTERS *RetiredCounters = nullptr;		// Counters of threads that already exited
+	const char *SiteNames[MaxCallSites] = {};
+	std::atomic<LONG> SiteCount = 0;
+
+	LONGLONG TimerFrequency = 0;
+	DWORD DumpInterval = 0;
+	HANDLE StopEvent = nullptr;
+	HANDLE DumpThread = nullptr;
+
+	void AddCounters(CALLCOUNTERS &Total, const CALLCOUNTERS &Counters)
+	{
+		Total.Count += Counters.Count;
+		Total.TotalTicks += Counters.TotalTicks;
+		Total.MaxTicks = max(Total.MaxTicks, Counters.MaxTicks);
+		for (DWORD x = 0; x < BucketCount; x++)
+		{
+			Total.Buckets[x] += Counters.Buckets[x];
+		}
+	}
+
+	struct THREADCALLSTATSOWNER
+	{
+		THREADCALLSTATS *Stats = nullptr;
+
+		THREADCALLSTATS *Get()
+		{
+			if (!Stats)
+			{
+				Stats = new THREADCALLSTATS;
+				EnterCriticalSection(&StatsLock);
+				Stats->Next = ThreadStats;
+				if (ThreadStats)
+				{
+					ThreadStats->Prev = Stats;
+				}
+				ThreadStats = Stats;
+				LeaveCriticalSection(&StatsLock);
+			}
+			return Stats;
+		}
+
+		~THREADCALLSTATSOWNER()
+		{
+			if (!Stats || !Logging::CallStatsEnabled)
+			{
+				return;
+			}
+			EnterCriticalSection(&StatsLock);
+			const LONG Count = SiteCount;
+			for (LONG x = 0; x < Count; x++)
+			{
+				AddCounters(RetiredCounters[x], Stats->Counters[x]);
+			}
+			(Stats->Prev ? Stats->Prev->Next : ThreadStats) = Stats->Next;
+			if (Stats->Next)
+			{
+				Stats->Next->Prev = Stats->Prev;
+			}
+			LeaveCriticalSection(&StatsLock);
+			delete Stats;
+		}
+	};
+
+	thread_local THREADCALLSTATSOWNER ThreadStatsOwner;
+
+	LONG GetSiteId(Logging::CALLSTATSITE &Site)
+	{
+		LONG Id = Site.Id.load(std::memory_order_acquire);
+		if (Id >= 0)
+		{
+			return Id;
+		}
+
+		EnterCriticalSection(&StatsLock);
+		Id = Site.Id.load(std::memory_order_relaxed);
+		if (Id < 0 && SiteCount < MaxCallSites)
+		{
+			Id = SiteCount;
+			SiteNames[Id] = Site.Name;
+			SiteCount.store(Id + 1, std::memory_order_release);
+			Site.Id.store(Id, std::memory_order_release);
+		}
+		LeaveCriticalSection(&StatsLock);
+		return Id;
+	}
+
+	DWORD GetBucket(LONGLONG Ticks)
+	{
+		const ULONGLONG Micros = static_cast<ULONGLONG>(Ticks) * 1000000 / TimerFrequency;
+		if (Micros == 0)
+		{
+			return 0;
+		}
+		unsigned long Index = 0;
+		_BitScanReverse(&Index, static_cast<DWORD>(min(Micros, ULONGLONG(MAXDWORD))));
+		return min(static_cast<DWORD>(Index) + 1, BucketCount - 1);
+	}
+
+	// Sums up all threads and writes the totals so far as CSV, replacing the previous dump
+	void WriteCallStats()
+	{
+		const LONG Count = SiteCount;
+		CALLCOUNTERS *Totals = new CALLCOUNTERS[MaxCallSites];
+		memcpy(Totals, RetiredCounters, sizeof(CALLCOUNTERS) * Count);
+		for (THREADCALLSTATS *Stats = ThreadStats; Stats; Stats = Stats->Next)
+		{
+			for (LONG x = 0; x < Count; x++)
+			{
+				AddCounters(Totals[x], Stats->Counters[x]);
+			}
+		}
+
+		char path[MAX_PATH];
+		Logging::GetLogPath(path, ".callstats.csv");
+		std::ofstream file(path, std::ios::trunc);
+		file << "Method,Calls,TotalMs,AvgUs,MaxUs";
+		for (DWORD x = 0; x < BucketCount; x++)
+		{
+			if (x == 0)
+			{
+				file << ",<1us";
+			}
+			else if (x == BucketCount - 1)
+			{
+				file << ",>=" << (1u << (x - 1)) << "us";
+			}
+			else
+			{
+				file << ",<" << (1u << x) << "us";
+			}
+		}
+		file << "\n";
+
+		const double TicksPerUs = TimerFrequency / 1000000.0;
+		for (LONG x = 0; x < Count; x++)
+		{
+			const CALLCOUNTERS &Total = Totals[x];
+			if (!Total.Count)
+			{
+				continue;
+			}
+			file << SiteNames[x] << "," << Total.Count << "," << Total.TotalTicks / TicksPerUs / 1000.0 << "," <<
+				Total.TotalTicks / TicksPerUs / Total.Count << "," << Total.MaxTicks / TicksPerUs;
+			for (DWORD y = 0; y < BucketCount; y++)
+			{
+				file << "," << Total.Buckets[y];
+			}
+			file << "\n";
+		}
+		delete[] Totals;
+	}
+
+	DWORD WINAPI DumpThreadProc(LPVOID)
+	{
+		while (WaitForSingleObject(StopEvent, DumpInterval * 1000) == WAIT_TIMEOUT)
+		{
+			EnterCriticalSection(&StatsLock);
+			WriteCallStats();
+			LeaveCriticalSection(&StatsLock);
+		}
+		return 0;
+	}
+}
+
+void Logging::RecordCall(CALLSTATSITE &Site, LONGLONG Ticks)
+{
+	const LONG Id = GetSiteId(Site);
+	if (Id < 0)
+	{
+		return;
+	}
+
+	CALLCOUNTERS &Counters = ThreadStatsOwner.Get()->Counters[Id];
+	Counters.Count++;
+	Counters.TotalTicks += Ticks;
+	Counters.MaxTicks = max(Counters.MaxTicks, static_cast<ULONGLONG>(Ticks));
+	Counters.Buckets[GetBucket(Ticks)]++;
+}
+
+// Starts counting calls and writes the per-method totals next to the log every IntervalSeconds
+void Logging::StartCallStats(DWORD IntervalSeconds)
+{
+	if (CallStatsEnabled || !IntervalSeconds)
+	{
+		return;
+	}
+
+	LARGE_INTEGER Frequency;
+	QueryPerformanceFrequency(&Frequency);
+	TimerFrequency = Frequency.QuadPart;
+	DumpInterval = IntervalSeconds;
+
+	InitializeCriticalSection(&StatsLock);
+	RetiredCounters = new CALLCOUNTERS[MaxCallSites]();
+	StopEvent = CreateEvent(nullptr, TRUE, FALSE, nullptr);
+	DumpThread = CreateThread(nullptr, 0, DumpThreadProc, nullptr, 0, nullptr);
+	CallStatsEnabled = true;
+
+	char path[MAX_PATH];
+	GetLogPath(path, ".callstats.csv");
+	Log() << "Writing call statistics every " << IntervalSeconds << " seconds to: " << path;
+}
+
+// Writes the final totals, the dump thread may already be gone during process termination
+void Logging::StopCallStats()
+{
+	if (!CallStatsEnabled)
+	{
+		return;
+	}
+
+	CallStatsEnabled = false;
+	SetEvent(StopEvent);
+	if (DumpThread)
+	{
+		WaitForSingleObject(DumpThread, 100);
+		CloseHandle(DumpThread);
+		DumpThread = nullptr;
+	}
+
+	bool Locked = false;
+	for (int x = 0; x < 100 && !(Locked = TryEnterCriticalSection(&StatsLock)); x++)
+	{
+		Sleep(1);
+	}
+	WriteCallStats();
+	if (Locked)
+	{
+		LeaveCriticalSection(&StatsLock);
+	}
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <atomic>
+
+namespace Logging
+{
+	extern bool CallStatsEnabled;
+
+	void StartCallStats(DWORD IntervalSeconds);
+	void StopCallStats();
+
+	// One instrumented method, constant initialized so the hot path needs no static init guard
+	struct CALLSTATSITE
+	{
+		const char *Name;
+		std::atomic<LONG> Id;
+
+		constexpr CALLSTATSITE(const char *FunctionName) : Name(FunctionName), Id(-1) {}
+	};
+
+	void RecordCall(CALLSTATSITE &Site, LONGLONG Ticks);
+
+	// Times the enclosing scope and adds it to the calling thread's counters
+	class CALLTIMER
+	{
+	private:
+		CALLSTATSITE &Site;
+		LONGLONG Start = 0;
+
+	public:
+		CALLTIMER(CALLSTATSITE &CallSite) : Site(CallSite)
+		{
+			if (CallStatsEnabled)
+			{
+				LARGE_INTEGER Counter;
+				QueryPerformanceCounter(&Counter);
+				Start = Counter.QuadPart;
+			}
+		}
+		~CALLTIMER()
+		{
+			if (Start)
+			{
+				LARGE_INTEGER Counter;
+				QueryPerformanceCounter(&Counter);
+				RecordCall(Site, Counter.QuadPart - Start);
+			}
+		}
+	};
+}
+
+// Counts calls to the enclosing method and records their latency in a log2 histogram
+#define LOG_CALLSTATS() \
+	static Logging::CALLSTATSITE CallStatsSite(__FUNCTION__); \
+	Logging::CALLTIMER CallStatsTimer(CallStatsSite)
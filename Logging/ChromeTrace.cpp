@@ -0,0 +1,293 @@
+/**
+* Copyright (C) 2022 Elisha Riedlinger
+*
+* This software is  provided 'as-is', without any express  or implied  warranty. In no event will the
+* authors be held liable for any damages arising from the use of this software.
+* Permission  is granted  to anyone  to use  this software  for  any  purpose,  including  commercial
+* applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*   1. The origin of this software must not be misrepresented; you must not claim that you  wrote the
+*      original  software. If you use this  software  in a product, an  acknowledgment in the product
+*      documentation would be appreciated but is not required.
+*   2. Altered source versions must  be plainly  marked as such, and  must not be  misrepresented  as
+*      being the original software.
+*   3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include "ChromeTrace.h"
+#include "Logging.h"
+
+bool Logging::ChromeTraceRecording = false;
+
+namespace
+{
+	constexpr DWORD MaxThreadEvents = 65536;		// Events kept per thread and recording, later events are dropped
+
+	struct TRACEEVENT
+	{
+		const char *Name;
+		LONGLONG Timestamp;
+		char Phase;
+	};
+
+	// Only the owning thread appends events, the writer reads up to Count once the recording has stopped
+	struct THREADEVENTS
+	{
+		TRACEEVENT Events[MaxThreadEvents];
+		std::atomic<DWORD> Count = 0;
+		std::atomic<DWORD> Generation = 0;
+		DWORD ThreadId = 0;
+		DWORD Dropped = 0;
+		bool Retired = false;
+		THREADEVENTS *Next = nullptr;
+	};
+
+	enum TRACESTATE
+	{
+		TRACE_WAITING,			// Waiting for the trigger key
+		TRACE_RECORDING,
+		TRACE_WAITING_RELEASE,	// Recording done, waiting for the trigger key to be released
+		TRACE_DONE,
+	};
+
+	CRITICAL_SECTION TraceLock;
+	bool TraceInitialized = false;
+	THREADEVENTS *ThreadEvents = nullptr;
+	std::atomic<DWORD> Generation = 0;
+
+	TRACESTATE State = TRACE_DONE;
+	DWORD RecordFrames = 0;
+	DWORD FramesLeft = 0;
+	DWORD TriggerKey = 0;
+	DWORD RecordingCount = 0;
+	LONGLONG StartTime = 0;
+	LONGLONG TimerFrequency = 0;
+
+	// Buffers of exited threads are reused once their events are no longer part of a recording
+	THREADEVENTS *GetBuffer()
+	{
+		EnterCriticalSection(&TraceLock);
+		THREADEVENTS *Buffer = ThreadEvents;
+		while (Buffer && !(Buffer->Retired && Buffer->Generation != Generation))
+		{
+			Buffer = Buffer->Next;
+		}
+		if (!Buffer)
+		{
+			Buffer = new THREADEVENTS;
+			Buffer->Next = ThreadEvents;
+			ThreadEvents = Buffer;
+		}
+		Buffer->Retired = false;
+		Buffer->ThreadId = GetCurrentThreadId();
+		LeaveCriticalSection(&TraceLock);
+		return Buffer;
+	}
+
+	struct THREADEVENTSOWNER
+	{
+		THREADEVENTS *Buffer = nullptr;
+
+		~THREADEVENTSOWNER()
+		{
+			if (Buffer)
+			{
+				EnterCriticalSection(&TraceLock);
+				Buffer->Retired = true;
+				LeaveCriticalSection(&TraceLock);
+			}
+		}
+	};
+
+	thread_local THREADEVENTSOWNER ThreadEventsOwner;
+
+	LONGLONG GetTimestamp()
+	{
+		LARGE_INTEGER Counter;
+		QueryPerformanceCounter(&Counter);
+		return Counter.QuadPart;
+	}
+
+	void WriteEvent(std::ostream &out, const TRACEEVENT &Event, DWORD ProcessId, DWORD ThreadId, bool &First)
+	{
+		const double Micros = (Event.Timestamp - StartTime) * 1000000.0 / TimerFrequency;
+		out << (First ? "\n" : ",\n") << "{\"name\":\"" << Event.Name << "\",\"ph\":\"" << Event.Phase << "\",\"ts\":" <<
+			std::fixed << std::setprecision(3) << Micros << ",\"pid\":" << ProcessId << ",\"tid\":" << ThreadId;
+		if (Event.Phase == 'i')
+		{
+			out << ",\"s\":\"g\"";
+		}
+		out << "}";
+		First = false;
+	}
+
+	// Writes the events of the recording that just ended, must be called with TraceLock held
+	void WriteChromeTrace()
+	{
+		char path[MAX_PATH];
+		Logging::GetLogPath(path, ".json");
+		char *ext = strrchr(path, '.');
+		sprintf_s(ext, MAX_PATH - (ext - path), "-%lu.json", ++RecordingCount);
+
+		std::ofstream out(path, std::ios::trunc);
+		const DWORD ProcessId = GetCurrentProcessId();
+		DWORD TotalEvents = 0, Dropped = 0;
+		bool First = true;
+		out << "{\"traceEvents\":[";
+		for (THREADEVENTS *Buffer = ThreadEvents; Buffer; Buffer = Buffer->Next)
+		{
+			if (Buffer->Generation.load(std::memory_order_acquire) != Generation)
+			{
+				continue;
+			}
+			const DWORD Count = Buffer->Count.load(std::memory_order_acquire);
+			for (DWORD x = 0; x < Count; x++)
+			{
+				WriteEvent(out, Buffer->Events[x], ProcessId, Buffer->ThreadId, First);
+			}
+			TotalEvents += Count;
+			Dropped += Buffer->Dropped;
+		}
+		out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+		Logging::Log() << "Wrote Chrome trace with " << TotalEvents << " events to: " << path;
+		if (Dropped)
+		{
+			Logging::Log() << "Chrome trace: dropped " << Dropped << " events, thread buffers were full";
+		}
+	}
+
+	void BeginRecording()
+	{
+		Generation++;
+		StartTime = GetTimestamp();
+		FramesLeft = RecordFrames;
+		State = TRACE_RECORDING;
+		Logging::ChromeTraceRecording = true;
+		Logging::Log() << "Chrome trace: recording " << RecordFrames << " frames";
+	}
+
+	void EndRecording()
+	{
+		Logging::ChromeTraceRecording = false;
+		WriteChromeTrace();
+		State = TriggerKey ? TRACE_WAITING_RELEASE : TRACE_DONE;
+	}
+}
+
+void Logging::AddChromeTraceEvent(const char *Name, char Phase)
+{
+	THREADEVENTS *&Buffer = ThreadEventsOwner.Buffer;
+	if (!Buffer)
+	{
+		Buffer = GetBuffer();
+	}
+
+	// First event of a new recording on this thread
+	const DWORD CurrentGeneration = Generation;
+	if (Buffer->Generation != CurrentGeneration)
+	{
+		Buffer->Count.store(0, std::memory_order_relaxed);
+		Buffer->Dropped = 0;
+		Buffer->Generation.store(CurrentGeneration, std::memory_order_release);
+	}
+
+	const DWORD Count = Buffer->Count.load(std::memory_order_relaxed);
+	if (Count >= MaxThreadEvents)
+	{
+		Buffer->Dropped++;
+		return;
+	}
+	Buffer->Events[Count] = { Name, GetTimestamp(), Phase };
+	Buffer->Count.store(Count + 1, std::memory_order_release);
+}
+
+// Records Frames frames, starting right away or each time TriggerKey is pressed
+void Logging::StartChromeTrace(DWORD Frames, DWORD Key)
+{
+	if (TraceInitialized || !Frames)
+	{
+		return;
+	}
+
+	LARGE_INTEGER Frequency;
+	QueryPerformanceFrequency(&Frequency);
+	TimerFrequency = Frequency.QuadPart;
+	InitializeCriticalSection(&TraceLock);
+	TraceInitialized = true;
+
+	RecordFrames = Frames;
+	TriggerKey = Key;
+	State = TRACE_WAITING;
+	if (TriggerKey)
+	{
+		Log() << "Chrome trace: press key " << Logging::hex(TriggerKey) << " to record " << RecordFrames << " frames";
+	}
+}
+
+// Called once per presented frame, starts and ends recordings. Only the d3d9 Present and PresentEx wrappers call it,
+// since Dd7to9 presents go through them too.
+void Logging::ChromeTraceFrame()
+{
+	if (!TraceInitialized || State == TRACE_DONE)
+	{
+		return;
+	}
+
+	EnterCriticalSection(&TraceLock);
+	switch (State)
+	{
+	case TRACE_WAITING:
+		if (!TriggerKey || GetAsyncKeyState(TriggerKey) < 0)
+		{
+			BeginRecording();
+		}
+		break;
+
+	case TRACE_RECORDING:
+		AddChromeTraceEvent("Frame", 'i');
+		if (--FramesLeft == 0)
+		{
+			EndRecording();
+		}
+		break;
+
+	case TRACE_WAITING_RELEASE:
+		if (GetAsyncKeyState(TriggerKey) >= 0)
+		{
+			State = TRACE_WAITING;
+		}
+		break;
+
+	default:
+		break;
+	}
+	LeaveCriticalSection(&TraceLock);
+}
+
+// Writes a recording that is still running, other threads may already be gone during process termination
+void Logging::StopChromeTrace()
+{
+	if (!TraceInitialized)
+	{
+		return;
+	}
+
+	bool Locked = false;
+	for (int x = 0; x < 100 && !(Locked = TryEnterCriticalSection(&TraceLock)); x++)
+	{
+		Sleep(1);
+	}
+	if (State == TRACE_RECORDING)
+	{
+		EndRecording();
+	}
+	State = TRACE_DONE;
+	if (Locked)
+	{
+		LeaveCriticalSection(&TraceLock);
+	}
+}
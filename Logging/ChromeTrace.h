@@ -0,0 +1,41 @@
+#pragma once
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+namespace Logging
+{
+	extern bool ChromeTraceRecording;
+
+	void StartChromeTrace(DWORD Frames, DWORD TriggerKey);
+	void StopChromeTrace();
+	void ChromeTraceFrame();
+	void AddChromeTraceEvent(const char *Name, char Phase);
+
+	// Writes a begin event now and the matching end event when the scope is left
+	class CHROMETRACESCOPE
+	{
+	private:
+		const char *Name;
+		bool Active;
+
+	public:
+		CHROMETRACESCOPE(const char *EventName) : Name(EventName), Active(ChromeTraceRecording)
+		{
+			if (Active)
+			{
+				AddChromeTraceEvent(Name, 'B');
+			}
+		}
+		~CHROMETRACESCOPE()
+		{
+			if (Active)
+			{
+				AddChromeTraceEvent(Name, 'E');
+			}
+		}
+	};
+}
+
+// Shows the enclosing method on the Chrome trace timeline while a recording is running
+#define LOG_CHROMETRACE() Logging::CHROMETRACESCOPE ChromeTraceScope(__FUNCTION__)
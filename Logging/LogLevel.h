@@ -0,0 +1,33 @@
+#pragma once
+
+// Minimum level compiled into the binary, debug logging is only built in debug builds by default
+#define LOGGING_LEVEL_DEBUG		0
+#define LOGGING_LEVEL_INFO		1
+#ifndef LOGGING_MIN_LEVEL
+#ifdef _DEBUG
+#define LOGGING_MIN_LEVEL		LOGGING_LEVEL_DEBUG
+#else
+#define LOGGING_MIN_LEVEL		LOGGING_LEVEL_INFO
+#endif
+#endif
+
+namespace Logging
+{
+	extern bool EnableLogging;
+	extern int LogLevel;		// Lowest level written at runtime, set from the LogLevel setting
+
+	constexpr bool IsLevelCompiled(int Level)
+	{
+		return Level >= LOGGING_MIN_LEVEL;
+	}
+
+	inline bool IsLevelEnabled(int Level)
+	{
+		return IsLevelCompiled(Level) && EnableLogging && Level >= LogLevel;
+	}
+}
+
+// Level checks run before the stream is created, so filtered calls don't evaluate their arguments
+#define LOG_LEVEL(Level, LogClass) if (!Logging::IsLevelEnabled(Level)) {} else Logging::LogClass()
+#define LOG_DBG LOG_LEVEL(LOGGING_LEVEL_DEBUG, LogDebug)
+#define LOG_INF LOG_LEVEL(LOGGING_LEVEL_INFO, Log)
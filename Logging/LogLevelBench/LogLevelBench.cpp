@@ -0,0 +1,174 @@
+/**
+* Copyright (C) 2022 Elisha Riedlinger
+*
+* This software is  provided 'as-is', without any express  or implied  warranty. In no event will the
+* authors be held liable for any damages arising from the use of this software.
+* Permission  is granted  to anyone  to use  this software  for  any  purpose,  including  commercial
+* applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*   1. The origin of this software must not be misrepresented; you must not claim that you  wrote the
+*      original  software. If you use this  software  in a product, an  acknowledgment in the product
+*      documentation would be appreciated but is not required.
+*   2. Altered source versions must  be plainly  marked as such, and  must not be  misrepresented  as
+*      being the original software.
+*   3. This notice may not be removed or altered from any source distribution.
+*
+* Cost of a filtered log line for LogLevel.h. A small method shaped like a wrapper method is timed with
+* an unguarded stream, with LOG_DBG filtered at compile time, by EnableLogging and by LogLevel, and with
+* the line written to a stream that discards its output. Filtered calls must not evaluate their arguments.
+*   g++ -std=c++17 -O2 -o loglevelbench LogLevelBench.cpp
+*   cl /std:c++17 /EHsc /O2 LogLevelBench.cpp
+*
+* Usage: loglevelbench [calls per measurement]
+*/
+
+// Debug lines are built in, like a debug build, so the runtime checks can be measured
+#define LOGGING_MIN_LEVEL LOGGING_LEVEL_DEBUG
+#include "../LogLevel.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ostream>
+#include <streambuf>
+
+#ifdef _MSC_VER
+#define NOINLINE __declspec(noinline)
+#else
+#define NOINLINE __attribute__((noinline))
+#endif
+
+bool Logging::EnableLogging = true;
+int Logging::LogLevel = LOGGING_LEVEL_DEBUG;
+
+namespace
+{
+	// Formats everything and throws it away, so the written case measures formatting without file I/O
+	class NULLBUF : public std::streambuf
+	{
+	protected:
+		int overflow(int c) override { return c; }
+		std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+	};
+
+	NULLBUF NullBuf;
+	std::ostream NullStream(&NullBuf);
+	unsigned long long Evaluations = 0;
+
+	struct DEVICE
+	{
+		unsigned State[256];
+	};
+
+	unsigned CountedArg(unsigned Value)
+	{
+		Evaluations++;
+		return Value;
+	}
+}
+
+namespace Logging
+{
+	class LogDebug
+	{
+	public:
+		~LogDebug() { NullStream << '\n'; }
+
+		template <typename T>
+		LogDebug& operator<<(const T& Value)
+		{
+			NullStream << Value;
+			return *this;
+		}
+	};
+}
+
+namespace
+{
+	enum MODE { Baseline, Unguarded, CompiledOut, Guarded };
+
+	// Same shape as a wrapper method such as SetRenderState, with the log line first
+	template <MODE Mode>
+	NOINLINE unsigned SetState(DEVICE &Device, unsigned State, unsigned Value)
+	{
+		if (Mode == Unguarded)
+		{
+			Logging::LogDebug() << __FUNCTION__ << " (" << &Device << ") " << CountedArg(State) << " " << Value;
+		}
+		else if (Mode == CompiledOut)
+		{
+			LOG_LEVEL(LOGGING_MIN_LEVEL - 1, LogDebug) << __FUNCTION__ << " (" << &Device << ") " << CountedArg(State) << " " << Value;
+		}
+		else if (Mode == Guarded)
+		{
+			LOG_DBG << __FUNCTION__ << " (" << &Device << ") " << CountedArg(State) << " " << Value;
+		}
+
+		const unsigned Old = Device.State[State & 0xFF];
+		Device.State[State & 0xFF] = Value;
+		return Old;
+	}
+
+	template <MODE Mode>
+	double TimeNsPerCall(DEVICE &Device, unsigned Calls, unsigned long long &ArgEvaluations)
+	{
+		const unsigned long long StartEvaluations = Evaluations;
+		unsigned Sum = 0;
+		auto Start = std::chrono::steady_clock::now();
+		for (unsigned x = 0; x < Calls; x++)
+		{
+			Sum += SetState<Mode>(Device, x, x * 3);
+		}
+		auto End = std::chrono::steady_clock::now();
+		ArgEvaluations = Evaluations - StartEvaluations;
+
+		// Keeps the loop from being optimized away
+		Device.State[0] += Sum;
+		return std::chrono::duration<double, std::nano>(End - Start).count() / Calls;
+	}
+
+	bool Report(const char *Name, double Ns, double BaselineNs, unsigned long long ArgEvaluations, unsigned long long ExpectedEvaluations)
+	{
+		printf("%-32s %8.2f ns/call %+8.2f ns   %llu argument evaluations\n", Name, Ns, Ns - BaselineNs, ArgEvaluations);
+		if (ArgEvaluations != ExpectedEvaluations)
+		{
+			printf("FAILED: expected %llu argument evaluations\n", ExpectedEvaluations);
+			return false;
+		}
+		return true;
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	const unsigned Calls = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 20000000;
+	DEVICE Device = {};
+	unsigned long long ArgEvaluations = 0;
+	bool Passed = true;
+
+	printf("%u calls per measurement, overhead is measured against the method without a log line\n\n", Calls);
+
+	double BaselineNs = TimeNsPerCall<Baseline>(Device, Calls, ArgEvaluations);
+	Passed &= Report("no log line", BaselineNs, BaselineNs, ArgEvaluations, 0);
+
+	// What every wrapper method did before LOG_DBG, the stream is built and the arguments formatted
+	double Ns = TimeNsPerCall<Unguarded>(Device, Calls, ArgEvaluations);
+	Passed &= Report("unguarded LogDebug()", Ns, BaselineNs, ArgEvaluations, Calls);
+
+	Ns = TimeNsPerCall<CompiledOut>(Device, Calls, ArgEvaluations);
+	Passed &= Report("below LOGGING_MIN_LEVEL", Ns, BaselineNs, ArgEvaluations, 0);
+
+	Logging::EnableLogging = false;
+	Ns = TimeNsPerCall<Guarded>(Device, Calls, ArgEvaluations);
+	Passed &= Report("LOG_DBG, logging disabled", Ns, BaselineNs, ArgEvaluations, 0);
+
+	Logging::EnableLogging = true;
+	Logging::LogLevel = LOGGING_LEVEL_INFO;
+	Ns = TimeNsPerCall<Guarded>(Device, Calls, ArgEvaluations);
+	Passed &= Report("LOG_DBG, LogLevel = 1", Ns, BaselineNs, ArgEvaluations, 0);
+
+	Logging::LogLevel = LOGGING_LEVEL_DEBUG;
+	Ns = TimeNsPerCall<Guarded>(Device, Calls, ArgEvaluations);
+	Passed &= Report("LOG_DBG, written", Ns, BaselineNs, ArgEvaluations, Calls);
+
+	return Passed ? 0 : 1;
+}
@@ -35,43 +35,49 @@
 #include "Logging.h"
 
 std::ofstream LOG;
+int Logging::LogLevel = LOGGING_LEVEL_DEBUG;
 
-// Get wrapper file name
-void Logging::InitLog()
+// Get log file name for the wrapper and process with the given extension
+void Logging::GetLogPath(char *path, const char *extension)
 {
-	if (!EnableLogging)
-	{
-		return;
-	}
-
-	static char wrappername[MAX_PATH];
-
 	// Get module name
 	HMODULE hModule = NULL;
 	GetModuleHandleEx(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT, (LPCTSTR)InitLog, &hModule);
-	GetModuleFileName(hModule, wrappername, MAX_PATH);
+	GetModuleFileName(hModule, path, MAX_PATH);
 
 	// Get process name
 	char processname[MAX_PATH];
 	GetModuleFileName(nullptr, processname, MAX_PATH);
 
 	// Check if module name is the same as process name
-	if (_stricmp(strrchr(wrappername, '\\') + 1, strrchr(processname, '\\') + 1) == 0)
+	if (_stricmp(strrchr(path, '\\') + 1, strrchr(processname, '\\') + 1) == 0)
 	{
-		strcpy_s(strrchr(wrappername, '\\') + 1, MAX_PATH - strlen(wrappername), "dxwrapper.dll");
+		strcpy_s(strrchr(path, '\\') + 1, MAX_PATH - strlen(path), "dxwrapper.dll");
 	}
 
 	// Remove extension and add dash (-)
-	strcpy_s(strrchr(wrappername, '.'), MAX_PATH - strlen(wrappername), "-");
+	strcpy_s(strrchr(path, '.'), MAX_PATH - strlen(path), "-");
 
 	// Add process name
-	strcat_s(wrappername, MAX_PATH, strrchr(processname, '\\') + 1);
+	strcat_s(path, MAX_PATH, strrchr(processname, '\\') + 1);
 
-	// Change extension to .log
-	strcpy_s(strrchr(wrappername, '.'), MAX_PATH - strlen(wrappername), ".log");
+	// Change extension
+	strcpy_s(strrchr(path, '.'), MAX_PATH - strlen(path), extension);
 
 	// Set lower case
-	for (int z = 0; z < MAX_PATH && wrappername[z] != '\0'; z++) { wrappername[z] = (char)tolower(wrappername[z]); }
+	for (int z = 0; z < MAX_PATH && path[z] != '\0'; z++) { path[z] = (char)tolower(path[z]); }
+}
+
+// Get wrapper file name
+void Logging::InitLog()
+{
+	if (!EnableLogging)
+	{
+		return;
+	}
+
+	static char wrappername[MAX_PATH];
+	GetLogPath(wrappername, ".log");
 
 	Open(wrappername);
 }
@@ -3,10 +3,12 @@
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
 #include "External\Logging\Logging.h"
+#include "LogLevel.h"
 
 namespace Logging
 {
 	void InitLog();
+	void GetLogPath(char *path, const char *extension);
 }
 
 #pragma warning (disable: 26812)
@@ -0,0 +1,180 @@
+/**
+* Copyright (C) 2022 Elisha Riedlinger
+*
+* This software is  provided 'as-is', without any express  or implied  warranty. In no event will the
+* authors be held liable for any damages arising from the use of this software.
+* Permission  is granted  to anyone  to use  this software  for  any  purpose,  including  commercial
+* applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*   1. The origin of this software must not be misrepresented; you must not claim that you  wrote the
+*      original  software. If you use this  software  in a product, an  acknowledgment in the product
+*      documentation would be appreciated but is not required.
+*   2. Altered source versions must  be plainly  marked as such, and  must not be  misrepresented  as
+*      being the original software.
+*   3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "Trace.h"
+#include "Logging.h"
+
+bool Logging::TraceEnabled = false;
+
+namespace
+{
+	constexpr size_t TraceBufferSize = 64 * 1024;
+	constexpr int64_t TraceFlushInterval = 10;		// Buffers older than 1/10 of a second get written out
+
+	struct TRACEBUFFER
+	{
+		uint8_t Data[TraceBufferSize];
+		size_t Used = 0;
+		int64_t LastFlush = 0;
+		TRACEBUFFER *Next = nullptr;
+		TRACEBUFFER *Prev = nullptr;
+	};
+
+	HANDLE TraceFile = INVALID_HANDLE_VALUE;
+	int64_t TimerFrequency = 0;
+	CRITICAL_SECTION TraceLock;
+	TRACEBUFFER *TraceBuffers = nullptr;
+
+	int64_t GetTimestamp()
+	{
+		LARGE_INTEGER Counter;
+		QueryPerformanceCounter(&Counter);
+		return Counter.QuadPart;
+	}
+
+	void WriteTraceBuffer(TRACEBUFFER &Buffer)
+	{
+		if (Buffer.Used)
+		{
+			DWORD Written = 0;
+			WriteFile(TraceFile, Buffer.Data, static_cast<DWORD>(Buffer.Used), &Written, nullptr);
+			Buffer.Used = 0;
+		}
+	}
+
+	// Owns the calling thread's buffer and writes out whatever is left when the thread exits
+	struct THREADTRACEBUFFER
+	{
+		TRACEBUFFER *Buffer = nullptr;
+
+		TRACEBUFFER *Get()
+		{
+			if (!Buffer)
+			{
+				Buffer = new TRACEBUFFER;
+				EnterCriticalSection(&TraceLock);
+				Buffer->Next = TraceBuffers;
+				if (TraceBuffers)
+				{
+					TraceBuffers->Prev = Buffer;
+				}
+				TraceBuffers = Buffer;
+				LeaveCriticalSection(&TraceLock);
+			}
+			return Buffer;
+		}
+
+		~THREADTRACEBUFFER()
+		{
+			if (!Buffer || !Logging::TraceEnabled)
+			{
+				return;
+			}
+			EnterCriticalSection(&TraceLock);
+			WriteTraceBuffer(*Buffer);
+			(Buffer->Prev ? Buffer->Prev->Next : TraceBuffers) = Buffer->Next;
+			if (Buffer->Next)
+			{
+				Buffer->Next->Prev = Buffer->Prev;
+			}
+			LeaveCriticalSection(&TraceLock);
+			delete Buffer;
+		}
+	};
+
+	thread_local THREADTRACEBUFFER ThreadTraceBuffer;
+}
+
+uint8_t *Logging::BeginTraceRecord(TRACEID Id, uint8_t ArgCount, size_t ArgBytes)
+{
+	const size_t RecordSize = sizeof(TRACERECORD) + ArgBytes;
+	if (RecordSize > TraceBufferSize)
+	{
+		return nullptr;
+	}
+
+	TRACEBUFFER &Buffer = *ThreadTraceBuffer.Get();
+	const int64_t Timestamp = GetTimestamp();
+	if (Buffer.Used + RecordSize > TraceBufferSize || Timestamp - Buffer.LastFlush > TimerFrequency / TraceFlushInterval)
+	{
+		EnterCriticalSection(&TraceLock);
+		WriteTraceBuffer(Buffer);
+		LeaveCriticalSection(&TraceLock);
+		Buffer.LastFlush = Timestamp;
+	}
+
+	TRACERECORD &Record = *reinterpret_cast<TRACERECORD*>(Buffer.Data + Buffer.Used);
+	Record.Id = Id;
+	Record.ArgCount = ArgCount;
+	Record.Reserved = 0;
+	Record.ThreadId = GetCurrentThreadId();
+	Record.Timestamp = Timestamp;
+	Record.ArgBytes = static_cast<uint16_t>(ArgBytes);
+	Buffer.Used += RecordSize;
+	return reinterpret_cast<uint8_t*>(&Record + 1);
+}
+
+// Opens the trace file next to the log file
+void Logging::StartTrace()
+{
+	if (TraceEnabled)
+	{
+		return;
+	}
+
+	char path[MAX_PATH];
+	GetLogPath(path, ".trace");
+	TraceFile = CreateFile(path, GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (TraceFile == INVALID_HANDLE_VALUE)
+	{
+		Log() << "Failed to create trace file: " << path;
+		return;
+	}
+
+	LARGE_INTEGER Frequency;
+	QueryPerformanceFrequency(&Frequency);
+	TimerFrequency = Frequency.QuadPart;
+
+	TRACEFILEHEADER Header = {};
+	memcpy(Header.Magic, TraceMagic, sizeof(Header.Magic));
+	Header.Version = TraceVersion;
+	Header.TimerFrequency = TimerFrequency;
+	DWORD Written = 0;
+	WriteFile(TraceFile, &Header, sizeof(Header), &Written, nullptr);
+
+	InitializeCriticalSection(&TraceLock);
+	TraceEnabled = true;
+	Log() << "Writing binary trace to: " << path;
+}
+
+// Writes out the buffers of all threads, must only be called once no other thread is tracing
+void Logging::StopTrace()
+{
+	if (!TraceEnabled)
+	{
+		return;
+	}
+
+	TraceEnabled = false;
+	EnterCriticalSection(&TraceLock);
+	for (TRACEBUFFER *Buffer = TraceBuffers; Buffer; Buffer = Buffer->Next)
+	{
+		WriteTraceBuffer(*Buffer);
+	}
+	CloseHandle(TraceFile);
+	TraceFile = INVALID_HANDLE_VALUE;
+	LeaveCriticalSection(&TraceLock);
+}
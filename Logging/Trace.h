@@ -0,0 +1,98 @@
+#pragma once
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <type_traits>
+#include "TraceFormat.h"
+
+namespace Logging
+{
+	extern bool TraceEnabled;
+
+	void StartTrace();
+	void StopTrace();
+
+	// Reserves a record in the calling thread's trace buffer and returns where its arguments go
+	uint8_t *BeginTraceRecord(TRACEID Id, uint8_t ArgCount, size_t ArgBytes);
+
+	template <typename T>
+	constexpr bool IsTraceRect = std::is_same_v<std::remove_cv_t<std::remove_pointer_t<T>>, RECT>;
+
+	template <typename T>
+	inline size_t GetTraceArgSize(const T &Arg)
+	{
+		if constexpr (IsTraceRect<T>)
+		{
+			return 2 + (Arg ? sizeof(RECT) : 0);
+		}
+		else if constexpr (std::is_pointer_v<T>)
+		{
+			return 2 + sizeof(void*);
+		}
+		else if constexpr (std::is_floating_point_v<T>)
+		{
+			return 2 + sizeof(float);
+		}
+		else
+		{
+			static_assert(std::is_integral_v<T> || std::is_enum_v<T>, "Unsupported trace argument type");
+			return 2 + sizeof(T);
+		}
+	}
+
+	template <typename T>
+	inline void WriteTraceArg(uint8_t *&Data, const T &Arg)
+	{
+		uint8_t Type;
+		uint8_t Size;
+		const void *Value = &Arg;
+		float FloatValue;
+
+		if constexpr (IsTraceRect<T>)
+		{
+			Type = Arg ? TRACEARG_RECT : TRACEARG_NULL;
+			Size = Arg ? sizeof(RECT) : 0;
+			Value = Arg;
+		}
+		else if constexpr (std::is_pointer_v<T>)
+		{
+			Type = TRACEARG_POINTER;
+			Size = sizeof(void*);
+		}
+		else if constexpr (std::is_floating_point_v<T>)
+		{
+			FloatValue = static_cast<float>(Arg);
+			Type = TRACEARG_FLOAT;
+			Size = sizeof(float);
+			Value = &FloatValue;
+		}
+		else if constexpr (std::is_signed_v<T> && !std::is_enum_v<T>)
+		{
+			Type = TRACEARG_INT;
+			Size = sizeof(T);
+		}
+		else
+		{
+			Type = TRACEARG_UINT;
+			Size = sizeof(T);
+		}
+
+		Data[0] = Type;
+		Data[1] = Size;
+		memcpy(Data + 2, Value, Size);
+		Data += 2 + Size;
+	}
+
+	template <typename... Args>
+	inline void WriteTrace(TRACEID Id, const Args &... args)
+	{
+		uint8_t *Data = BeginTraceRecord(Id, sizeof...(Args), (GetTraceArgSize(args) + ...));
+		if (Data)
+		{
+			(WriteTraceArg(Data, args), ...);
+		}
+	}
+}
+
+// Records the call ID, timestamp, thread and raw arguments, formatting is left to the offline decoder
+#define LOG_TRACE(Id, ...) if (!Logging::TraceEnabled) {} else Logging::WriteTrace(Logging::TRACE_ ## Id, __VA_ARGS__)
@@ -0,0 +1,158 @@
+/**
+* Copyright (C) 2022 Elisha Riedlinger
+*
+* This software is  provided 'as-is', without any express  or implied  warranty. In no event will the
+* authors be held liable for any damages arising from the use of this software.
+* Permission  is granted  to anyone  to use  this software  for  any  purpose,  including  commercial
+* applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*   1. The origin of this software must not be misrepresented; you must not claim that you  wrote the
+*      original  software. If you use this  software  in a product, an  acknowledgment in the product
+*      documentation would be appreciated but is not required.
+*   2. Altered source versions must  be plainly  marked as such, and  must not be  misrepresented  as
+*      being the original software.
+*   3. This notice may not be removed or altered from any source distribution.
+*
+* Offline decoder for the binary trace written with BinaryTrace enabled. Standalone, builds on Windows and Linux:
+*   g++ -std=c++17 -O2 -o tracedecoder TraceDecoder.cpp
+*   cl /std:c++17 /EHsc /O2 TraceDecoder.cpp
+*
+* Usage: tracedecoder <file.trace> [output.log]
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <vector>
+#include "../TraceFormat.h"
+
+using namespace Logging;
+
+struct DECODEDRECORD
+{
+	TRACERECORD Header;
+	size_t Offset;		// Offset of the argument bytes in the file data
+};
+
+static bool ReadFileData(const char *path, std::vector<uint8_t> &data)
+{
+	std::ifstream file(path, std::ios::binary);
+	if (!file)
+	{
+		return false;
+	}
+	data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	return true;
+}
+
+static bool FormatRecord(std::ostream &os, const DECODEDRECORD &Record, const std::vector<uint8_t> &data, int64_t Frequency, int64_t Start)
+{
+	const int64_t Ticks = Record.Header.Timestamp - Start;
+	const int64_t Micros = Frequency ? Ticks * 1000000 / Frequency : Ticks;
+	char Time[32];
+	snprintf(Time, sizeof(Time), "%lld.%06lld", static_cast<long long>(Micros / 1000000), static_cast<long long>(Micros % 1000000));
+
+	os << Time << " " << Record.Header.ThreadId << " " << GetTraceName(Record.Header.Id);
+
+	const uint8_t *Arg = data.data() + Record.Offset;
+	const uint8_t *End = Arg + Record.Header.ArgBytes;
+	for (uint8_t x = 0; x < Record.Header.ArgCount; x++)
+	{
+		if (End - Arg < 2 || End - Arg < 2 + Arg[1])
+		{
+			return false;
+		}
+
+		// The first argument is the wrapper object, printed the same way as the text log
+		os << (x == 0 ? " (" : x == 1 ? " " : ", ");
+		if (!FormatTraceArg(os, Arg[0], Arg + 2, Arg[1]))
+		{
+			return false;
+		}
+		os << (x == 0 ? ")" : "");
+		Arg += 2 + Arg[1];
+	}
+	os << "\n";
+	return true;
+}
+
+int main(int argc, char *argv[])
+{
+	if (argc < 2)
+	{
+		std::cerr << "Usage: " << argv[0] << " <file.trace> [output.log]\n";
+		return 1;
+	}
+
+	std::vector<uint8_t> data;
+	if (!ReadFileData(argv[1], data))
+	{
+		std::cerr << "Failed to open " << argv[1] << "\n";
+		return 1;
+	}
+
+	TRACEFILEHEADER FileHeader;
+	if (data.size() < sizeof(FileHeader) || (memcpy(&FileHeader, data.data(), sizeof(FileHeader)),
+		memcmp(FileHeader.Magic, TraceMagic, sizeof(TraceMagic)) != 0))
+	{
+		std::cerr << argv[1] << " is not a dxwrapper trace\n";
+		return 1;
+	}
+	if (FileHeader.Version != TraceVersion)
+	{
+		std::cerr << "Unsupported trace version " << FileHeader.Version << "\n";
+		return 1;
+	}
+
+	// Each thread writes its own buffer, so records are only ordered within a thread until sorted
+	std::vector<DECODEDRECORD> Records;
+	size_t Offset = sizeof(FileHeader);
+	while (data.size() - Offset >= sizeof(TRACERECORD))
+	{
+		DECODEDRECORD Record;
+		memcpy(&Record.Header, data.data() + Offset, sizeof(Record.Header));
+		Record.Offset = Offset + sizeof(TRACERECORD);
+		if (data.size() - Record.Offset < Record.Header.ArgBytes)
+		{
+			std::cerr << "Truncated record at offset " << Offset << "\n";
+			break;
+		}
+		Records.push_back(Record);
+		Offset = Record.Offset + Record.Header.ArgBytes;
+	}
+
+	std::stable_sort(Records.begin(), Records.end(),
+		[](const DECODEDRECORD &a, const DECODEDRECORD &b) { return a.Header.Timestamp < b.Header.Timestamp; });
+
+	std::ofstream OutFile;
+	if (argc > 2)
+	{
+		OutFile.open(argv[2]);
+		if (!OutFile)
+		{
+			std::cerr << "Failed to create " << argv[2] << "\n";
+			return 1;
+		}
+	}
+	std::ostream &os = argc > 2 ? OutFile : std::cout;
+
+	const int64_t Start = Records.empty() ? 0 : Records.front().Header.Timestamp;
+	size_t Malformed = 0;
+	for (const auto &Record : Records)
+	{
+		if (!FormatRecord(os, Record, data, FileHeader.TimerFrequency, Start))
+		{
+			os << " <malformed>\n";
+			Malformed++;
+		}
+	}
+
+	std::cerr << Records.size() << " records decoded";
+	if (Malformed)
+	{
+		std::cerr << ", " << Malformed << " malformed";
+	}
+	std::cerr << "\n";
+	return Malformed ? 2 : 0;
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+// Binary trace layout and argument formatting shared by the trace writer and the offline decoder.
+// Only standard headers may be used here so that the decoder builds on any platform.
+
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <ostream>
+
+#define VISIT_TRACE_CALLS(visit) \
+	visit(D3d9BeginScene, "m_IDirect3DDevice9Ex::BeginScene") \
+	visit(D3d9Clear, "m_IDirect3DDevice9Ex::Clear") \
+	visit(D3d9DrawIndexedPrimitive, "m_IDirect3DDevice9Ex::DrawIndexedPrimitive") \
+	visit(D3d9DrawIndexedPrimitiveUP, "m_IDirect3DDevice9Ex::DrawIndexedPrimitiveUP") \
+	visit(D3d9DrawPrimitive, "m_IDirect3DDevice9Ex::DrawPrimitive") \
+	visit(D3d9DrawPrimitiveUP, "m_IDirect3DDevice9Ex::DrawPrimitiveUP") \
+	visit(D3d9EndScene, "m_IDirect3DDevice9Ex::EndScene") \
+	visit(D3d9Present, "m_IDirect3DDevice9Ex::Present") \
+	visit(D3d9SetFVF, "m_IDirect3DDevice9Ex::SetFVF") \
+	visit(D3d9SetIndices, "m_IDirect3DDevice9Ex::SetIndices") \
+	visit(D3d9SetPixelShader, "m_IDirect3DDevice9Ex::SetPixelShader") \
+	visit(D3d9SetPixelShaderConstantF, "m_IDirect3DDevice9Ex::SetPixelShaderConstantF") \
+	visit(D3d9SetRenderState, "m_IDirect3DDevice9Ex::SetRenderState") \
+	visit(D3d9SetRenderTarget, "m_IDirect3DDevice9Ex::SetRenderTarget") \
+	visit(D3d9SetSamplerState, "m_IDirect3DDevice9Ex::SetSamplerState") \
+	visit(D3d9SetStreamSource, "m_IDirect3DDevice9Ex::SetStreamSource") \
+	visit(D3d9SetTexture, "m_IDirect3DDevice9Ex::SetTexture") \
+	visit(D3d9SetTextureStageState, "m_IDirect3DDevice9Ex::SetTextureStageState") \
+	visit(D3d9SetTransform, "m_IDirect3DDevice9Ex::SetTransform") \
+	visit(D3d9SetVertexDeclaration, "m_IDirect3DDevice9Ex::SetVertexDeclaration") \
+	visit(D3d9SetVertexShader, "m_IDirect3DDevice9Ex::SetVertexShader") \
+	visit(D3d9SetVertexShaderConstantF, "m_IDirect3DDevice9Ex::SetVertexShaderConstantF") \
+	visit(D3d9SetViewport, "m_IDirect3DDevice9Ex::SetViewport") \
+	visit(D3d9StretchRect, "m_IDirect3DDevice9Ex::StretchRect")
+
+namespace Logging
+{
+	constexpr char TraceMagic[8] = { 'D', 'X', 'W', 'T', 'R', 'A', 'C', 'E' };
+	constexpr uint32_t TraceVersion = 1;
+
+#define DEFINE_TRACE_ID(Id, Name) TRACE_ ## Id,
+	enum TRACEID : uint16_t
+	{
+		VISIT_TRACE_CALLS(DEFINE_TRACE_ID)
+		TRACE_COUNT
+	};
+#undef DEFINE_TRACE_ID
+
+	enum TRACEARGTYPE : uint8_t
+	{
+		TRACEARG_UINT,		// Unsigned integer or enum, 1 to 8 bytes
+		TRACEARG_INT,		// Signed integer, 1 to 8 bytes
+		TRACEARG_FLOAT,		// 4 byte float
+		TRACEARG_POINTER,	// 4 or 8 byte address
+		TRACEARG_RECT,		// Four 4 byte signed integers, left, top, right, bottom
+		TRACEARG_NULL,		// Null struct pointer, no data
+	};
+
+#pragma pack(push, 1)
+	struct TRACEFILEHEADER
+	{
+		char Magic[8];
+		uint32_t Version;
+		uint32_t Reserved;
+		int64_t TimerFrequency;		// Timestamp ticks per second
+	};
+
+	// Followed by ArgCount arguments, each one a type byte, a size byte and the raw argument bytes
+	struct TRACERECORD
+	{
+		uint16_t Id;
+		uint8_t ArgCount;
+		uint8_t Reserved;
+		uint32_t ThreadId;
+		int64_t Timestamp;
+		uint16_t ArgBytes;
+	};
+#pragma pack(pop)
+
+	inline const char *GetTraceName(uint16_t Id)
+	{
+#define TRACE_NAME(Id, Name) Name,
+		static const char *const Names[] = { VISIT_TRACE_CALLS(TRACE_NAME) };
+#undef TRACE_NAME
+		return Id < TRACE_COUNT ? Names[Id] : "Unknown";
+	}
+
+	template <typename T>
+	inline T ReadTraceValue(const uint8_t *Data, uint8_t Size)
+	{
+		T Value = 0;
+		memcpy(&Value, Data, Size < sizeof(Value) ? Size : sizeof(Value));
+		return Value;
+	}
+
+	// Renders one argument the way the text log prints it, returns false if the argument is malformed
+	inline bool FormatTraceArg(std::ostream &os, uint8_t Type, const uint8_t *Data, uint8_t Size)
+	{
+		switch (Type)
+		{
+		case TRACEARG_UINT:
+			os << ReadTraceValue<uint64_t>(Data, Size);
+			return true;
+		case TRACEARG_INT:
+		{
+			int64_t Value = ReadTraceValue<int64_t>(Data, Size);
+			if (Size < sizeof(Value) && (Value & (int64_t(1) << (Size * 8 - 1))))
+			{
+				Value -= int64_t(1) << (Size * 8);
+			}
+			os << Value;
+			return true;
+		}
+		case TRACEARG_FLOAT:
+			os << ReadTraceValue<float>(Data, Size);
+			return Size == sizeof(float);
+		case TRACEARG_POINTER:
+			os << std::hex << std::uppercase << std::setfill('0') << std::setw(Size * 2) << ReadTraceValue<uint64_t>(Data, Size) <<
+				std::dec << std::nouppercase << std::setfill(' ');
+			return true;
+		case TRACEARG_RECT:
+			if (Size != 4 * sizeof(int32_t))
+			{
+				return false;
+			}
+			os << "{" << ReadTraceValue<int32_t>(Data, 4) << "," << ReadTraceValue<int32_t>(Data + 4, 4) << "," <<
+				ReadTraceValue<int32_t>(Data + 8, 4) << "," << ReadTraceValue<int32_t>(Data + 12, 4) << "}";
+			return true;
+		case TRACEARG_NULL:
+			os << "null";
+			return true;
+		default:
+			return false;
+		}
+	}
+}
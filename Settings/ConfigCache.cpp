@@ -0,0 +1,221 @@
+/**
+* Copyright (C) 2022 Elisha Riedlinger
+*
+* This software is  provided 'as-is', without any express  or implied  warranty. In no event will the
+* authors be held liable for any damages arising from the use of this software.
+* Permission  is granted  to anyone  to use  this software  for  any  purpose,  including  commercial
+* applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*   1. The origin of this software must not be misrepresented; you must not claim that you  wrote the
+*      original  software. If you use this  software  in a product, an  acknowledgment in the product
+*      documentation would be appreciated but is not required.
+*   2. Altered source versions must  be plainly  marked as such, and  must not be  misrepresented  as
+*      being the original software.
+*   3. This notice may not be removed or altered from any source distribution.
+*
+* Binary cache of the settings read from the config files. It stores the name/value pairs in the order
+* they were parsed so replaying them gives the same config, and it is only used while the size and
+* write time of every config file that was looked for still match.
+*/
+
+#include "Settings.h"
+#include "ConfigCache.h"
+#include "Dllmain\BuildNo.rc"
+
+namespace
+{
+	constexpr char CacheMagic[8] = { 'D', 'X', 'W', 'C', 'F', 'G', 'C', '2' };
+
+	struct CACHEHEADER
+	{
+		char Magic[8];
+		DWORD BuildNumber;
+		DWORD ConfigSize;			// sizeof(CONFIG), changes when settings are added or removed
+		DWORD SourceCount;
+		DWORD DataSize;				// Bytes following the header
+		ULONGLONG Checksum;			// Checksum of the data
+	};
+
+	// Followed by PathLength bytes of path, the used config path, the profile name and then the name/value pairs
+	struct CACHESOURCE
+	{
+		DWORD Exists;
+		DWORD FileSizeHigh;
+		DWORD FileSizeLow;
+		FILETIME LastWriteTime;
+		DWORD PathLength;			// Including the null terminator
+	};
+
+	std::string CachedValues;		// name\0value\0 pairs recorded while parsing
+
+	// FNV-1a
+	ULONGLONG GetChecksum(const char* Data, size_t Size)
+	{
+		ULONGLONG Hash = 14695981039346656037ull;
+		for (size_t x = 0; x < Size; x++)
+		{
+			Hash = (Hash ^ (BYTE)Data[x]) * 1099511628211ull;
+		}
+		return Hash;
+	}
+
+	CACHESOURCE GetSourceInfo(const char* Path)
+	{
+		CACHESOURCE Source = {};
+		WIN32_FILE_ATTRIBUTE_DATA Attributes;
+		if (GetFileAttributesExA(Path, GetFileExInfoStandard, &Attributes))
+		{
+			Source.Exists = TRUE;
+			Source.FileSizeHigh = Attributes.nFileSizeHigh;
+			Source.FileSizeLow = Attributes.nFileSizeLow;
+			Source.LastWriteTime = Attributes.ftLastWriteTime;
+		}
+		Source.PathLength = strlen(Path) + 1;
+		return Source;
+	}
+
+	bool ReadCacheFile(const char* CachePath, std::vector<char>& Data)
+	{
+		HANDLE hFile = CreateFileA(CachePath, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (hFile == INVALID_HANDLE_VALUE)
+		{
+			return false;
+		}
+		DWORD dwBytesRead = 0;
+		const DWORD dwSize = GetFileSize(hFile, nullptr);
+		if (dwSize >= sizeof(CACHEHEADER) && dwSize != INVALID_FILE_SIZE)
+		{
+			Data.resize(dwSize);
+			if (!ReadFile(hFile, Data.data(), dwSize, &dwBytesRead, nullptr))
+			{
+				dwBytesRead = 0;
+			}
+		}
+		CloseHandle(hFile);
+		return (dwBytesRead == dwSize && dwBytesRead != 0);
+	}
+}
+
+// Replays the cached settings if the cache was written by this build and none of the sources changed
+bool Settings::ReadConfigCache(const char* CachePath, const std::vector<std::string>& Sources, char* ConfigPath, std::string& ProfileName, NV NameValueCallback)
+{
+	std::vector<char> Data;
+	if (!ReadCacheFile(CachePath, Data))
+	{
+		return false;
+	}
+
+	CACHEHEADER Header;
+	memcpy(&Header, Data.data(), sizeof(Header));
+	if (memcmp(Header.Magic, CacheMagic, sizeof(CacheMagic)) != 0 ||
+		Header.BuildNumber != BUILD_NUMBER ||
+		Header.ConfigSize != sizeof(CONFIG) ||
+		Header.SourceCount != Sources.size() ||
+		Header.DataSize != Data.size() - sizeof(Header) ||
+		Header.Checksum != GetChecksum(Data.data() + sizeof(Header), Header.DataSize))
+	{
+		return false;
+	}
+
+	char* Next = Data.data() + sizeof(Header);
+	char* End = Data.data() + Data.size();
+	for (const auto& Path : Sources)
+	{
+		CACHESOURCE Cached;
+		if ((size_t)(End - Next) < sizeof(Cached))
+		{
+			return false;
+		}
+		memcpy(&Cached, Next, sizeof(Cached));
+		Next += sizeof(Cached);
+
+		const CACHESOURCE Current = GetSourceInfo(Path.c_str());
+		if ((size_t)(End - Next) < Cached.PathLength || _stricmp(Next, Path.c_str()) != 0 ||
+			Cached.Exists != Current.Exists || Cached.FileSizeHigh != Current.FileSizeHigh || Cached.FileSizeLow != Current.FileSizeLow ||
+			CompareFileTime(&Cached.LastWriteTime, &Current.LastWriteTime) != 0)
+		{
+			return false;
+		}
+		Next += Cached.PathLength;
+	}
+
+	// Every string must be terminated inside the data
+	if (Next == End || End[-1] != '\0')
+	{
+		return false;
+	}
+	strcpy_s(ConfigPath, MAX_PATH, Next);
+	Next += strlen(Next) + 1;
+	if (Next == End)
+	{
+		return false;
+	}
+	ProfileName.assign(Next);
+	Next += strlen(Next) + 1;
+
+	while (Next < End)
+	{
+		char* name = Next;
+		Next += strlen(Next) + 1;
+		if (Next >= End)
+		{
+			return false;
+		}
+		char* value = Next;
+		Next += strlen(Next) + 1;
+		NameValueCallback(name, value);
+	}
+	return true;
+}
+
+// Records a name/value pair passed to the parse callback
+void Settings::AddConfigCacheValue(const char* name, const char* value)
+{
+	CachedValues.append(name).append(1, '\0').append(value).append(1, '\0');
+}
+
+// Writes the recorded pairs, the file is replaced in one step so other processes never read a partial cache
+void Settings::WriteConfigCache(const char* CachePath, const std::vector<std::string>& Sources, const char* ConfigPath, const std::string& ProfileName)
+{
+	std::string Data;
+	for (const auto& Path : Sources)
+	{
+		const CACHESOURCE Source = GetSourceInfo(Path.c_str());
+		Data.append((const char*)&Source, sizeof(Source)).append(Path).append(1, '\0');
+	}
+	Data.append(ConfigPath).append(1, '\0').append(ProfileName).append(1, '\0').append(CachedValues);
+	std::string().swap(CachedValues);
+
+	CACHEHEADER Header = {};
+	memcpy(Header.Magic, CacheMagic, sizeof(CacheMagic));
+	Header.BuildNumber = BUILD_NUMBER;
+	Header.ConfigSize = sizeof(CONFIG);
+	Header.SourceCount = Sources.size();
+	Header.DataSize = Data.size();
+	Header.Checksum = GetChecksum(Data.data(), Data.size());
+
+	char TempPath[MAX_PATH];
+	sprintf_s(TempPath, MAX_PATH, "%s.%lu", CachePath, GetCurrentProcessId());
+	HANDLE hFile = CreateFileA(TempPath, GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (hFile == INVALID_HANDLE_VALUE)
+	{
+		return;
+	}
+	DWORD dwBytesWritten = 0, dwDataWritten = 0;
+	const bool Written = WriteFile(hFile, &Header, sizeof(Header), &dwBytesWritten, nullptr) &&
+		WriteFile(hFile, Data.data(), Data.size(), &dwDataWritten, nullptr) && dwDataWritten == Data.size();
+	CloseHandle(hFile);
+	if (!Written || !MoveFileExA(TempPath, CachePath, MOVEFILE_REPLACE_EXISTING))
+	{
+		DeleteFileA(TempPath);
+	}
+}
+
+void Settings::DeleteConfigCache(const char* CachePath)
+{
+	std::string().swap(CachedValues);
+	if (GetFileAttributesA(CachePath) != INVALID_FILE_ATTRIBUTES)
+	{
+		DeleteFileA(CachePath);
+	}
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include "ReadParse.h"
+
+namespace Settings
+{
+	bool ReadConfigCache(const char* CachePath, const std::vector<std::string>& Sources, char* ConfigPath, std::string& ProfileName, NV NameValueCallback);
+	void AddConfigCacheValue(const char* name, const char* value);
+	void WriteConfigCache(const char* CachePath, const std::vector<std::string>& Sources, const char* ConfigPath, const std::string& ProfileName);
+	void DeleteConfigCache(const char* CachePath);
+}
@@ -0,0 +1,300 @@
+/**
+* Copyright (C) 2022 Elisha Riedlinger
+*
+* This software is  provided 'as-is', without any express  or implied  warranty. In no event will the
+* authors be held liable for any damages arising from the use of this software.
+* Permission  is granted  to anyone  to use  this software  for  any  purpose,  including  commercial
+* applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*   1. The origin of this software must not be misrepresented; you must not claim that you  wrote the
+*      original  software. If you use this  software  in a product, an  acknowledgment in the product
+*      documentation would be appreciated but is not required.
+*   2. Altered source versions must  be plainly  marked as such, and  must not be  misrepresented  as
+*      being the original software.
+*   3. This notice may not be removed or altered from any source distribution.
+*
+* Reloads the settings in VISIT_LIVE_SETTINGS when the config file changes. Each reload publishes a new
+* read only snapshot. Readers announce the epoch they started in and a replaced snapshot is only freed
+* once no reader is left from an epoch before it was replaced, so reading never takes a lock.
+*/
+
+#include "LiveConfig.h"
+#include "Profiles.h"
+#include "Logging\Logging.h"
+
+bool Settings::LiveConfigEnabled = false;
+
+namespace Settings
+{
+	void SetValue(char*, char*, DWORD*);
+	void SetValue(char*, char*, bool*);
+}
+
+#define SET_LIVE_VALUE(functionName) \
+	if (!_stricmp(name, #functionName)) \
+	{ \
+		Settings::SetValue(name, value, &PendingConfig->functionName); \
+		return; \
+	}
+
+#define COPY_STARTUP_VALUE(functionName) \
+	PendingConfig->functionName = Config.functionName;
+
+#define LOG_CHANGED_VALUE(functionName) \
+	if (PendingConfig->functionName != OldConfig->functionName) \
+	{ \
+		Logging::Log() << "Live config: '" #functionName "' changed to " << PendingConfig->functionName; \
+	}
+
+namespace
+{
+	// One per reading thread, reused after the thread exits
+	struct READERSLOT
+	{
+		std::atomic<ULONGLONG> Epoch = 0;		// Epoch the current read started in, 0 when not reading
+		std::atomic<bool> InUse = true;
+		READERSLOT *Next = nullptr;
+	};
+
+	struct RETIREDCONFIG
+	{
+		Settings::LIVECONFIG *Config;
+		ULONGLONG Epoch;						// Readers from before this epoch may still use Config
+	};
+
+	CRITICAL_SECTION SlotLock;					// Only taken when a thread reads for the first time
+	std::atomic<READERSLOT*> ReaderSlots = nullptr;
+	std::atomic<Settings::LIVECONFIG*> CurrentConfig = nullptr;
+	std::atomic<ULONGLONG> GlobalEpoch = 1;
+	std::vector<RETIREDCONFIG> RetiredConfigs;	// Only used by the watch thread
+
+	char WatchPath[MAX_PATH] = {};
+	HANDLE StopEvent = nullptr;
+	HANDLE WatchThread = nullptr;
+	Settings::LIVECONFIG *PendingConfig = nullptr;
+
+	struct READERSLOTOWNER
+	{
+		READERSLOT *Slot = nullptr;
+
+		READERSLOT *Get()
+		{
+			if (!Slot)
+			{
+				EnterCriticalSection(&SlotLock);
+				for (READERSLOT *Free = ReaderSlots; Free; Free = Free->Next)
+				{
+					if (!Free->InUse)
+					{
+						Free->InUse = true;
+						Slot = Free;
+						break;
+					}
+				}
+				if (!Slot)
+				{
+					Slot = new READERSLOT;
+					Slot->Next = ReaderSlots;
+					ReaderSlots = Slot;
+				}
+				LeaveCriticalSection(&SlotLock);
+			}
+			return Slot;
+		}
+
+		~READERSLOTOWNER()
+		{
+			if (Slot)
+			{
+				Slot->Epoch = 0;
+				Slot->InUse = false;
+			}
+		}
+	};
+
+	thread_local READERSLOTOWNER ReaderSlotOwner;
+
+	// Frees the replaced snapshots that no reader can still be using
+	void FreeRetiredConfigs()
+	{
+		ULONGLONG OldestReader = MAXULONGLONG;
+		for (READERSLOT *Slot = ReaderSlots; Slot; Slot = Slot->Next)
+		{
+			const ULONGLONG Epoch = Slot->Epoch;
+			if (Epoch && Epoch < OldestReader)
+			{
+				OldestReader = Epoch;
+			}
+		}
+		for (auto it = RetiredConfigs.begin(); it != RetiredConfigs.end(); )
+		{
+			if (it->Epoch <= OldestReader)
+			{
+				delete it->Config;
+				it = RetiredConfigs.erase(it);
+			}
+			else
+			{
+				it++;
+			}
+		}
+	}
+
+	void Publish(Settings::LIVECONFIG *NewConfig)
+	{
+		Settings::LIVECONFIG *OldConfig = CurrentConfig.exchange(NewConfig);
+		const ULONGLONG Epoch = ++GlobalEpoch;
+		if (OldConfig)
+		{
+			RetiredConfigs.push_back({ OldConfig, Epoch });
+		}
+		FreeRetiredConfigs();
+	}
+
+	void __stdcall LiveParseCallback(char* name, char* value)
+	{
+		VISIT_LIVE_SETTINGS(SET_LIVE_VALUE);
+	}
+
+	void ReloadConfig()
+	{
+		char* szCfg = Settings::Read(WatchPath);
+		if (!szCfg)
+		{
+			return;
+		}
+
+		// Settings missing from the file keep their startup values
+		const Settings::LIVECONFIG *OldConfig = CurrentConfig;
+		PendingConfig = new Settings::LIVECONFIG;
+		VISIT_LIVE_SETTINGS(COPY_STARTUP_VALUE);
+		Settings::ParseProfiles(szCfg, LiveParseCallback, nullptr);
+		free(szCfg);
+
+		if (PendingConfig->LoopSleepTime < 30)
+		{
+			Logging::Log() << "Cannot set 'LoopSleepTime' to less than 30ms!  Resetting to 30ms.";
+			PendingConfig->LoopSleepTime = 30;
+		}
+
+		VISIT_LIVE_SETTINGS(LOG_CHANGED_VALUE);
+		Publish(PendingConfig);
+		PendingConfig = nullptr;
+	}
+
+	bool GetWriteTime(FILETIME& LastWriteTime)
+	{
+		WIN32_FILE_ATTRIBUTE_DATA Attributes;
+		if (!GetFileAttributesExA(WatchPath, GetFileExInfoStandard, &Attributes))
+		{
+			return false;
+		}
+		LastWriteTime = Attributes.ftLastWriteTime;
+		return true;
+	}
+
+	DWORD WINAPI WatchThreadProc(LPVOID)
+	{
+		char WatchDir[MAX_PATH];
+		strcpy_s(WatchDir, MAX_PATH, WatchPath);
+		if (strrchr(WatchDir, '\\'))
+		{
+			*strrchr(WatchDir, '\\') = '\0';
+		}
+
+		// Editors often save by replacing the file so file name changes are watched as well
+		HANDLE hChange = FindFirstChangeNotificationA(WatchDir, FALSE, FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME);
+		if (hChange == INVALID_HANDLE_VALUE)
+		{
+			Logging::Log() << __FUNCTION__ << " Error: could not watch config folder: " << WatchDir;
+			return 0;
+		}
+
+		FILETIME LastWriteTime = {};
+		GetWriteTime(LastWriteTime);
+
+		HANDLE Handles[] = { StopEvent, hChange };
+		while (WaitForMultipleObjects(_countof(Handles), Handles, FALSE, INFINITE) == WAIT_OBJECT_0 + 1)
+		{
+			// Let the editor finish writing before reading the file
+			if (WaitForSingleObject(StopEvent, 100) != WAIT_TIMEOUT)
+			{
+				break;
+			}
+			FILETIME WriteTime;
+			if (GetWriteTime(WriteTime) && CompareFileTime(&WriteTime, &LastWriteTime) != 0)
+			{
+				LastWriteTime = WriteTime;
+				ReloadConfig();
+			}
+			if (!FindNextChangeNotification(hChange))
+			{
+				break;
+			}
+		}
+
+		FindCloseChangeNotification(hChange);
+		return 0;
+	}
+}
+
+std::atomic<ULONGLONG>& Settings::GetLiveConfigReaderEpoch()
+{
+	return ReaderSlotOwner.Get()->Epoch;
+}
+
+// The epoch must be visible before the snapshot is loaded, otherwise the writer could miss this reader
+const Settings::LIVECONFIG* Settings::GetLiveConfig(std::atomic<ULONGLONG>& ReaderEpoch)
+{
+	ReaderEpoch.store(GlobalEpoch);
+	return CurrentConfig;
+}
+
+// Publishes the startup values and watches ConfigPath for changes
+void Settings::StartLiveConfig(const char* ConfigPath)
+{
+	if (LiveConfigEnabled)
+	{
+		return;
+	}
+
+	strcpy_s(WatchPath, MAX_PATH, ConfigPath);
+	InitializeCriticalSection(&SlotLock);
+
+	PendingConfig = new LIVECONFIG;
+	VISIT_LIVE_SETTINGS(COPY_STARTUP_VALUE);
+	Publish(PendingConfig);
+	PendingConfig = nullptr;
+
+	StopEvent = CreateEvent(nullptr, TRUE, FALSE, nullptr);
+	WatchThread = CreateThread(nullptr, 0, WatchThreadProc, nullptr, 0, nullptr);
+	LiveConfigEnabled = true;
+
+	Logging::Log() << "Watching config file for live setting changes: " << WatchPath;
+}
+
+// Stops watching, readers go back to the startup values. Snapshots that may still be in use are not freed
+// because their readers may belong to threads that were already terminated.
+void Settings::StopLiveConfig()
+{
+	if (!LiveConfigEnabled)
+	{
+		return;
+	}
+
+	LiveConfigEnabled = false;
+	SetEvent(StopEvent);
+	bool Stopped = true;
+	if (WatchThread)
+	{
+		Stopped = (WaitForSingleObject(WatchThread, 100) == WAIT_OBJECT_0);
+		CloseHandle(WatchThread);
+		WatchThread = nullptr;
+	}
+
+	// The watch thread may still be publishing a reload
+	if (Stopped)
+	{
+		Publish(nullptr);
+	}
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include "Settings.h"
+
+// Settings that are safe to change while the game is running
+#define VISIT_LIVE_SETTINGS(visit) \
+	visit(AudioFadeOutDelayMS) \
+	visit(AutoFrameSkip) \
+	visit(DdrawRemoveScanlines) \
+	visit(LoopSleepTime)
+
+#define DECLARE_LIVE_SETTING(functionName) \
+	decltype(CONFIG::functionName) functionName;
+
+namespace Settings
+{
+	// Read only snapshot, a new one is published each time the config file changes
+	struct LIVECONFIG
+	{
+		VISIT_LIVE_SETTINGS(DECLARE_LIVE_SETTING)
+	};
+
+	extern bool LiveConfigEnabled;
+
+	void StartLiveConfig(const char* ConfigPath);
+	void StopLiveConfig();
+
+	std::atomic<ULONGLONG>& GetLiveConfigReaderEpoch();
+	const LIVECONFIG* GetLiveConfig(std::atomic<ULONGLONG>& ReaderEpoch);
+
+	// Marks the calling thread as reading so the snapshot it uses is not freed until it is done
+	class LIVECONFIGREADER
+	{
+	private:
+		std::atomic<ULONGLONG>& Epoch;
+
+	public:
+		LIVECONFIGREADER() : Epoch(GetLiveConfigReaderEpoch()) {}
+		~LIVECONFIGREADER() { Epoch.store(0, std::memory_order_release); }
+		const LIVECONFIG* Get() const { return GetLiveConfig(Epoch); }
+	};
+
+	template <typename T>
+	T ReadLiveConfig(T LIVECONFIG::*Setting, const T& StartupValue)
+	{
+		if (!LiveConfigEnabled)
+		{
+			return StartupValue;
+		}
+		LIVECONFIGREADER Reader;
+		const LIVECONFIG* Current = Reader.Get();
+		return Current ? Current->*Setting : StartupValue;
+	}
+}
+
+// Reads a setting from VISIT_LIVE_SETTINGS, without locking when live config reload is enabled
+#define LIVE_CONFIG(functionName) Settings::ReadLiveConfig(&Settings::LIVECONFIG::functionName, Config.functionName)
@@ -0,0 +1,168 @@
+#pragma once
+
+// Perfect hash for looking up setting names. Built with hash and displace: names are first split
+// into buckets, then each bucket gets the smallest seed that moves all of its names to free slots.
+// A lookup is one pass over the name to hash it and one string compare. The table is built once at
+// startup; building it in a constant expression runs past MSVC's /constexpr:steps limit.
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Settings
+{
+	inline char ToLowerAscii(char c)
+	{
+		return (c >= 'A' && c <= 'Z') ? (char)(c - 'A' + 'a') : c;
+	}
+
+	// Case insensitive 64 bit FNV-1a
+	inline uint64_t HashName(const char* Name)
+	{
+		uint64_t Hash = 14695981039346656037ull;
+		for (; *Name; Name++)
+		{
+			Hash = (Hash ^ (uint8_t)ToLowerAscii(*Name)) * 1099511628211ull;
+		}
+		return Hash ^ (Hash >> 29);
+	}
+
+	inline bool IsSameName(const char* a, const char* b)
+	{
+		for (; *a && ToLowerAscii(*a) == ToLowerAscii(*b); a++, b++);
+		return ToLowerAscii(*a) == ToLowerAscii(*b);
+	}
+
+	template <size_t Count>
+	class NAMEHASH
+	{
+	private:
+		static constexpr size_t PowerOfTwo(size_t Value)
+		{
+			size_t Size = 1;
+			while (Size < Value)
+			{
+				Size *= 2;
+			}
+			return Size;
+		}
+
+		static constexpr uint16_t MaxSeed = 0xFFFF;
+
+	public:
+		static constexpr size_t TableSize = PowerOfTwo(Count * 2);
+		static constexpr size_t BucketCount = PowerOfTwo(Count / 2 + 1);
+
+	private:
+		// The low half of the hash picks the bucket, the high half and the bucket seed pick the slot
+		static size_t GetBucket(uint64_t Hash)
+		{
+			return (size_t)Hash & (BucketCount - 1);
+		}
+		static size_t GetSlot(uint64_t Hash, uint16_t Seed)
+		{
+			const uint32_t High = (uint32_t)(Hash >> 32);
+			return (size_t)(High + Seed * ((High >> 16) | 1)) & (TableSize - 1);
+		}
+
+	public:
+		const char* const* Names;
+		uint16_t Seeds[BucketCount] = {};
+		uint16_t Slots[TableSize] = {};		// Name index + 1, 0 for empty slots
+		bool IsValid = true;				// False if the names have duplicates or no seed was found
+
+		NAMEHASH(const char* const (&NameList)[Count]) : Names(NameList)
+		{
+			// Group the name indexes by bucket
+			uint64_t Hashes[Count] = {};
+			uint16_t BucketStart[BucketCount + 1] = {};
+			uint16_t BucketSize[BucketCount] = {};
+			uint16_t Members[Count] = {};
+			for (size_t x = 0; x < Count; x++)
+			{
+				Hashes[x] = HashName(Names[x]);
+				BucketStart[GetBucket(Hashes[x]) + 1]++;
+			}
+			for (size_t x = 0; x < BucketCount; x++)
+			{
+				BucketStart[x + 1] += BucketStart[x];
+			}
+			for (size_t x = 0; x < Count; x++)
+			{
+				const size_t Bucket = GetBucket(Hashes[x]);
+				Members[BucketStart[Bucket] + BucketSize[Bucket]++] = (uint16_t)x;
+			}
+
+			// Duplicate names always share a bucket and would never get a seed
+			for (size_t Bucket = 0; Bucket < BucketCount; Bucket++)
+			{
+				for (size_t x = BucketStart[Bucket]; x < BucketStart[Bucket + 1]; x++)
+				{
+					for (size_t y = x + 1; y < BucketStart[Bucket + 1]; y++)
+					{
+						if (Hashes[Members[x]] == Hashes[Members[y]] && IsSameName(Names[Members[x]], Names[Members[y]]))
+						{
+							IsValid = false;
+							return;
+						}
+					}
+				}
+			}
+
+			// Place the largest buckets first while the table is still empty
+			uint16_t Order[BucketCount] = {};
+			for (size_t x = 0; x < BucketCount; x++)
+			{
+				size_t y = x;
+				for (; y > 0 && BucketSize[Order[y - 1]] < BucketSize[x]; y--)
+				{
+					Order[y] = Order[y - 1];
+				}
+				Order[y] = (uint16_t)x;
+			}
+
+			for (size_t b = 0; b < BucketCount && BucketSize[Order[b]]; b++)
+			{
+				const size_t Bucket = Order[b];
+				const size_t First = BucketStart[Bucket], Last = BucketStart[Bucket + 1];
+				uint16_t Seed = 1;
+				for (; Seed < MaxSeed; Seed++)
+				{
+					// Claim slots for each name in the bucket and roll back on the first collision
+					size_t x = First;
+					for (; x < Last; x++)
+					{
+						uint16_t &Slot = Slots[GetSlot(Hashes[Members[x]], Seed)];
+						if (Slot)
+						{
+							break;
+						}
+						Slot = Members[x] + 1;
+					}
+					if (x == Last)
+					{
+						break;
+					}
+					for (size_t y = First; y < x; y++)
+					{
+						Slots[GetSlot(Hashes[Members[y]], Seed)] = 0;
+					}
+				}
+				if (Seed == MaxSeed)
+				{
+					IsValid = false;
+					return;
+				}
+				Seeds[Bucket] = Seed;
+			}
+		}
+
+		// Returns the index of Name in the name list or -1
+		int Find(const char* Name) const
+		{
+			const uint64_t Hash = HashName(Name);
+			const uint16_t Seed = Seeds[GetBucket(Hash)];
+			const uint16_t Slot = Seed ? Slots[GetSlot(Hash, Seed)] : 0;
+			return (Slot && IsSameName(Names[Slot - 1], Name)) ? Slot - 1 : -1;
+		}
+	};
+}
@@ -0,0 +1,181 @@
+#pragma once
+
+// In place INI parser shared by ReadParse.cpp and Settings\ParserTest. Only standard headers are
+// used so the parser can be tested and benchmarked on any platform.
+
+#include <cstring>
+
+namespace Settings
+{
+	inline bool IsBlank(char c)
+	{
+		return (c == '\x20' || c == '\t' || c == '\r');
+	}
+
+	// Single pass over the buffer read from disk, each line is compacted in place as comments, quotes and
+	// escape characters are removed, so sections, names and values all point into str and nothing is copied.
+	// Name/value delimiter is the first equal sign or colon outside of quotes
+	// whitespace is removed from before and after both the name and value, but not inside double quotes
+	// escape characters inside double quotes: \" and \\, any other backslash is kept as is so Windows paths need no escaping
+	// [sections] are passed to the callback with each name/value, names before the first section have an empty section
+	// the callback is called for every line with a non empty name and value
+	// comments: ; or # at the start of a line, // until the end of the line, /* */ across lines
+	// characters considered to be whitespace:
+	//  0x20 - space
+	//	0x09 - horizontal tab
+	//	0x0D - carriage return
+	template <typename T>
+	void ParseLines(char* str, T&& Callback)
+	{
+		char NoSection[] = "";
+		char* section = NoSection;
+		bool InBlockComment = false;
+
+		for (char* next = str; *next; )
+		{
+			char* line = next;
+			char* in = next;
+			char* out = next;
+			char* delimiter = nullptr;
+			char* valueQuote = nullptr;		// First quote after the delimiter
+			char* quoteEnd = line;			// Text before this point may be inside quotes and is not trimmed
+
+			// ; and # comments must be the first text on the line
+			if (!InBlockComment)
+			{
+				while (IsBlank(*in))
+				{
+					in++;
+				}
+				if (*in == ';' || *in == '#')
+				{
+					in += strcspn(in, "\n");
+				}
+			}
+
+			while (*in && *in != '\n')
+			{
+				if (InBlockComment)
+				{
+					for (; *in && *in != '\n' && (in[0] != '*' || in[1] != '/'); in++);
+					if (*in == '*')
+					{
+						InBlockComment = false;
+						*out++ = '\x20';
+						in += 2;
+					}
+					continue;
+				}
+
+				// Copy plain text up to the next character that needs handling
+				char c;
+				while ((c = *in) != '\0' && c != '\n' && c != '"' && c != '/' && c != '=' && c != ':')
+				{
+					*out++ = c;
+					in++;
+				}
+
+				if (c == '"')
+				{
+					if (delimiter && !valueQuote)
+					{
+						valueQuote = out;
+					}
+					for (in++; *in && *in != '\n' && *in != '"'; in++)
+					{
+						if (*in == '\\' && (in[1] == '"' || in[1] == '\\'))
+						{
+							in++;
+							*out++ = *in;
+						}
+						else
+						{
+							*out++ = *in;
+						}
+					}
+					quoteEnd = out;
+					if (*in == '"')
+					{
+						in++;
+					}
+				}
+				else if (c == '/' && in[1] == '/')
+				{
+					in += strcspn(in, "\n");
+				}
+				else if (c == '/' && in[1] == '*')
+				{
+					InBlockComment = true;
+					in += 2;
+				}
+				else if (c == '=' || c == ':' || c == '/')
+				{
+					if (c != '/' && !delimiter)
+					{
+						delimiter = out;
+					}
+					*out++ = c;
+					in++;
+				}
+			}
+			next = (*in) ? in + 1 : in;
+			*out = '\0';
+
+			// Trim the line
+			char* start = line;
+			while (start < out && IsBlank(*start))
+			{
+				start++;
+			}
+			char* end = out;
+			while (end > start && end > quoteEnd && IsBlank(end[-1]))
+			{
+				end--;
+			}
+
+			// Sections
+			if (start < end && *start == '[' && !valueQuote)
+			{
+				char* close = end - 1;
+				while (close > start && *close != ']')
+				{
+					close--;
+				}
+				if (*close == ']')
+				{
+					for (start++; start < close && IsBlank(*start); start++);
+					for (; close > start && IsBlank(close[-1]); close--);
+					*close = '\0';
+					section = start;
+					continue;
+				}
+			}
+
+			if (!delimiter)
+			{
+				continue;
+			}
+
+			// Split name and value
+			char* lvalue = start;
+			char* lend = delimiter;
+			while (lend > lvalue && IsBlank(lend[-1]))
+			{
+				lend--;
+			}
+			*lend = '\0';
+
+			char* rvalue = delimiter + 1;
+			while (rvalue < end && IsBlank(*rvalue) && (!valueQuote || rvalue < valueQuote))
+			{
+				rvalue++;
+			}
+			*end = '\0';
+
+			if (*lvalue && *rvalue)
+			{
+				Callback(section, lvalue, rvalue);
+			}
+		}
+	}
+}
@@ -0,0 +1,246 @@
+/**
+* Copyright (C) 2022 Elisha Riedlinger
+*
+* This software is  provided 'as-is', without any express  or implied  warranty. In no event will the
+* authors be held liable for any damages arising from the use of this software.
+* Permission  is granted  to anyone  to use  this software  for  any  purpose,  including  commercial
+* applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*   1. The origin of this software must not be misrepresented; you must not claim that you  wrote the
+*      original  software. If you use this  software  in a product, an  acknowledgment in the product
+*      documentation would be appreciated but is not required.
+*   2. Altered source versions must  be plainly  marked as such, and  must not be  misrepresented  as
+*      being the original software.
+*   3. This notice may not be removed or altered from any source distribution.
+*
+* Tests for the INI parser in ParseLines.h and the setting name hash in NameHash.h, followed by a
+* benchmark that parses an INI file repeated to a few MB and looks up its names. Standalone, builds on
+* Windows and Linux:
+*   g++ -std=c++17 -O2 -o parsertest ParserTest.cpp
+*   cl /std:c++17 /EHsc /O2 ParserTest.cpp
+*
+* Usage: parsertest [ini file] [MB to parse]
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "../ParseLines.h"
+#include "../NameHash.h"
+
+using namespace Settings;
+
+struct PARSEDVALUE
+{
+	std::string Section;
+	std::string Name;
+	std::string Value;
+};
+
+static int Failures = 0;
+
+static std::vector<PARSEDVALUE> ParseText(const char *Text)
+{
+	std::vector<char> Buffer(Text, Text + strlen(Text) + 1);
+	std::vector<PARSEDVALUE> Values;
+	ParseLines(Buffer.data(), [&Values](char *section, char *name, char *value) { Values.push_back({ section, name, value }); });
+	return Values;
+}
+
+static void Check(const char *Test, const char *Text, const std::vector<PARSEDVALUE> &Expected)
+{
+	const std::vector<PARSEDVALUE> Values = ParseText(Text);
+	bool Match = Values.size() == Expected.size();
+	for (size_t x = 0; Match && x < Values.size(); x++)
+	{
+		Match = Values[x].Section == Expected[x].Section && Values[x].Name == Expected[x].Name && Values[x].Value == Expected[x].Value;
+	}
+	if (!Match)
+	{
+		printf("FAILED %s, got:\n", Test);
+		for (const auto &Value : Values)
+		{
+			printf("  [%s] '%s' = '%s'\n", Value.Section.c_str(), Value.Name.c_str(), Value.Value.c_str());
+		}
+		Failures++;
+	}
+}
+
+static void TestParser()
+{
+	Check("name/value", "a=1\nb : 2\n  c  =  three words  \r\n", { { "", "a", "1" }, { "", "b", "2" }, { "", "c", "three words" } });
+	Check("first delimiter", "a = b = c\nd: e=f\n", { { "", "a", "b = c" }, { "", "d", "e=f" } });
+	Check("empty values", "a=\n=1\nnovalue\n\n", {});
+	Check("line comments", "; a=1\n  # b=2\nc=3 // comment\nd=4;5\n", { { "", "c", "3" }, { "", "d", "4;5" } });
+	Check("block comments", "a=1 /* x=2\ny=3 */ \nb=/**/2\n", { { "", "a", "1" }, { "", "b", "2" } });
+	Check("sections", "a=1\n[ First ]\nb=2\n[Second]\nc=3\n", { { "", "a", "1" }, { "First", "b", "2" }, { "Second", "c", "3" } });
+	Check("quotes", "a=\"  spaced  \"\nb=\"// not a comment\"\nc=\"x=y\"\n", { { "", "a", "  spaced  " }, { "", "b", "// not a comment" }, { "", "c", "x=y" } });
+	Check("quoted escapes", "a=\"say \\\"hi\\\"\"\nb=\"back\\\\slash\"\n", { { "", "a", "say \"hi\"" }, { "", "b", "back\\slash" } });
+	Check("other backslashes", "a=\"C:\\new\\test\"\nb=\"tab\\tnewline\\n\"\nc=C:\\Games\\\n",
+		{ { "", "a", "C:\\new\\test" }, { "", "b", "tab\\tnewline\\n" }, { "", "c", "C:\\Games\\" } });
+	Check("unterminated quote", "a=\"open\nb=2\n", { { "", "a", "open" }, { "", "b", "2" } });
+	Check("no trailing newline", "a=1", { { "", "a", "1" } });
+}
+
+static void TestNameHash()
+{
+	static const char* const Names[] = { "Dd7to9", "D3d8to9", "FullscreenWindowMode", "ForceWindowResize", "LoadPlugins", "DisableGameUX" };
+	const NAMEHASH<std::size(Names)> Hash(Names);
+	if (!Hash.IsValid)
+	{
+		printf("FAILED name hash, could not be built\n");
+		Failures++;
+		return;
+	}
+	for (int x = 0; x < (int)std::size(Names); x++)
+	{
+		if (Hash.Find(Names[x]) != x)
+		{
+			printf("FAILED name hash, %s not found\n", Names[x]);
+			Failures++;
+		}
+	}
+	if (Hash.Find("DD7TO9") != 0 || Hash.Find("loadplugins") != 4)
+	{
+		printf("FAILED name hash, lookup is not case insensitive\n");
+		Failures++;
+	}
+	if (Hash.Find("Dd7to") != -1 || Hash.Find("Dd7to99") != -1 || Hash.Find("") != -1)
+	{
+		printf("FAILED name hash, found a name that is not in the list\n");
+		Failures++;
+	}
+
+	static const char* const Duplicates[] = { "Dd7to9", "LoadPlugins", "loadplugins" };
+	const NAMEHASH<std::size(Duplicates)> DuplicateHash(Duplicates);
+	if (DuplicateHash.IsValid)
+	{
+		printf("FAILED name hash, duplicate names were accepted\n");
+		Failures++;
+	}
+}
+
+static bool ReadText(const char *Path, std::string &Text)
+{
+	std::ifstream File(Path, std::ios::binary);
+	if (!File)
+	{
+		return false;
+	}
+	Text.assign(std::istreambuf_iterator<char>(File), std::istreambuf_iterator<char>());
+	return true;
+}
+
+static bool IsSameNameLinear(const char *a, const char *b)
+{
+	for (; *a && ToLowerAscii(*a) == ToLowerAscii(*b); a++, b++);
+	return ToLowerAscii(*a) == ToLowerAscii(*b);
+}
+
+// The hash needs its size at compile time, unused entries are filled with names that are never looked up
+constexpr size_t MaxBenchNames = 256;
+
+static void Benchmark(const char *Path, size_t Megabytes)
+{
+	std::string Ini;
+	if (!ReadText(Path, Ini) || Ini.empty())
+	{
+		printf("Could not read %s, benchmark skipped\n", Path);
+		return;
+	}
+	std::string Text;
+	while (Text.size() < Megabytes * 1024 * 1024)
+	{
+		Text += Ini;
+		Text += '\n';
+	}
+
+	// The buffer is compacted in place, so each pass parses a fresh copy
+	std::vector<char> Buffer;
+	size_t Values = 0;
+	double Seconds = 0;
+	const int Passes = 5;
+	for (int Pass = 0; Pass < Passes; Pass++)
+	{
+		Buffer.assign(Text.begin(), Text.end());
+		Buffer.push_back('\0');
+		const auto Start = std::chrono::steady_clock::now();
+		ParseLines(Buffer.data(), [&Values](char*, char*, char*) { Values++; });
+		Seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - Start).count();
+	}
+	printf("Parse:  %.1f MB in %.2f ms, %.0f MB/s, %zu values per pass\n", Text.size() / 1048576.0, Seconds * 1000 / Passes,
+		Text.size() / 1048576.0 * Passes / Seconds, Values / Passes);
+
+	// Look up every name from the file, as ParseCallback does once per line
+	std::vector<std::string> Names;
+	Buffer.assign(Ini.begin(), Ini.end());
+	Buffer.push_back('\0');
+	ParseLines(Buffer.data(), [&Names](char*, char *name, char*) { if (Names.size() < MaxBenchNames) Names.push_back(name); });
+	std::vector<std::string> Padding;
+	for (size_t x = Names.size(); x < MaxBenchNames; x++)
+	{
+		Padding.push_back("~unused" + std::to_string(x));
+	}
+	const char *NameList[MaxBenchNames];
+	for (size_t x = 0; x < MaxBenchNames; x++)
+	{
+		NameList[x] = (x < Names.size()) ? Names[x].c_str() : Padding[x - Names.size()].c_str();
+	}
+	const NAMEHASH<MaxBenchNames> Hash(NameList);
+	if (!Hash.IsValid)
+	{
+		printf("%s has duplicate names, lookup benchmark skipped\n", Path);
+		return;
+	}
+
+	const int Rounds = 20000;
+	size_t Found = 0;
+	auto Start = std::chrono::steady_clock::now();
+	for (int Round = 0; Round < Rounds; Round++)
+	{
+		for (const auto &Name : Names)
+		{
+			Found += Hash.Find(Name.c_str()) >= 0;
+		}
+	}
+	const double HashSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - Start).count();
+	Start = std::chrono::steady_clock::now();
+	for (int Round = 0; Round < Rounds; Round++)
+	{
+		for (const auto &Name : Names)
+		{
+			for (const auto &Other : Names)
+			{
+				if (IsSameNameLinear(Name.c_str(), Other.c_str()))
+				{
+					Found++;
+					break;
+				}
+			}
+		}
+	}
+	const double LinearSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - Start).count();
+	const double Lookups = (double)Rounds * Names.size();
+	printf("Lookup: %zu names, hash %.1f ns, linear compare %.1f ns per name (%zu found)\n", Names.size(),
+		HashSeconds * 1e9 / Lookups, LinearSeconds * 1e9 / Lookups, Found);
+}
+
+int main(int argc, char *argv[])
+{
+	TestParser();
+	TestNameHash();
+	if (Failures)
+	{
+		printf("%d test(s) failed\n", Failures);
+		return 1;
+	}
+	printf("All tests passed\n");
+
+	Benchmark(argc > 1 ? argv[1] : "../AllSettings.ini", argc > 2 ? std::max(1, atoi(argv[2])) : 16);
+	return 0;
+}
@@ -0,0 +1,175 @@
+/**
+* Copyright (C) 2022 Elisha Riedlinger
+*
+* This software is  provided 'as-is', without any express  or implied  warranty. In no event will the
+* authors be held liable for any damages arising from the use of this software.
+* Permission  is granted  to anyone  to use  this software  for  any  purpose,  including  commercial
+* applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*   1. The origin of this software must not be misrepresented; you must not claim that you  wrote the
+*      original  software. If you use this  software  in a product, an  acknowledgment in the product
+*      documentation would be appreciated but is not required.
+*   2. Altered source versions must  be plainly  marked as such, and  must not be  misrepresented  as
+*      being the original software.
+*   3. This notice may not be removed or altered from any source distribution.
+*
+* Per executable profiles. Settings outside of a [Profile:name] section form the base profile. A profile
+* section applies when its name is the executable id or the executable name, with or without extension.
+* 'Inherit = name' inside a profile applies another profile first.
+*/
+
+#include <algorithm>
+#include "Settings.h"
+#include "Profiles.h"
+
+namespace Settings
+{
+	extern char p_pName[MAX_PATH];
+}
+
+namespace
+{
+	constexpr char ProfilePrefix[] = "Profile:";
+	constexpr size_t MaxInheritDepth = 8;
+
+	struct PROFILEVALUE
+	{
+		const char* Profile;		// nullptr for the base profile
+		char* name;
+		char* value;
+	};
+
+	std::vector<PROFILEVALUE>* ParsedValues = nullptr;
+	char ExecutableId[9] = {};
+
+	// Returns the profile name of a [Profile:name] section or nullptr for any other section
+	const char* GetProfileName(const char* section)
+	{
+		if (_strnicmp(section, ProfilePrefix, sizeof(ProfilePrefix) - 1) != 0)
+		{
+			return nullptr;
+		}
+		section += sizeof(ProfilePrefix) - 1;
+		while (*section == ' ' || *section == '\t')
+		{
+			section++;
+		}
+		return section;
+	}
+
+	void __stdcall CollectCallback(char* section, char* name, char* value)
+	{
+		ParsedValues->push_back({ GetProfileName(section), name, value });
+	}
+
+	bool HasProfile(const std::vector<PROFILEVALUE>& Values, const char* Profile)
+	{
+		for (const auto& Value : Values)
+		{
+			if (Value.Profile && !_stricmp(Value.Profile, Profile))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool IsExecutableProfile(const char* Profile)
+	{
+		const char* Extension = strrchr(Settings::p_pName, '.');
+		const size_t NameLength = Extension ? (size_t)(Extension - Settings::p_pName) : strlen(Settings::p_pName);
+		return !_stricmp(Profile, Settings::p_pName) ||
+			(strlen(Profile) == NameLength && !_strnicmp(Profile, Settings::p_pName, NameLength));
+	}
+}
+
+// Identifies the executable build by the link time, image size and checksum in its PE header, so a
+// profile can target one version of a game without hashing the whole file
+const char* Settings::GetExecutableId()
+{
+	if (!*ExecutableId)
+	{
+		DWORD Hash = 2166136261;
+		const BYTE* Module = (const BYTE*)GetModuleHandle(nullptr);
+		const IMAGE_DOS_HEADER* DosHeader = (const IMAGE_DOS_HEADER*)Module;
+		if (Module && DosHeader->e_magic == IMAGE_DOS_SIGNATURE)
+		{
+			const IMAGE_NT_HEADERS* NtHeader = (const IMAGE_NT_HEADERS*)(Module + DosHeader->e_lfanew);
+			const DWORD Fields[] = { NtHeader->FileHeader.TimeDateStamp, NtHeader->OptionalHeader.SizeOfImage, NtHeader->OptionalHeader.CheckSum };
+			for (const BYTE* Byte = (const BYTE*)Fields; Byte < (const BYTE*)Fields + sizeof(Fields); Byte++)
+			{
+				Hash = (Hash ^ *Byte) * 16777619;
+			}
+		}
+		sprintf_s(ExecutableId, sizeof(ExecutableId), "%08X", Hash);
+	}
+	return ExecutableId;
+}
+
+// Passes the base profile and then the profiles matching this executable to the callback, the least
+// specific profile first so later values override earlier ones
+void Settings::ParseProfiles(char* str, NV NameValueCallback, std::string* ProfileName)
+{
+	std::vector<PROFILEVALUE> Values;
+	ParsedValues = &Values;
+	Parse(str, CollectCallback);
+	ParsedValues = nullptr;
+
+	// An executable id match is more specific than a name match
+	const char* Profile = nullptr;
+	for (const auto& Value : Values)
+	{
+		if (Value.Profile && !_stricmp(Value.Profile, GetExecutableId()))
+		{
+			Profile = Value.Profile;
+			break;
+		}
+		if (Value.Profile && !Profile && IsExecutableProfile(Value.Profile))
+		{
+			Profile = Value.Profile;
+		}
+	}
+
+	// Follow the inherited profiles, the last 'Inherit' in a profile wins
+	std::vector<const char*> Chain;
+	while (Profile && Chain.size() < MaxInheritDepth)
+	{
+		Chain.push_back(Profile);
+		const char* Parent = nullptr;
+		for (const auto& Value : Values)
+		{
+			if (Value.Profile && !_stricmp(Value.Profile, Profile) && !_stricmp(Value.name, "Inherit"))
+			{
+				Parent = Value.value;
+			}
+		}
+		Profile = nullptr;
+		if (Parent && HasProfile(Values, Parent) &&
+			std::none_of(Chain.begin(), Chain.end(), [Parent](const char* Name) { return !_stricmp(Name, Parent); }))
+		{
+			Profile = Parent;
+		}
+	}
+
+	for (const auto& Value : Values)
+	{
+		if (!Value.Profile)
+		{
+			NameValueCallback(Value.name, Value.value);
+		}
+	}
+	for (auto it = Chain.rbegin(); it != Chain.rend(); it++)
+	{
+		for (const auto& Value : Values)
+		{
+			if (Value.Profile && !_stricmp(Value.Profile, *it) && _stricmp(Value.name, "Inherit"))
+			{
+				NameValueCallback(Value.name, Value.value);
+			}
+		}
+		if (ProfileName)
+		{
+			ProfileName->append(ProfileName->empty() ? "" : " -> ").append(*it);
+		}
+	}
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <string>
+#include "ReadParse.h"
+
+namespace Settings
+{
+	const char* GetExecutableId();
+	void ParseProfiles(char* str, NV NameValueCallback, std::string* ProfileName);
+}
@@ -21,10 +21,10 @@
 #include <Windows.h>
 #include <stdlib.h>
 #include "ReadParse.h"
+#include "ParseLines.h"
 
 namespace Settings
 {
-	void EraseCppComments(char* str);
 	bool IsValidSettings(char* name, char* value);
 }
 
@@ -81,85 +81,24 @@ bool Settings::IsValidSettings(char* name, char* value)
 	return true;
 }
 
-// Commented text is replaced with a space character
-void Settings::EraseCppComments(char* str)
+void Settings::Parse(char* str, NV NameValueCallback)
 {
-	while ((str = strchr(str, '/')) != 0)
+	ParseLines(str, [NameValueCallback](char*, char* name, char* value)
 	{
-		if (str[1] == '/')
+		if (IsValidSettings(name, value))
 		{
-			for (; ((*str != '\0') && (*str != '\n')); str++)
-			{
-				*str = '\x20';
-			}
+			NameValueCallback(name, value);
 		}
-		else if (str[1] == '*')
-		{
-			for (; ((*str != '\0') && ((str[0] != '*') || (str[1] != '/'))); str++)
-			{
-				*str = '\x20';
-			}
-			if (*str)
-			{
-				*str++ = '\x20';
-				*str = '\x20';
-			}
-		}
-		if (*str)
-		{
-			str++;
-		}
-		else
-		{
-			break;
-		}
-	}
+	});
 }
 
-// [sections] are ignored
-// escape characters NOT support 
-// double quotes NOT suppoted
-// Name/value delimiter is an equal sign or colon 
-// whitespace is removed from before and after both the name and value
-// characters considered to be whitespace:
-//  0x20 - space
-//	0x09 - horizontal tab
-//	0x0D - carriage return
-void Settings::Parse(char* str, NV NameValueCallback)
+void Settings::Parse(char* str, SNV SectionNameValueCallback)
 {
-	char *next_token = nullptr;
-	EraseCppComments(str);
-	for (str = strtok_s(str, "\n", &next_token); str; str = strtok_s(0, "\n", &next_token))
+	ParseLines(str, [SectionNameValueCallback](char* section, char* name, char* value)
 	{
-		if (*str == ';' || *str == '#')
+		if (IsValidSettings(name, value))
 		{
-			continue; // skip INI style comments ( must be at start of line )
+			SectionNameValueCallback(section, name, value);
 		}
-		char* rvalue = strchr(str, '=');
-		if (!rvalue)
-		{
-			rvalue = strchr(str, ':');
-		}
-		if (rvalue)
-		{
-			*rvalue++ = '\0'; // split left and right values
-
-			rvalue = &rvalue[strspn(rvalue, "\x20\t\r")]; // skip beginning whitespace
-			for (char* end = strchr(rvalue, '\0'); (--end >= rvalue) && (*end == '\x20' || *end == '\t' || *end == '\r');)
-			{
-				*end = '\0';  // truncate ending whitespace
-			}
-
-			char* lvalue = &str[strspn(str, "\x20\t\r")]; // skip beginning whitespace
-			for (char* end = strchr(lvalue, '\0'); (--end >= lvalue) && (*end == '\x20' || *end == '\t' || *end == '\r');)
-			{
-				*end = '\0';  // truncate ending whitespace
-			}
-
-			if (*lvalue && *rvalue && IsValidSettings(lvalue, rvalue))
-			{
-				NameValueCallback(lvalue, rvalue);
-			}
-		}
-	}
+	});
 }
@@ -3,6 +3,8 @@
 namespace Settings
 {
 	typedef void(__stdcall* NV)(char* name, char* value);
+	typedef void(__stdcall* SNV)(char* section, char* name, char* value);
 	char* Read(char* szFileName);
 	void Parse(char* str, NV NameValueCallback);
+	void Parse(char* str, SNV SectionNameValueCallback);
 }
@@ -17,6 +17,10 @@
 #include <regex>
 #include <algorithm>
 #include "Settings.h"
+#include "NameHash.h"
+#include "ConfigCache.h"
+#include "LiveConfig.h"
+#include "Profiles.h"
 #include "Dllmain\Dllmain.h"
 #include "Wrappers\wrapper.h"
 #include "Logging\Logging.h"
@@ -27,6 +31,7 @@ namespace Settings
 {
 	// Config
 	bool ConfigLoaded = false;
+	bool ConfigFromCache = false;
 	char configpath[MAX_PATH] = {};
 	char p_wName[MAX_PATH] = {};
 	char p_pName[MAX_PATH] = {};
@@ -54,6 +59,7 @@ namespace Settings
 	void SetValue(char*, char*, double*);
 	void SetValue(char*, char*, bool*);
 	void __stdcall ParseCallback(char*, char*);
+	void __stdcall CacheParseCallback(char*, char*);
 	void SetDefaultConfigSettings();
 	UINT GetWrapperMode(std::string *name);
 }
@@ -69,13 +75,6 @@ namespace Settings
 		return; \
 	}
 
-#define SET_VALUE(functionName) \
-	if (!_stricmp(name, #functionName)) \
-	{ \
-		SetValue(name, value, &Config.functionName); \
-		return; \
-	}
-
 #define SET_APPCOMPATDATA_VALUE(functionName) \
 	if (!_stricmp(name, #functionName)) \
 	{ \
@@ -83,6 +82,12 @@ namespace Settings
 		return; \
 	}
 
+#define CONFIG_NAME(functionName) \
+	#functionName,
+
+#define CONFIG_SETTER(functionName) \
+	[](char* name, char* value) { SetValue(name, value, &Config.functionName); },
+
 #define CLEAR_VALUE(functionName) \
 	ClearValue(&Config.functionName);
 
@@ -270,6 +275,32 @@ void Settings::SetValue(char* name, char* value, bool* setting)
 	}
 }
 
+namespace Settings
+{
+	// Config settings are looked up by name with a perfect hash instead of comparing every name, the hash is built at startup
+	const char* const ConfigSettingNames[] = { VISIT_CONFIG_SETTINGS(CONFIG_NAME) };
+	const NAMEHASH<_countof(ConfigSettingNames)> ConfigSettingHash(ConfigSettingNames);
+
+	void(*const ConfigSettingSetters[])(char*, char*) = { VISIT_CONFIG_SETTINGS(CONFIG_SETTER) };
+
+	// Returns the index of a config setting or -1, compares every name if the hash could not be built (duplicate names)
+	int FindConfigSetting(const char* name)
+	{
+		if (ConfigSettingHash.IsValid)
+		{
+			return ConfigSettingHash.Find(name);
+		}
+		for (int x = 0; x < _countof(ConfigSettingNames); x++)
+		{
+			if (!_stricmp(name, ConfigSettingNames[x]))
+			{
+				return x;
+			}
+		}
+		return -1;
+	}
+}
+
 // Set config from string (file)
 void __stdcall Settings::ParseCallback(char* name, char* value)
 {
@@ -283,7 +314,12 @@ void __stdcall Settings::ParseCallback(char* name, char* value)
 	VISIT_LOCAL_SETTINGS(SET_LOCAL_VALUE);
 
 	// Set Value of normal config settings
-	VISIT_CONFIG_SETTINGS(SET_VALUE);
+	const int Index = FindConfigSetting(name);
+	if (Index >= 0)
+	{
+		ConfigSettingSetters[Index](name, value);
+		return;
+	}
 
 	// Set Value of AppCompatData LockColorkey setting
 	if (!_stricmp(name, "LockColorkey"))
@@ -332,6 +368,13 @@ void __stdcall Settings::ParseCallback(char* name, char* value)
 	Logging::Log() << "Warning. Config setting not recognized: " << name;
 }
 
+// Set config from string (file) and remember the value for the config cache
+void __stdcall Settings::CacheParseCallback(char* name, char* value)
+{
+	AddConfigCacheValue(name, value);
+	ParseCallback(name, value);
+}
+
 // Clear pointers
 void Settings::ClearValue(void** setting)
 {
@@ -507,6 +550,25 @@ void CONFIG::Init()
 	strcat_s(configpath, MAX_PATH, p_pName);
 	strcpy_s(strrchr(configpath, '.'), MAX_PATH - strlen(configpath), ".ini");
 
+	// Get default config and cache paths
+	char defaultpath[MAX_PATH];
+	strcpy_s(defaultpath, MAX_PATH, wrappername);
+	strcpy_s(strrchr(defaultpath, '.'), MAX_PATH - strlen(defaultpath), ".ini");
+	char cachepath[MAX_PATH];
+	strcpy_s(cachepath, MAX_PATH, configpath);
+	strcpy_s(strrchr(cachepath, '.'), MAX_PATH - strlen(cachepath), ".cache");
+	// The executable is a source too, the profile chosen for it depends on its name and build
+	const std::vector<std::string> ConfigSources = { configpath, defaultpath, processname };
+	ConfigProfile.clear();
+
+	// Use the cached settings if none of the config files changed since the cache was written
+	if (ReadConfigCache(cachepath, ConfigSources, configpath, ConfigProfile, ParseCallback))
+	{
+		ConfigLoaded = true;
+		ConfigFromCache = true;
+		return;
+	}
+
 	// Read defualt config file
 	char* szCfg = Read(configpath);
 
@@ -514,15 +576,14 @@ void CONFIG::Init()
 	if (szCfg)
 	{
 		ConfigLoaded = true;
-		Parse(szCfg, ParseCallback);
+		ParseProfiles(szCfg, CacheParseCallback, &ConfigProfile);
 		free(szCfg);
 	}
 	// If cannot load config file check for default config
 	else
 	{
 		// Get config file path
-		strcpy_s(configpath, MAX_PATH, wrappername);
-		strcpy_s(strrchr(configpath, '.'), MAX_PATH - strlen(configpath), ".ini");
+		strcpy_s(configpath, MAX_PATH, defaultpath);
 
 		// Open config file
 		szCfg = Read(configpath);
@@ -531,10 +592,20 @@ void CONFIG::Init()
 		if (szCfg)
 		{
 			ConfigLoaded = true;
-			Parse(szCfg, ParseCallback);
+			ParseProfiles(szCfg, CacheParseCallback, &ConfigProfile);
 			free(szCfg);
 		}
 	}
+
+	// Update the config cache
+	if (ConfigCache && ConfigLoaded)
+	{
+		WriteConfigCache(cachepath, ConfigSources, configpath, ConfigProfile);
+	}
+	else
+	{
+		DeleteConfigCache(cachepath);
+	}
 }
 
 void CONFIG::SetConfig()
@@ -544,7 +615,8 @@ void CONFIG::SetConfig()
 	// If config file was read
 	if (ConfigLoaded)
 	{
-		Logging::Log() << "Reading config file: " << configpath;
+		Logging::Log() << "Reading config file: " << configpath << (ConfigFromCache ? " (cached)" : "");
+		Logging::Log() << "Executable id: " << GetExecutableId() << " using profile: " << (ConfigProfile.size() ? ConfigProfile.c_str() : "base");
 	}
 	else
 	{
@@ -714,4 +786,10 @@ void CONFIG::SetConfig()
 	// Set unset options
 	DdrawResolutionHack = (DdrawResolutionHack != 0);
 	CacheClipPlane = (CacheClipPlane != 0);
+
+	// Watch the config file for changes to the live settings
+	if (LiveConfigReload && ConfigLoaded)
+	{
+		StartLiveConfig(configpath);
+	}
 }
@@ -25,6 +25,7 @@
 	visit(DDrawCompat31) \
 	visit(DDrawCompatDisableGDIHook) \
 	visit(DDrawCompatNoProcAffinity) \
+	visit(DDrawCompatCopyBudget) \
 	visit(DdrawClippedWidth) \
 	visit(DdrawClippedHeight) \
 	visit(DdrawRemoveScanlines) \
@@ -36,6 +37,7 @@
 	visit(DdrawIntegerScalingClamp) \
 	visit(DdrawLimitDisplayModeCount) \
 	visit(DdrawMaintainAspectRatio) \
+	visit(DdrawCaptureFrames) \
 	visit(DdrawOverrideBitMode) \
 	visit(DdrawOverrideWidth) \
 	visit(DdrawOverrideHeight) \
@@ -48,12 +50,22 @@
 	visit(DdrawHookSystem32) \
 	visit(D3d8HookSystem32) \
 	visit(D3d9HookSystem32) \
+	visit(D3d9ShaderCache) \
+	visit(D3d9WrapperPoolSize) \
 	visit(DinputHookSystem32) \
 	visit(Dinput8HookSystem32) \
 	visit(DsoundHookSystem32) \
 	visit(DisableGameUX) \
 	visit(DisableHighDPIScaling) \
+	visit(ConfigCache) \
+	visit(LiveConfigReload) \
 	visit(DisableLogging) \
+	visit(LogLevel) \
+	visit(AsyncLogging) \
+	visit(BinaryTrace) \
+	visit(CallStatsInterval) \
+	visit(ChromeTraceFrames) \
+	visit(ChromeTraceKey) \
 	visit(DirectShowEmulation) \
 	visit(DSoundCtrl) \
 	visit(DxWnd) \
@@ -199,6 +211,7 @@ struct CONFIG
 	bool DDrawCompat31 = false;					// Enables DDrawCompat v0.3.1
 	bool DDrawCompatDisableGDIHook = false;		// Disables DDrawCompat GDI hooks
 	bool DDrawCompatNoProcAffinity = false;		// Disables DDrawCompat single processor affinity
+	DWORD DDrawCompatCopyBudget = 0;			// Megabytes of system memory surface copies that only duplicate video memory, 0 is unlimited
 	bool DdrawFixByteAlignment = false;			// Fixes lock with surfaces that have unaligned byte sizes
 	DWORD DdrawResolutionHack = 0;				// Removes the artificial resolution limit from Direct3D7 and below https://github.com/UCyborg/LegacyD3DResolutionHack
 	bool DdrawRemoveScanlines = 0;				// Experimental feature to removing interlaced black lines in a single frame
@@ -208,6 +221,7 @@ struct CONFIG
 	bool DdrawWriteToGDI = false;				// Blt surface directly to GDI rather than Direct3D9
 	bool DdrawIntegerScalingClamp = false;		// Scales the screen by an integer value to help preserve video quality
 	bool DdrawMaintainAspectRatio = false;		// Keeps the current DirectDraw aspect ratio when overriding the game's resolution
+	DWORD DdrawCaptureFrames = 0;				// Captures the Dd7to9 surface, render state, texture and draw calls of n frames to a .capture file next to the log for ddraw\CaptureReplay, 0 disables
 	bool DdrawUseDirect3D9Ex = false;			// Use Direct3D9Ex extensions for Dd7to9
 	bool DdrawUseNativeResolution = false;		// Uses the current screen resolution for Dd7to9
 	DWORD DdrawClippedWidth = 0;				// Used to scaled Direct3d9 to use this width when using Dd7to9
@@ -222,13 +236,23 @@ struct CONFIG
 	DWORD DdrawHookSystem32 = 0;				// Hooks the ddraw.dll file in the Windows System32 folder
 	DWORD D3d8HookSystem32 = 0;					// Hooks the d3d8.dll file in the Windows System32 folder
 	DWORD D3d9HookSystem32 = 0;					// Hooks the d3d9.dll file in the Windows System32 folder
+	bool D3d9ShaderCache = false;				// Shares one d3d9 shader between creates with identical bytecode
+	DWORD D3d9WrapperPoolSize = 0;				// Number of released d3d9 wrapper objects kept per type for reuse
 	DWORD DinputHookSystem32 = 0;				// Hooks the dinput.dll file in the Windows System32 folder
 	DWORD Dinput8HookSystem32 = 0;				// Hooks the dinput8.dll file in the Windows System32 folder
 	DWORD DsoundHookSystem32 = 0;				// Hooks the dsound.dll file in the Windows System32 folder
 	bool DirectShowEmulation = false;			// Emulates DirectShow APIs
 	bool DisableGameUX = false;					// Disables the Microsoft Game Explorer which can sometimes cause high CPU in rundll32.exe and hang the game process
 	bool DisableHighDPIScaling = false;			// Disables display scaling on high DPI settings
+	bool ConfigCache = false;					// Keeps the parsed settings in a binary .cache file next to the config and reuses them until a config file changes
+	bool LiveConfigReload = false;				// Watches the config file and applies changes to AutoFrameSkip, DdrawRemoveScanlines, LoopSleepTime and AudioFadeOutDelayMS without restarting
 	bool DisableLogging = false;				// Disables the logging file
+	DWORD LogLevel = 0;						// Lowest level written to the log: 0 = debug, 1 = info, debug lines are only built into debug builds
+	DWORD AsyncLogging = 0;						// Writes the log file from a background thread: 1 = drop lines when the buffer is full, 2 = wait for space
+	bool BinaryTrace = false;					// Writes traced API calls to a binary .trace file next to the log, decode it with Logging\TraceDecoder
+	DWORD CallStatsInterval = 0;				// Writes per-method call counts and latency histograms to a .csv file next to the log every n seconds, 0 disables
+	DWORD ChromeTraceFrames = 0;				// Records wrapper calls for n frames to a Chrome trace-event .json file next to the log, 0 disables
+	DWORD ChromeTraceKey = 0;					// Virtual key code that starts a Chrome trace recording, 0 records the first frames after launch
 	bool DSoundCtrl = false;					// Enables DirectSoundControl https://github.com/nRaecheR/DirectSoundControl
 	bool DxWnd = false;							// Enables DxWnd https://sourceforge.net/projects/dxwnd/
 	DWORD CacheClipPlane = 0;					// Caches the ClipPlane for Direct3D9 to fix an issue in d3d9 on Windows 8 and newer
@@ -274,6 +298,7 @@ struct CONFIG
 	std::string RunProcess;						// Process to run on load
 	std::string WrapperMode;					// Mode of dxwrapper from config file
 	std::string WrapperName;					// dxwrapper dll filename
+	std::string ConfigProfile;					// Profiles applied on top of the base profile, least specific first
 	std::vector<std::string> SetNamedLayer;		// List of named layers to select for fullscreen
 	std::vector<std::string> IgnoreWindowName;	// List of window classes to ignore
 	std::vector<std::string> LoadCustomDllPath;	// List of custom dlls to load
@@ -0,0 +1,62 @@
+/**
+* Copyright (C) 2022 Elisha Riedlinger
+*
+* This software is  provided 'as-is', without any express  or implied  warranty. In no event will the
+* authors be held liable for any damages arising from the use of this software.
+* Permission  is granted  to anyone  to use  this software  for  any  purpose,  including  commercial
+* applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*   1. The origin of this software must not be misrepresented; you must not claim that you  wrote the
+*      original  software. If you use this  software  in a product, an  acknowledgment in the product
+*      documentation would be appreciated but is not required.
+*   2. Altered source versions must  be plainly  marked as such, and  must not be  misrepresented  as
+*      being the original software.
+*   3. This notice may not be removed or altered from any source distribution.
+*
+* Shared setup of the bundled disassembler. The exception handler and the DDrawCompat hooks both decode
+* instructions, and Preparedisasm/Finishdisasm work on the same global tables. Disasm itself only reads
+* them, so only preparing and freeing the tables needs the lock.
+*/
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+extern "C"
+{
+#include "Disasm\disasm.h"
+}
+#include "Disassembler.h"
+
+namespace
+{
+	SRWLOCK DisasmLock = SRWLOCK_INIT;
+	ULONG DisasmRefCount = 0;
+}
+
+// Prepares the command tables for the first user, returns false if they could not be allocated
+bool Utils::AcquireDisassembler()
+{
+	AcquireSRWLockExclusive(&DisasmLock);
+	bool Result = true;
+	if (DisasmRefCount == 0 && Preparedisasm() != 0)
+	{
+		Finishdisasm();
+		Result = false;
+	}
+	else
+	{
+		DisasmRefCount++;
+	}
+	ReleaseSRWLockExclusive(&DisasmLock);
+	return Result;
+}
+
+// Frees the command tables when the last user is done
+void Utils::ReleaseDisassembler()
+{
+	AcquireSRWLockExclusive(&DisasmLock);
+	if (DisasmRefCount != 0 && --DisasmRefCount == 0)
+	{
+		Finishdisasm();
+	}
+	ReleaseSRWLockExclusive(&DisasmLock);
+}
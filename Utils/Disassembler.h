@@ -0,0 +1,9 @@
+#pragma once
+
+namespace Utils
+{
+	// The bundled disassembler keeps its command tables in globals. Each user holds a reference while it
+	// decodes instructions, so the tables are only freed once the last user releases them.
+	bool AcquireDisassembler();
+	void ReleaseDisassembler();
+}
@@ -0,0 +1,169 @@
+/**
+* Copyright (C) 2022 Elisha Riedlinger
+*
+* This software is  provided 'as-is', without any express  or implied  warranty. In no event will the
+* authors be held liable for any damages arising from the use of this software.
+* Permission  is granted  to anyone  to use  this software  for  any  purpose,  including  commercial
+* applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*   1. The origin of this software must not be misrepresented; you must not claim that you  wrote the
+*      original  software. If you use this  software  in a product, an  acknowledgment in the product
+*      documentation would be appreciated but is not required.
+*   2. Altered source versions must  be plainly  marked as such, and  must not be  misrepresented  as
+*      being the original software.
+*   3. This notice may not be removed or altered from any source distribution.
+*
+* Checks the instruction lengths the bundled disassembler returns for a corpus of x86 function prologues,
+* decoded the way the DDrawCompat hooks size their detours: one instruction at a time until at least 5
+* bytes are covered. Disasm is plain C, so it builds off-tree:
+*   gcc -O2 -c ../../Disasm/Disasm.c ../../Disasm/cmdlist.c
+*   g++ -std=c++17 -O2 -o disassemblertest DisassemblerTest.cpp Disasm.o cmdlist.o
+*   cl /std:c++17 /EHsc /O2 DisassemblerTest.cpp ..\..\Disasm\Disasm.c ..\..\Disasm\cmdlist.c
+*
+* Usage: disassemblertest
+*/
+
+#include <cstdio>
+#include <vector>
+#include <cctype>
+extern "C"
+{
+#include "../../Disasm/disasm.h"
+
+#ifndef _WIN32
+	// Disasm.c uses the Windows CRT strlwr when it formats text
+	char *strlwr(char *s)
+	{
+		for (char *p = s; *p; p++)
+		{
+			*p = static_cast<char>(std::tolower(static_cast<unsigned char>(*p)));
+		}
+		return s;
+	}
+#endif
+}
+
+namespace
+{
+	struct PROLOGUE
+	{
+		const char *Name;
+		std::vector<uchar> Bytes;
+		std::vector<unsigned> Lengths;		// Instructions the hook has to move to the trampoline
+	};
+
+	const PROLOGUE Corpus[] = {
+		{ "hot-patchable frame", { 0x8B, 0xFF, 0x55, 0x8B, 0xEC, 0x83, 0xEC, 0x10 }, { 2, 1, 2 } },
+		{ "frame with locals", { 0x55, 0x8B, 0xEC, 0x83, 0xEC, 0x10 }, { 1, 2, 3 } },
+		{ "frame with seh", { 0x55, 0x8B, 0xEC, 0x6A, 0xFF, 0x68, 0x10, 0x20, 0x30, 0x40 }, { 1, 2, 2 } },
+		{ "seh prolog call", { 0x6A, 0x10, 0x68, 0x10, 0x20, 0x30, 0x40 }, { 2, 5 } },
+		{ "fpo argument load", { 0x8B, 0x44, 0x24, 0x04, 0x56, 0x57 }, { 4, 1 } },
+		{ "fpo locals", { 0x83, 0xEC, 0x0C, 0x56, 0x57 }, { 3, 1, 1 } },
+		{ "large stack frame", { 0x81, 0xEC, 0x00, 0x01, 0x00, 0x00 }, { 6 } },
+		{ "saved registers", { 0x53, 0x56, 0x57, 0x8B, 0x7C, 0x24, 0x10 }, { 1, 1, 1, 4 } },
+		{ "import thunk", { 0xFF, 0x25, 0x10, 0x20, 0x30, 0x40 }, { 6 } },
+		{ "jump thunk", { 0xE9, 0x10, 0x20, 0x30, 0x40 }, { 5 } },
+		{ "fs segment load", { 0x64, 0xA1, 0x00, 0x00, 0x00, 0x00 }, { 6 } },
+		{ "immediate load", { 0xB8, 0x01, 0x00, 0x00, 0x00 }, { 5 } },
+		{ "aligned stack", { 0x8D, 0x4C, 0x24, 0x04, 0x83, 0xE4, 0xF0 }, { 4, 3 } },
+		{ "zero and return", { 0x33, 0xC0, 0xC2, 0x04, 0x00 }, { 2, 3 } },
+		{ "global load", { 0x8B, 0x0D, 0x10, 0x20, 0x30, 0x40 }, { 6 } },
+		{ "sse load", { 0x66, 0x0F, 0x6F, 0x05, 0x10, 0x20, 0x30, 0x40 }, { 8 } },
+		{ "scalar float load", { 0xF3, 0x0F, 0x10, 0x44, 0x24, 0x04 }, { 6 } },
+		{ "zero extension", { 0x0F, 0xB6, 0x44, 0x24, 0x04 }, { 5 } },
+		{ "operand size prefix", { 0x66, 0x8B, 0x44, 0x24, 0x04 }, { 5 } },
+		{ "sib with displacement", { 0x8B, 0x84, 0x24, 0x00, 0x01, 0x00, 0x00 }, { 7 } },
+	};
+
+	// Same call and error mask as getInstructionSize in DDrawCompat's Hook.cpp
+	unsigned GetInstructionSize(const uchar *Instruction, ulong Size)
+	{
+		t_disasm da = {};
+		ulong Length = Disasm(Instruction, Size, reinterpret_cast<ulong>(Instruction), &da, 0, nullptr, nullptr);
+		if (Length == 0 || (da.errors & (DAE_BADCMD | DAE_CROSS | DAE_INTERN)) != 0)
+		{
+			return 0;
+		}
+		return Length;
+	}
+
+	bool CheckPrologue(const PROLOGUE &Prologue)
+	{
+		// Pad with int3 like the end of a function, so a decoder reading too far does not find a real instruction
+		std::vector<uchar> Code(Prologue.Bytes);
+		Code.resize(Code.size() + 15, 0xCC);
+
+		std::vector<unsigned> Lengths;
+		unsigned Total = 0;
+		while (Total < 5)
+		{
+			unsigned Length = GetInstructionSize(Code.data() + Total, 15);
+			if (Length == 0)
+			{
+				break;
+			}
+			Lengths.push_back(Length);
+			Total += Length;
+		}
+
+		if (Lengths == Prologue.Lengths)
+		{
+			return true;
+		}
+		std::printf("FAILED %s: got", Prologue.Name);
+		for (unsigned Length : Lengths)
+		{
+			std::printf(" %u", Length);
+		}
+		std::printf(", expected");
+		for (unsigned Length : Prologue.Lengths)
+		{
+			std::printf(" %u", Length);
+		}
+		std::printf("\n");
+		return false;
+	}
+}
+
+int main()
+{
+	int Failures = 0;
+	if (Preparedisasm() != 0)
+	{
+		std::printf("FAILED to prepare the command tables\n");
+		return 1;
+	}
+
+	for (const PROLOGUE &Prologue : Corpus)
+	{
+		Failures += CheckPrologue(Prologue) ? 0 : 1;
+	}
+
+	// Undefined opcodes and truncated instructions must not be moved to a trampoline
+	const uchar BadOpcode[] = { 0xFF, 0xFF, 0xCC, 0xCC, 0xCC };
+	const uchar Truncated[] = { 0xE9, 0x10, 0x20 };
+	if (GetInstructionSize(BadOpcode, sizeof(BadOpcode)) != 0 || GetInstructionSize(Truncated, sizeof(Truncated)) != 0)
+	{
+		std::printf("FAILED bad instruction was decoded\n");
+		Failures++;
+	}
+
+	// Freeing the tables while another user still decodes was the Hook.cpp/UnHookExceptionHandler bug;
+	// Disasm must fail instead of reading freed tables, and preparing again must work
+	Finishdisasm();
+	const uchar Push[] = { 0x55, 0xCC, 0xCC, 0xCC, 0xCC };
+	if (GetInstructionSize(Push, sizeof(Push)) != 0 || Preparedisasm() != 0 || GetInstructionSize(Push, sizeof(Push)) != 1)
+	{
+		std::printf("FAILED decoding around Finishdisasm\n");
+		Failures++;
+	}
+	Finishdisasm();
+
+	if (Failures != 0)
+	{
+		std::printf("%d of %zu checks failed\n", Failures, sizeof(Corpus) / sizeof(Corpus[0]) + 2);
+		return 1;
+	}
+	std::printf("All %zu checks passed\n", sizeof(Corpus) / sizeof(Corpus[0]) + 2);
+	return 0;
+}
@@ -15,6 +15,7 @@
 */
 
 #include "Settings\Settings.h"
+#include "Settings\LiveConfig.h"
 #include "Dllmain\Dllmain.h"
 #include "Utils.h"
 #include "Logging\Logging.h"
@@ -659,7 +660,7 @@ void Fullscreen::CheckForTermination(DWORD m_ProcessId)
 	{
 		// Check for number of loops and wait time before terminating application
 		if ((++countAttempts > TerminationCount) &&							// Minimum number of loops
-			(countAttempts * Config.LoopSleepTime > TerminationWaitTime))	// Minimum time to wait
+			(countAttempts * LIVE_CONFIG(LoopSleepTime) > TerminationWaitTime))	// Minimum time to wait
 		{
 			Logging::Log() << "Process not exiting, attempting to terminate process...";
 
@@ -1002,7 +1003,7 @@ void Fullscreen::MainFunc()
 #endif
 
 		// Wait for a while
-		Sleep(Config.LoopSleepTime + (ChangeDetectedFlag * Config.WaitForWindowChanges * Config.WindowSleepTime));
+		Sleep(LIVE_CONFIG(LoopSleepTime) + (ChangeDetectedFlag * Config.WaitForWindowChanges * Config.WindowSleepTime));
 
 	} // Main while loop
 }
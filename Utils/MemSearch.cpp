@@ -0,0 +1,202 @@
+/**
+* Copyright (C) 2022 Elisha Riedlinger
+*
+* This software is  provided 'as-is', without any express  or implied  warranty. In no event will the
+* authors be held liable for any damages arising from the use of this software.
+* Permission  is granted  to anyone  to use  this software  for  any  purpose,  including  commercial
+* applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*   1. The origin of this software must not be misrepresented; you must not claim that you  wrote the
+*      original  software. If you use this  software  in a product, an  acknowledgment in the product
+*      documentation would be appreciated but is not required.
+*   2. Altered source versions must  be plainly  marked as such, and  must not be  misrepresented  as
+*      being the original software.
+*   3. This notice may not be removed or altered from any source distribution.
+*
+* Byte pattern search used to find code to patch. Candidate positions are found 16 at a time by comparing
+* the first and last byte of the pattern with SSE2 and only those are compared in full. Long patterns and
+* the end of the buffer use Boyer-Moore-Horspool.
+*/
+
+#include <cstring>
+#include <cstdint>
+#include <vector>
+#include "MemSearch.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MEMSEARCH_SSE2
+#include <emmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+namespace
+{
+	// Horspool skips far enough with patterns this long to be faster than the filter
+	constexpr size_t LongPattern = 64;
+
+	const char *FindHorspool(const char *l, size_t l_len, const char *s, size_t s_len)
+	{
+		if (l_len < s_len)
+		{
+			return nullptr;
+		}
+
+		size_t Skip[256];
+		for (size_t &Value : Skip)
+		{
+			Value = s_len;
+		}
+		for (size_t x = 0; x < s_len - 1; x++)
+		{
+			Skip[(uint8_t)s[x]] = s_len - 1 - x;
+		}
+
+		const char Last = s[s_len - 1];
+		const char *End = l + l_len - s_len;
+		for (const char *cur = l; cur <= End; cur += Skip[(uint8_t)cur[s_len - 1]])
+		{
+			if (cur[s_len - 1] == Last && !memcmp(cur, s, s_len - 1))
+			{
+				return cur;
+			}
+		}
+		return nullptr;
+	}
+
+	const char *FindPattern(const char *l, size_t l_len, const char *s, size_t s_len)
+	{
+		if (!l_len || !s_len || l_len < s_len)
+		{
+			return nullptr;
+		}
+		if (s_len == 1)
+		{
+			return (const char*)memchr(l, *s, l_len);
+		}
+
+		size_t pos = 0;
+#ifdef MEMSEARCH_SSE2
+		if (s_len < LongPattern)
+		{
+			const __m128i First = _mm_set1_epi8(s[0]);
+			const __m128i Last = _mm_set1_epi8(s[s_len - 1]);
+			for (; pos + s_len + 15 <= l_len; pos += 16)
+			{
+				const __m128i BlockFirst = _mm_loadu_si128((const __m128i*)(l + pos));
+				const __m128i BlockLast = _mm_loadu_si128((const __m128i*)(l + pos + s_len - 1));
+				unsigned Mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(First, BlockFirst), _mm_cmpeq_epi8(Last, BlockLast)));
+				while (Mask)
+				{
+#ifdef _MSC_VER
+					unsigned long Bit;
+					_BitScanForward(&Bit, Mask);
+#else
+					const unsigned Bit = __builtin_ctz(Mask);
+#endif
+					if (!memcmp(l + pos + Bit + 1, s + 1, s_len - 2))
+					{
+						return l + pos + Bit;
+					}
+					Mask &= Mask - 1;
+				}
+			}
+		}
+#endif
+		return FindHorspool(l + pos, l_len - pos, s, s_len);
+	}
+}
+
+// Searches the memory
+void *Utils::memmem(const void *l, size_t l_len, const void *s, size_t s_len)
+{
+	return (void*)FindPattern((const char*)l, l_len, (const char*)s, s_len);
+}
+
+// Searches the memory for several patterns in one pass, returns the number of patterns found
+size_t Utils::memmem(const void *l, size_t l_len, MEMPATTERN *Patterns, size_t Count)
+{
+	const char *cl = (const char*)l;
+	size_t FoundCount = 0;
+	std::vector<size_t> Filtered;
+
+	for (size_t x = 0; x < Count; x++)
+	{
+		MEMPATTERN &Pattern = Patterns[x];
+		Pattern.Found = nullptr;
+#ifdef MEMSEARCH_SSE2
+		if (Pattern.Size >= 2 && Pattern.Size < LongPattern && Pattern.Size <= l_len)
+		{
+			Filtered.push_back(x);
+			continue;
+		}
+#endif
+		Pattern.Found = FindPattern(cl, l_len, (const char*)Pattern.Bytes, Pattern.Size);
+		FoundCount += (Pattern.Found != nullptr);
+	}
+
+#ifdef MEMSEARCH_SSE2
+	// Patterns are filtered in groups so their first and last bytes stay in registers
+	constexpr size_t GroupSize = 8;
+	for (size_t Group = 0; Group < Filtered.size(); Group += GroupSize)
+	{
+		__m128i First[GroupSize], Last[GroupSize];
+		MEMPATTERN *Active[GroupSize];
+		size_t ActiveCount = 0, MaxSize = 0;
+		for (size_t x = Group; x < Filtered.size() && x < Group + GroupSize; x++)
+		{
+			MEMPATTERN &Pattern = Patterns[Filtered[x]];
+			First[ActiveCount] = _mm_set1_epi8(((const char*)Pattern.Bytes)[0]);
+			Last[ActiveCount] = _mm_set1_epi8(((const char*)Pattern.Bytes)[Pattern.Size - 1]);
+			Active[ActiveCount++] = &Pattern;
+			MaxSize = (Pattern.Size > MaxSize) ? Pattern.Size : MaxSize;
+		}
+
+		size_t pos = 0;
+		for (; ActiveCount && pos + MaxSize + 15 <= l_len; pos += 16)
+		{
+			const __m128i BlockFirst = _mm_loadu_si128((const __m128i*)(cl + pos));
+			for (size_t x = 0; x < ActiveCount; x++)
+			{
+				MEMPATTERN &Pattern = *Active[x];
+				const __m128i BlockLast = _mm_loadu_si128((const __m128i*)(cl + pos + Pattern.Size - 1));
+				unsigned Mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(First[x], BlockFirst), _mm_cmpeq_epi8(Last[x], BlockLast)));
+				while (Mask)
+				{
+#ifdef _MSC_VER
+					unsigned long Bit;
+					_BitScanForward(&Bit, Mask);
+#else
+					const unsigned Bit = __builtin_ctz(Mask);
+#endif
+					if (!memcmp(cl + pos + Bit + 1, (const char*)Pattern.Bytes + 1, Pattern.Size - 2))
+					{
+						Pattern.Found = cl + pos + Bit;
+						break;
+					}
+					Mask &= Mask - 1;
+				}
+				if (Pattern.Found)
+				{
+					FoundCount++;
+					ActiveCount--;
+					First[x] = First[ActiveCount];
+					Last[x] = Last[ActiveCount];
+					Active[x--] = Active[ActiveCount];
+				}
+			}
+		}
+
+		// Every position before pos has been checked for the patterns that are left
+		for (size_t x = 0; x < ActiveCount; x++)
+		{
+			MEMPATTERN &Pattern = *Active[x];
+			Pattern.Found = FindPattern(cl + pos, l_len - pos, (const char*)Pattern.Bytes, Pattern.Size);
+			FoundCount += (Pattern.Found != nullptr);
+		}
+	}
+#endif
+
+	return FoundCount;
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Utils
+{
+	struct MEMPATTERN
+	{
+		const void *Bytes;
+		size_t Size;
+		const void *Found;		// First match or nullptr, set by memmem
+	};
+
+	void *memmem(const void *l, size_t l_len, const void *s, size_t s_len);
+	size_t memmem(const void *l, size_t l_len, MEMPATTERN *Patterns, size_t Count);
+}
@@ -0,0 +1,239 @@
+/**
+* Copyright (C) 2022 Elisha Riedlinger
+*
+* This software is  provided 'as-is', without any express  or implied  warranty. In no event will the
+* authors be held liable for any damages arising from the use of this software.
+* Permission  is granted  to anyone  to use  this software  for  any  purpose,  including  commercial
+* applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*   1. The origin of this software must not be misrepresented; you must not claim that you  wrote the
+*      original  software. If you use this  software  in a product, an  acknowledgment in the product
+*      documentation would be appreciated but is not required.
+*   2. Altered source versions must  be plainly  marked as such, and  must not be  misrepresented  as
+*      being the original software.
+*   3. This notice may not be removed or altered from any source distribution.
+*
+* Checks Utils::memmem and its multi-pattern overload against std::search on random inputs, then times
+* them against the byte by byte search memmem replaced on a buffer of x86-like bytes with the only matches
+* near the end. Standalone, builds on Windows and Linux:
+*   g++ -std=c++17 -O2 -o memsearchbench MemSearchBench.cpp ../MemSearch.cpp
+*   cl /std:c++17 /EHsc /O2 MemSearchBench.cpp ..\MemSearch.cpp
+*
+* Usage: memsearchbench [MB to search]
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "../MemSearch.h"
+
+// The search Utils::memmem used before, compares at every byte
+static void *NaiveMemmem(const void *l, size_t l_len, const void *s, size_t s_len)
+{
+	const char *cl = (const char*)l;
+	const char *cs = (const char*)s;
+	if (!l_len || !s_len || l_len < s_len)
+	{
+		return nullptr;
+	}
+	if (s_len == 1)
+	{
+		return (void*)memchr(l, (int)*cs, l_len);
+	}
+	const char *last = cl + l_len - s_len;
+	for (const char *cur = cl; cur <= last; cur++)
+	{
+		if (cur[0] == cs[0] && !memcmp(cur, cs, s_len))
+		{
+			return (void*)cur;
+		}
+	}
+	return nullptr;
+}
+
+// First match by std::search, which is what both memmem overloads must find
+static const char *Search(const std::vector<char> &Buffer, const std::vector<char> &Pattern)
+{
+	if (Buffer.size() < Pattern.size())
+	{
+		return nullptr;
+	}
+	const auto Match = std::search(Buffer.begin(), Buffer.end(), Pattern.begin(), Pattern.end());
+	return (Match == Buffer.end()) ? nullptr : Buffer.data() + (Match - Buffer.begin());
+}
+
+// Small alphabets make partial matches likely, so the candidate checks and the buffer tail get exercised
+static bool Fuzz(std::mt19937 &Rng, int Iterations)
+{
+	for (int x = 0; x < Iterations; x++)
+	{
+		const size_t Size = Rng() % 200, PatternSize = 1 + Rng() % 80;
+		const int Alphabet = 1 + Rng() % 4;
+		std::vector<char> Buffer(Size), Pattern(PatternSize);
+		for (char &c : Buffer)
+		{
+			c = (char)('a' + Rng() % Alphabet);
+		}
+		for (char &c : Pattern)
+		{
+			c = (char)('a' + Rng() % Alphabet);
+		}
+		if (Size >= PatternSize && Rng() % 2)
+		{
+			memcpy(Buffer.data() + Rng() % (Size - PatternSize + 1), Pattern.data(), PatternSize);
+		}
+
+		if (Utils::memmem(Buffer.data(), Size, Pattern.data(), PatternSize) != Search(Buffer, Pattern))
+		{
+			printf("FAILED buffer size %zu, pattern size %zu\n", Size, PatternSize);
+			return false;
+		}
+	}
+	return true;
+}
+
+// More patterns than one filter group holds, some of them long enough for Horspool
+static bool FuzzMulti(std::mt19937 &Rng, int Iterations)
+{
+	for (int x = 0; x < Iterations; x++)
+	{
+		const size_t Size = Rng() % 300, Count = 1 + Rng() % 20;
+		const int Alphabet = 1 + Rng() % 4;
+		std::vector<char> Buffer(Size);
+		for (char &c : Buffer)
+		{
+			c = (char)('a' + Rng() % Alphabet);
+		}
+
+		std::vector<std::vector<char>> Patterns(Count);
+		std::vector<Utils::MEMPATTERN> MemPatterns(Count);
+		size_t Expected = 0;
+		for (size_t y = 0; y < Count; y++)
+		{
+			std::vector<char> &Pattern = Patterns[y];
+			Pattern.resize((Rng() % 8) ? 1 + Rng() % 24 : 1 + Rng() % 80);
+			for (char &c : Pattern)
+			{
+				c = (char)('a' + Rng() % Alphabet);
+			}
+			if (Size >= Pattern.size() && Rng() % 2)
+			{
+				memcpy(Buffer.data() + Rng() % (Size - Pattern.size() + 1), Pattern.data(), Pattern.size());
+			}
+			MemPatterns[y] = { Pattern.data(), Pattern.size(), (const void*)1 };
+		}
+		for (const auto &Pattern : Patterns)
+		{
+			Expected += (Search(Buffer, Pattern) != nullptr);
+		}
+
+		const size_t Found = Utils::memmem(Buffer.data(), Size, MemPatterns.data(), Count);
+		bool Match = (Found == Expected);
+		for (size_t y = 0; Match && y < Count; y++)
+		{
+			Match = (MemPatterns[y].Found == Search(Buffer, Patterns[y]));
+		}
+		if (!Match)
+		{
+			printf("FAILED buffer size %zu, %zu patterns\n", Size, Count);
+			return false;
+		}
+	}
+	return true;
+}
+
+// Results of searches that are not returned, so the compiler can't drop them
+static const void *volatile Sink = nullptr;
+
+// The buffer is read through a volatile pointer and every result is kept, otherwise the compiler may search only once
+template <typename T>
+static void Time(const char *Name, const std::vector<unsigned char> &Buffer, T &&Search)
+{
+	const int Passes = 5;
+	const unsigned char *volatile Data = Buffer.data();
+	const void *Found = nullptr;
+	const auto Start = std::chrono::steady_clock::now();
+	for (int x = 0; x < Passes; x++)
+	{
+		Sink = Found = Search(Data);
+	}
+	const double Ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Start).count() / Passes;
+	printf("%-22s %8.2f ms, found at %td\n", Name, Ms, Found ? (const unsigned char*)Found - Buffer.data() : (ptrdiff_t)-1);
+}
+
+int main(int argc, char *argv[])
+{
+	std::mt19937 Rng(1);
+	if (!Fuzz(Rng, 200000))
+	{
+		return 1;
+	}
+	if (!FuzzMulti(Rng, 50000))
+	{
+		return 1;
+	}
+	printf("200000 random searches and 50000 random multi-pattern searches match std::search\n");
+
+	// Code-like bytes, lots of 0x00 and common opcode bytes so the first and last byte filter has work to do
+	const size_t Size = (size_t)((argc > 1) ? std::max(1, atoi(argv[1])) : 50) << 20;
+	std::vector<unsigned char> Buffer(Size);
+	for (unsigned char &c : Buffer)
+	{
+		const unsigned r = Rng() % 16;
+		c = (unsigned char)((r < 4) ? 0x00 : (r < 5) ? 0xB8 : (r < 6) ? 0x39 : (r < 7) ? 0x08 : Rng() & 0xFF);
+	}
+
+	// Make sure the pattern only appears near the end
+	const unsigned char Pattern[] = { 0xB8, 0x00, 0x08, 0x00, 0x00, 0x39 };
+	while (unsigned char *Match = (unsigned char*)NaiveMemmem(Buffer.data(), Size, Pattern, sizeof(Pattern)))
+	{
+		Match[1] = 1;
+	}
+	memcpy(Buffer.data() + Size - 100, Pattern, sizeof(Pattern));
+
+	unsigned char LongPattern[100];
+	memcpy(LongPattern, Buffer.data() + Size - 200, sizeof(LongPattern));
+
+	// The two signatures DDrawResolutionHack looks for, the patched one is not in the buffer
+	const unsigned char PatchedPattern[] = { 0xB8, 0xFF, 0xFF, 0xFF, 0xFF, 0x39 };
+	while (unsigned char *Match = (unsigned char*)NaiveMemmem(Buffer.data(), Size, PatchedPattern, sizeof(PatchedPattern)))
+	{
+		Match[1] = 1;
+	}
+	Utils::MEMPATTERN HackPatterns[] = { { Pattern, sizeof(Pattern), nullptr }, { PatchedPattern, sizeof(PatchedPattern), nullptr } };
+
+	// Four short signatures taken from near the end of the buffer
+	unsigned char Signatures[4][8];
+	Utils::MEMPATTERN SignaturePatterns[4];
+	for (size_t x = 0; x < 4; x++)
+	{
+		memcpy(Signatures[x], Buffer.data() + Size - 1000 + x * 200, sizeof(Signatures[x]));
+		SignaturePatterns[x] = { Signatures[x], sizeof(Signatures[x]), nullptr };
+	}
+
+	printf("%zu MB buffer\n", Size >> 20);
+	Time("naive, 6 bytes", Buffer, [&](const unsigned char *Data) { return NaiveMemmem(Data, Size, Pattern, sizeof(Pattern)); });
+	Time("memmem, 6 bytes", Buffer, [&](const unsigned char *Data) { return Utils::memmem(Data, Size, Pattern, sizeof(Pattern)); });
+	Time("naive, 100 bytes", Buffer, [&](const unsigned char *Data) { return NaiveMemmem(Data, Size, LongPattern, sizeof(LongPattern)); });
+	Time("memmem, 100 bytes", Buffer, [&](const unsigned char *Data) { return Utils::memmem(Data, Size, LongPattern, sizeof(LongPattern)); });
+	Time("naive, 2 hack sigs", Buffer, [&](const unsigned char *Data) {
+		Sink = NaiveMemmem(Data, Size, PatchedPattern, sizeof(PatchedPattern));
+		return NaiveMemmem(Data, Size, Pattern, sizeof(Pattern)); });
+	Time("memmem x2, hack sigs", Buffer, [&](const unsigned char *Data) {
+		Sink = Utils::memmem(Data, Size, PatchedPattern, sizeof(PatchedPattern));
+		return Utils::memmem(Data, Size, Pattern, sizeof(Pattern)); });
+	Time("one pass, hack sigs", Buffer, [&](const unsigned char *Data) { Utils::memmem(Data, Size, HackPatterns, 2); return HackPatterns[0].Found; });
+	Time("memmem x4, 8 bytes", Buffer, [&](const unsigned char *Data) {
+		const void *Found = nullptr;
+		for (const auto &Signature : SignaturePatterns)
+		{
+			Sink = Found = Utils::memmem(Data, Size, Signature.Bytes, Signature.Size);
+		}
+		return Found; });
+	Time("one pass, 4 x 8 bytes", Buffer, [&](const unsigned char *Data) { Utils::memmem(Data, Size, SignaturePatterns, 4); return SignaturePatterns[3].Found; });
+	return 0;
+}
@@ -33,6 +33,7 @@
 #include <comutil.h>
 #include <Wbemidl.h>
 #include "Utils.h"
+#include "MemSearch.h"
 #include "Settings\Settings.h"
 #include "Dllmain\Dllmain.h"
 #include "Wrappers\wrapper.h"
@@ -42,9 +43,11 @@ extern "C"
 {
 #include "Disasm\disasm.h"
 }
+#include "Disassembler.h"
 #include "External\Hooking\Hook.h"
 #include "Utils.h"
 #include "Logging\Logging.h"
+#include "Logging\AsyncLog.h"
 
 #undef LoadLibrary
 
@@ -76,6 +79,21 @@ namespace Utils
 		std::string fullname;
 	};
 
+	struct PLUGINFILE
+	{
+		std::string dir;
+		std::string path;
+		DWORD size = 0;
+	};
+
+	// Plugin file read ahead of LoadLibrary
+	struct PREFETCH
+	{
+		HANDLE hFile;
+		OVERLAPPED Overlapped;
+		void* Buffer;
+	};
+
 	// FontSmoothing
 	struct SystemSettings
 	{
@@ -99,14 +117,16 @@ namespace Utils
 	std::vector<type_dll> custom_dll;		// Used for custom dll's and asi plugins
 	LPTOP_LEVEL_EXCEPTION_FILTER pOriginalSetUnhandledExceptionFilter = SetUnhandledExceptionFilter((LPTOP_LEVEL_EXCEPTION_FILTER)EXCEPTION_CONTINUE_EXECUTION);
 	PFN_SetUnhandledExceptionFilter pSetUnhandledExceptionFilter = reinterpret_cast<PFN_SetUnhandledExceptionFilter>(SetUnhandledExceptionFilter);
+	bool IsDisasmAcquired = false;			// Disassembler reference held while the exception handler is set
 
 	// Function declarations
 	DWORD_PTR GetProcessMask();
 	void InitializeASI(HMODULE hModule);
-	void FindFiles(WIN32_FIND_DATA*);
+	void FindFiles(const char* dir, std::vector<PLUGINFILE>& Plugins);
+	void StartPrefetch(const std::vector<PLUGINFILE>& Plugins, std::vector<PREFETCH>& Reads);
+	void EndPrefetch(std::vector<PREFETCH>& Reads);
 	LONG WINAPI myUnhandledExceptionFilter(LPEXCEPTION_POINTERS);
 	LPTOP_LEVEL_EXCEPTION_FILTER WINAPI extSetUnhandledExceptionFilter(LPTOP_LEVEL_EXCEPTION_FILTER);
-	void *memmem(const void *l, size_t l_len, const void *s, size_t s_len);
 }
 
 // Execute a specified string
@@ -320,6 +340,7 @@ LONG WINAPI Utils::myUnhandledExceptionFilter(LPEXCEPTION_POINTERS ExceptionInfo
 	Logging::Log() << "UnhandledExceptionFilter: exception code=" << ExceptionInfo->ExceptionRecord->ExceptionCode <<
 		" flags=" << ExceptionInfo->ExceptionRecord->ExceptionFlags << std::showbase << std::hex <<
 		" addr=" << ExceptionInfo->ExceptionRecord->ExceptionAddress << std::dec << std::noshowbase;
+	Logging::FlushAsyncLog();
 	DWORD oldprot;
 	static HMODULE disasmlib = nullptr;
 	PVOID target = ExceptionInfo->ExceptionRecord->ExceptionAddress;
@@ -333,12 +354,20 @@ LONG WINAPI Utils::myUnhandledExceptionFilter(LPEXCEPTION_POINTERS ExceptionInfo
 	{
 		int cmdlen;
 		t_disasm da;
-		Preparedisasm();
+		if (!IsDisasmAcquired)
+		{
+			return EXCEPTION_CONTINUE_SEARCH;
+		}
 		if (!VirtualProtect(target, 10, PAGE_READWRITE, &oldprot))
 		{
 			return EXCEPTION_CONTINUE_SEARCH; // error condition
 		}
 		cmdlen = Disasm((BYTE *)target, 10, 0, &da, 0, nullptr, nullptr);
+		if (cmdlen == 0)
+		{
+			VirtualProtect(target, 10, oldprot, &oldprot);
+			return EXCEPTION_CONTINUE_SEARCH;
+		}
 		Logging::Log() << "UnhandledExceptionFilter: NOP opcode=" << std::showbase << std::hex << *(BYTE *)target << std::dec << std::noshowbase << " len=" << cmdlen;
 		memset((BYTE *)target, 0x90, cmdlen);
 		VirtualProtect(target, 10, oldprot, &oldprot);
@@ -376,6 +405,10 @@ void Utils::HookExceptionHandler(void)
 	void *tmp;
 
 	Logging::Log() << "Set exception handler";
+	if (!IsDisasmAcquired)
+	{
+		IsDisasmAcquired = AcquireDisassembler();
+	}
 	HMODULE dll = LoadLibrary("kernel32.dll");
 	if (!dll)
 	{
@@ -403,7 +436,11 @@ void Utils::UnHookExceptionHandler(void)
 	Logging::Log() << "Unloading exception handlers";
 	SetErrorMode(0);
 	SetUnhandledExceptionFilter(pOriginalSetUnhandledExceptionFilter);
-	Finishdisasm();
+	if (IsDisasmAcquired)
+	{
+		IsDisasmAcquired = false;
+		ReleaseDisassembler();
+	}
 }
 
 // Add HMODULE to vector
@@ -513,52 +550,121 @@ void Utils::InitializeASI(HMODULE hModule)
 	p_InitializeASI();
 }
 
-// Find asi plugins to load
-void Utils::FindFiles(WIN32_FIND_DATA* fd)
+// Find asi plugins in dir, in the order they are returned by the file system
+void Utils::FindFiles(const char* dir, std::vector<PLUGINFILE>& Plugins)
 {
-	char dir[MAX_PATH] = { 0 };
-	GetCurrentDirectory(MAX_PATH, dir);
+	char search[MAX_PATH] = { 0 };
+	sprintf_s(search, "%s\\*.asi", dir);
 
-	HANDLE asiFile = FindFirstFile("*.asi", fd);
+	// Basic info and large fetch are not supported before Windows 7
+	WIN32_FIND_DATA fd;
+	HANDLE asiFile = FindFirstFileEx(search, FindExInfoBasic, &fd, FindExSearchNameMatch, nullptr, FIND_FIRST_EX_LARGE_FETCH);
+	if (asiFile == INVALID_HANDLE_VALUE)
+	{
+		asiFile = FindFirstFile(search, &fd);
+	}
 	if (asiFile != INVALID_HANDLE_VALUE)
 	{
 		do {
-			if (!(fd->dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+			if (!(fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
 			{
-				auto pos = strlen(fd->cFileName);
+				auto pos = strlen(fd.cFileName);
 
-				if (fd->cFileName[pos - 4] == '.' &&
-					(fd->cFileName[pos - 3] == 'a' || fd->cFileName[pos - 3] == 'A') &&
-					(fd->cFileName[pos - 2] == 's' || fd->cFileName[pos - 2] == 'S') &&
-					(fd->cFileName[pos - 1] == 'i' || fd->cFileName[pos - 1] == 'I'))
+				if (pos > 4 && fd.cFileName[pos - 4] == '.' &&
+					(fd.cFileName[pos - 3] == 'a' || fd.cFileName[pos - 3] == 'A') &&
+					(fd.cFileName[pos - 2] == 's' || fd.cFileName[pos - 2] == 'S') &&
+					(fd.cFileName[pos - 1] == 'i' || fd.cFileName[pos - 1] == 'I'))
 				{
-					char path[MAX_PATH] = { 0 };
-					sprintf_s(path, "%s\\%s", dir, fd->cFileName);
-
-					auto h = LoadLibrary(path);
-					SetCurrentDirectory(dir); //in case asi switched it
-
-					if (h)
-					{
-						AddHandleToVector(h, path);
-						InitializeASI(h);
-					}
-					else
-					{
-						Logging::LogFormat("Unable to load '%s'. Error: %d", fd->cFileName, GetLastError());
-					}
+					PLUGINFILE Plugin;
+					Plugin.dir.assign(dir);
+					Plugin.path.assign(dir).append("\\").append(fd.cFileName);
+					Plugin.size = (fd.nFileSizeHigh) ? MAXDWORD : fd.nFileSizeLow;
+					Plugins.push_back(Plugin);
 				}
 			}
-		} while (FindNextFile(asiFile, fd));
+		} while (FindNextFile(asiFile, &fd));
 		FindClose(asiFile);
 	}
 }
 
+// Starts overlapped reads of the plugin files so the disk can serve them while earlier plugins load, then
+// LoadLibrary maps them from the file cache. Nothing waits for the reads before loading, this runs under the
+// loader lock. A read that completes right away means the files are already cached, so no more are started.
+void Utils::StartPrefetch(const std::vector<PLUGINFILE>& Plugins, std::vector<PREFETCH>& Reads)
+{
+	constexpr DWORD MaxFileSize = 4 * 1024 * 1024;
+	constexpr DWORD MaxTotalSize = 16 * 1024 * 1024;
+
+	// Reserved up front, an OVERLAPPED must not move while its read is pending
+	Reads.reserve(Plugins.size());
+
+	DWORD TotalSize = 0;
+	for (const auto& Plugin : Plugins)
+	{
+		if (!Plugin.size || Plugin.size > MaxFileSize || TotalSize + Plugin.size > MaxTotalSize)
+		{
+			continue;
+		}
+		PREFETCH Read = {};
+		Read.hFile = CreateFile(Plugin.path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_FLAG_OVERLAPPED | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (Read.hFile == INVALID_HANDLE_VALUE)
+		{
+			continue;
+		}
+		Read.Buffer = VirtualAlloc(nullptr, Plugin.size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+		Read.Overlapped.hEvent = CreateEvent(nullptr, TRUE, FALSE, nullptr);
+		Reads.push_back(Read);
+		PREFETCH& Last = Reads.back();
+		if (Last.Buffer && Last.Overlapped.hEvent &&
+			ReadFile(Last.hFile, Last.Buffer, Plugin.size, nullptr, &Last.Overlapped))
+		{
+			Logging::Log() << "Plugin files are cached, prefetch stopped after " << Reads.size() << " of " << Plugins.size();
+			break;
+		}
+		if (!Last.Buffer || !Last.Overlapped.hEvent || GetLastError() != ERROR_IO_PENDING)
+		{
+			// No read is pending, so EndPrefetch must not wait on the event
+			if (Last.Overlapped.hEvent)
+			{
+				CloseHandle(Last.Overlapped.hEvent);
+				Last.Overlapped.hEvent = nullptr;
+			}
+			break;
+		}
+		TotalSize += Plugin.size;
+	}
+}
+
+// Called after the plugins are loaded, reads that are still pending are cancelled
+void Utils::EndPrefetch(std::vector<PREFETCH>& Reads)
+{
+	for (auto& Read : Reads)
+	{
+		if (Read.Overlapped.hEvent)
+		{
+			DWORD dwBytesRead = 0;
+			CancelIo(Read.hFile);
+			GetOverlappedResult(Read.hFile, &Read.Overlapped, &dwBytesRead, TRUE);
+			CloseHandle(Read.Overlapped.hEvent);
+		}
+		if (Read.Buffer)
+		{
+			VirtualFree(Read.Buffer, 0, MEM_RELEASE);
+		}
+		CloseHandle(Read.hFile);
+	}
+	Reads.clear();
+}
+
 // Load asi plugins
 void Utils::LoadPlugins()
 {
 	Logging::Log() << "Loading ASI Plugins";
 
+	LARGE_INTEGER Frequency, StartTime, LoadTime, InitTime;
+	QueryPerformanceFrequency(&Frequency);
+	QueryPerformanceCounter(&StartTime);
+
 	char oldDir[MAX_PATH] = { 0 }; // store the current directory
 	GetCurrentDirectory(MAX_PATH, oldDir);
 
@@ -567,23 +673,59 @@ void Utils::LoadPlugins()
 	GetModuleHandleEx(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT, (LPCTSTR)Utils::LoadPlugins, &hModule);
 	GetModuleFileName(hModule, selfPath, MAX_PATH);
 	*strrchr(selfPath, '\\') = '\0';
-	SetCurrentDirectory(selfPath);
 
-	WIN32_FIND_DATA fd;
+	// Enumerate every folder once, the list is then used for both prefetching and loading. The result is
+	// not kept across launches, the folders can change between them and this is timed below.
+	std::vector<PLUGINFILE> Plugins;
+	char path[MAX_PATH] = { 0 };
 	if (!Config.LoadFromScriptsOnly)
-		FindFiles(&fd);
+	{
+		FindFiles(selfPath, Plugins);
+	}
+	sprintf_s(path, "%s\\scripts", selfPath);
+	FindFiles(path, Plugins);
+	sprintf_s(path, "%s\\plugins", selfPath);
+	FindFiles(path, Plugins);
 
-	SetCurrentDirectory(selfPath);
+	QueryPerformanceCounter(&LoadTime);
+	Logging::Log() << "Found " << Plugins.size() << " ASI plugins in " << (LoadTime.QuadPart - StartTime.QuadPart) * 1000000 / Frequency.QuadPart << "us";
 
-	if (SetCurrentDirectory("scripts\\"))
-		FindFiles(&fd);
+	std::vector<PREFETCH> Reads;
+	StartPrefetch(Plugins, Reads);
 
-	SetCurrentDirectory(selfPath);
+	// Plugins run code in DllMain and InitializeASI, so they are still loaded one at a time in the original order
+	for (const auto& Plugin : Plugins)
+	{
+		SetCurrentDirectory(Plugin.dir.c_str());
 
-	if (SetCurrentDirectory("plugins\\"))
-		FindFiles(&fd);
+		QueryPerformanceCounter(&LoadTime);
+		auto h = LoadLibrary(Plugin.path.c_str());
+		SetCurrentDirectory(Plugin.dir.c_str()); //in case asi switched it
+
+		if (h)
+		{
+			AddHandleToVector(h, Plugin.path.c_str());
+			QueryPerformanceCounter(&InitTime);
+			InitializeASI(h);
+
+			LARGE_INTEGER EndTime;
+			QueryPerformanceCounter(&EndTime);
+			Logging::Log() << "Loaded '" << Plugin.path << "' in " << (InitTime.QuadPart - LoadTime.QuadPart) * 1000 / Frequency.QuadPart <<
+				"ms, InitializeASI took " << (EndTime.QuadPart - InitTime.QuadPart) * 1000 / Frequency.QuadPart << "ms";
+		}
+		else
+		{
+			Logging::LogFormat("Unable to load '%s'. Error: %d", Plugin.path.c_str(), GetLastError());
+		}
+	}
 
 	SetCurrentDirectory(oldDir); // Reset the current directory
+
+	EndPrefetch(Reads);
+
+	LARGE_INTEGER EndTime;
+	QueryPerformanceCounter(&EndTime);
+	Logging::Log() << "Loaded " << Plugins.size() << " ASI plugins in " << (EndTime.QuadPart - StartTime.QuadPart) * 1000 / Frequency.QuadPart << "ms";
 }
 
 // Unload all dll files loaded by the wrapper
@@ -623,49 +765,13 @@ HMEMORYMODULE Utils::LoadResourceToMemory(DWORD ResID)
 	return nullptr;
 }
 
-// Searches the memory
-void *Utils::memmem(const void *l, size_t l_len, const void *s, size_t s_len)
-{
-	char *cur, *last;
-	const char *cl = (const char *)l;
-	const char *cs = (const char *)s;
-
-	/* we need something to compare */
-	if (!l_len || !s_len)
-	{
-		return nullptr;
-	}
-
-	/* "s" must be smaller or equal to "l" */
-	if (l_len < s_len)
-	{
-		return nullptr;
-	}
-
-	/* special case where s_len == 1 */
-	if (s_len == 1)
-	{
-		return (void*)memchr(l, (int)*cs, l_len);
-	}
-
-	/* the last position where it's possible to find "s" in "l" */
-	last = (char *)cl + l_len - s_len;
-
-	for (cur = (char *)cl; cur <= last; cur++)
-	{
-		if (cur[0] == cs[0] && !memcmp(cur, cs, s_len))
-		{
-			return cur;
-		}
-	}
-
-	return nullptr;
-}
-
 // Removes the artificial resolution limit from Direct3D7 and below
 void Utils::DDrawResolutionHack(HMODULE hD3DIm)
 {
+	// The 2048 pixel limit check, and the same check after this or another resolution hack patched it
 	const BYTE wantedBytes[] = { 0xB8, 0x00, 0x08, 0x00, 0x00, 0x39 };
+	const BYTE patchedBytes[] = { 0xB8, 0xFF, 0xFF, 0xFF, 0xFF, 0x39 };
+	MEMPATTERN Patterns[] = { { wantedBytes, sizeof(wantedBytes), nullptr }, { patchedBytes, sizeof(patchedBytes), nullptr } };
 
 	PIMAGE_DOS_HEADER pDosHeader = (PIMAGE_DOS_HEADER)hD3DIm;
 	PIMAGE_NT_HEADERS pNtHeader = (PIMAGE_NT_HEADERS)((char *)pDosHeader + pDosHeader->e_lfanew);
@@ -673,15 +779,25 @@ void Utils::DDrawResolutionHack(HMODULE hD3DIm)
 	DWORD dwCodeSize = pNtHeader->OptionalHeader.SizeOfCode;
 	DWORD dwOldProtect;
 
-	DWORD dwPatchBase = (DWORD)memmem((void *)dwCodeBase, dwCodeSize, wantedBytes, sizeof(wantedBytes));
+	// Both signatures are searched in one pass over the code section
+	memmem((void *)dwCodeBase, dwCodeSize, Patterns, sizeof(Patterns) / sizeof(Patterns[0]));
+	DWORD dwPatchBase = (DWORD)Patterns[0].Found;
 	if (dwPatchBase)
 	{
-		Logging::LogDebug() << __FUNCTION__ << " Found resolution check at: " << (void*)dwPatchBase;
+		LOG_DBG << __FUNCTION__ << " Found resolution check at: " << (void*)dwPatchBase;
 		dwPatchBase++;
 		VirtualProtect((LPVOID)dwPatchBase, 4, PAGE_EXECUTE_READWRITE, &dwOldProtect);
 		*(DWORD *)dwPatchBase = (DWORD)-1;
 		VirtualProtect((LPVOID)dwPatchBase, 4, dwOldProtect, &dwOldProtect);
 	}
+	else if (Patterns[1].Found)
+	{
+		LOG_DBG << __FUNCTION__ << " Resolution check is already patched at: " << Patterns[1].Found;
+	}
+	else
+	{
+		Logging::Log() << __FUNCTION__ << " Error: could not find resolution check!";
+	}
 }
 
 void Utils::GetScreenSettings()
@@ -931,7 +1047,7 @@ DWORD Utils::GetVideoRam(UINT AdapterNo)
 						CComVariant varSize;
 						if (SUCCEEDED(spInstance->Get(CComBSTR(L"AdapterRAM"), 0, &varSize, nullptr, nullptr)))
 						{
-							Logging::LogDebug() << __FUNCTION__ << " Found AdapterRAM on adapter: " << VideoAdapter << " Size: " << varSize.intVal;
+							LOG_DBG << __FUNCTION__ << " Found AdapterRAM on adapter: " << VideoAdapter << " Size: " << varSize.intVal;
 							retSize = varSize.intVal;
 							break;
 						}
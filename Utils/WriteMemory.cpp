@@ -14,6 +14,7 @@
 *   3. This notice may not be removed or altered from any source distribution.
 */
 
+#include <algorithm>
 #include "Settings\Settings.h"
 #include "Utils.h"
 #include "Logging\Logging.h"
@@ -23,15 +24,71 @@ namespace Utils
 	namespace WriteMemory
 	{
 		// Declare variables
-		bool m_StopThreadFlag = false;
-		bool m_ThreadRunningFlag = false;
 		HANDLE m_hThread = nullptr;
-		DWORD m_dwThreadID = 0;
+		HANDLE m_hStopEvent = nullptr;
 
 		// Function declarations
-		bool WriteAllByteMemory();
+		bool WriteAllByteMemory(bool Undo);
 		DWORD WINAPI StartThreadFunc(LPVOID);
 		bool IsThreadRunning();
+		void CloseThreadHandles();
+	}
+}
+
+namespace
+{
+	struct PAGERANGE
+	{
+		BYTE* Address;
+		SIZE_T Size;
+		DWORD OldProtect;
+	};
+
+	void RestorePages(const std::vector<PAGERANGE>& Ranges)
+	{
+		for (const auto& Range : Ranges)
+		{
+			DWORD dwPrevProtect;
+			VirtualProtect(Range.Address, Range.Size, Range.OldProtect, &dwPrevProtect);
+		}
+	}
+
+	// Makes the pages of every patch writable. Neighbouring pages that share a protection are changed
+	// with one call, executable pages stay executable in case another thread is running them.
+	bool UnprotectPages(std::vector<PAGERANGE>& Spans, std::vector<PAGERANGE>& Ranges)
+	{
+		std::sort(Spans.begin(), Spans.end(), [](const PAGERANGE& a, const PAGERANGE& b) { return a.Address < b.Address; });
+
+		for (size_t x = 0; x < Spans.size(); )
+		{
+			BYTE* Current = Spans[x].Address;
+			BYTE* End = Spans[x].Address + Spans[x].Size;
+			for (x++; x < Spans.size() && Spans[x].Address <= End; x++)
+			{
+				End = (std::max)(End, Spans[x].Address + Spans[x].Size);
+			}
+
+			while (Current < End)
+			{
+				MEMORY_BASIC_INFORMATION mbi;
+				if (!VirtualQuery(Current, &mbi, sizeof(mbi)) || mbi.State != MEM_COMMIT)
+				{
+					RestorePages(Ranges);
+					return false;
+				}
+				const SIZE_T Size = (std::min)((SIZE_T)(End - Current), (SIZE_T)((BYTE*)mbi.BaseAddress + mbi.RegionSize - Current));
+				const DWORD Executable = PAGE_EXECUTE | PAGE_EXECUTE_READ | PAGE_EXECUTE_READWRITE | PAGE_EXECUTE_WRITECOPY;
+				DWORD dwPrevProtect;
+				if (!VirtualProtect(Current, Size, (mbi.Protect & Executable) ? PAGE_EXECUTE_READWRITE : PAGE_READWRITE, &dwPrevProtect))
+				{
+					RestorePages(Ranges);
+					return false;
+				}
+				Ranges.push_back({ Current, Size, dwPrevProtect });
+				Current += Size;
+			}
+		}
+		return true;
 	}
 }
 
@@ -42,7 +99,7 @@ bool WriteMemory::CheckMemoryAddress(void *dataAddr, void *dataBytes, size_t dat
 {
 	if (!dataAddr || !dataBytes || !dataSize)
 	{
-		Logging::LogDebug() << __FUNCTION__ << " Error: invalid memory data";
+		LOG_DBG << __FUNCTION__ << " Error: invalid memory data";
 		return false;
 	}
 
@@ -50,7 +107,7 @@ bool WriteMemory::CheckMemoryAddress(void *dataAddr, void *dataBytes, size_t dat
 	DWORD dwPrevProtect;
 	if (!VirtualProtect(dataAddr, dataSize, PAGE_READONLY, &dwPrevProtect))
 	{
-		Logging::LogDebug() << __FUNCTION__ << " Error: could not read memory address";
+		LOG_DBG << __FUNCTION__ << " Error: could not read memory address";
 		return false;
 	}
 
@@ -93,43 +150,76 @@ bool WriteMemory::UpdateMemoryAddress(void *dataAddr, void *dataBytes, size_t da
 	return true;
 }
 
-// Writes all bytes in Config to memory
-bool WriteMemory::WriteAllByteMemory()
+// Writes all bytes in Config to memory. The pages are unprotected once for all patches and the instruction
+// cache is flushed once. When ResetMemoryAfter is set the patch and the original bytes are swapped, so
+// calling this again with Undo set restores the memory.
+bool WriteMemory::WriteAllByteMemory(bool Undo)
 {
-	for (UINT x = 0; x < Config.MemoryInfo.size(); x++)
+	LARGE_INTEGER Frequency, StartTime, EndTime;
+	QueryPerformanceFrequency(&Frequency);
+	QueryPerformanceCounter(&StartTime);
+
+	SYSTEM_INFO SystemInfo;
+	GetSystemInfo(&SystemInfo);
+	const ULONG_PTR PageMask = SystemInfo.dwPageSize - 1;
+
+	// Page aligned span of each patch and the bytes that need flushing
+	std::vector<PAGERANGE> Spans;
+	BYTE* FlushStart = nullptr;
+	BYTE* FlushEnd = nullptr;
+	for (const auto& Patch : Config.MemoryInfo)
 	{
-		std::vector<byte> tmpArray;
-		if (Config.MemoryInfo[x].AddressPointer && Config.MemoryInfo[x].Bytes.size())
+		if (Patch.AddressPointer && Patch.Bytes.size())
 		{
-			// Backup memory
-			if (Config.ResetMemoryAfter > 0)
-			{
-				tmpArray.resize(Config.MemoryInfo[x].Bytes.size(), '\0');
-				if (!UpdateMemoryAddress(&tmpArray[0], Config.MemoryInfo[x].AddressPointer, Config.MemoryInfo[x].Bytes.size()))
-				{
-					Logging::Log() << __FUNCTION__ << " Failed to backup memory...";
-					return false;
-				}
-			}
+			BYTE* Address = (BYTE*)Patch.AddressPointer;
+			BYTE* Start = (BYTE*)((ULONG_PTR)Address & ~PageMask);
+			BYTE* End = (BYTE*)(((ULONG_PTR)Address + Patch.Bytes.size() + PageMask) & ~PageMask);
+			Spans.push_back({ Start, (SIZE_T)(End - Start), 0 });
+			FlushStart = (!FlushStart || Address < FlushStart) ? Address : FlushStart;
+			FlushEnd = (std::max)(FlushEnd, Address + Patch.Bytes.size());
+		}
+	}
+	if (Spans.empty())
+	{
+		return true;
+	}
 
-			// Write bytes to memory
-			if (!UpdateMemoryAddress(Config.MemoryInfo[x].AddressPointer, &Config.MemoryInfo[x].Bytes[0], Config.MemoryInfo[x].Bytes.size()))
-			{
-				Logging::Log() << __FUNCTION__ << " Failed to write bytes to memory...";
-				return false;
-			}
+	std::vector<PAGERANGE> Ranges;
+	if (!UnprotectPages(Spans, Ranges))
+	{
+		Logging::Log() << __FUNCTION__ << " Error: could not write to memory address";
+		return false;
+	}
 
-			// Prepare new memory to be written
+	// Patches are applied in config order and undone in reverse order in case they overlap
+	for (size_t x = 0; x < Config.MemoryInfo.size(); x++)
+	{
+		MEMORYINFO& Patch = Config.MemoryInfo[Undo ? Config.MemoryInfo.size() - 1 - x : x];
+		if (Patch.AddressPointer && Patch.Bytes.size())
+		{
 			if (Config.ResetMemoryAfter > 0)
 			{
-				if (!UpdateMemoryAddress(&Config.MemoryInfo[x].Bytes[0], &tmpArray[0], Config.MemoryInfo[x].Bytes.size()))
-				{
-					Logging::Log() << __FUNCTION__ << " Failed to prepare new memory bytes...";
-					return false;
-				}
+				std::swap_ranges(Patch.Bytes.begin(), Patch.Bytes.end(), (byte*)Patch.AddressPointer);
+			}
+			else
+			{
+				memcpy(Patch.AddressPointer, &Patch.Bytes[0], Patch.Bytes.size());
 			}
 		}
 	}
+
+	RestorePages(Ranges);
+	FlushInstructionCache(GetCurrentProcess(), FlushStart, (SIZE_T)(FlushEnd - FlushStart));
+
+	QueryPerformanceCounter(&EndTime);
+	size_t PageCount = 0;
+	for (const auto& Range : Ranges)
+	{
+		PageCount += Range.Size / SystemInfo.dwPageSize;
+	}
+	Logging::Log() << __FUNCTION__ << " Wrote " << Spans.size() << " patches on " << PageCount << " pages with " << Ranges.size() <<
+		" protection changes in " << (EndTime.QuadPart - StartTime.QuadPart) * 1000000 / Frequency.QuadPart << "us";
+
 	return true;
 }
 
@@ -138,39 +228,34 @@ DWORD WINAPI WriteMemory::StartThreadFunc(LPVOID pvParam)
 {
 	UNREFERENCED_PARAMETER(pvParam);
 
-	// Get thread handle
-	InterlockedExchangePointer(&m_hThread, GetCurrentThread());
-
-	// Set thread flag to running
-	m_ThreadRunningFlag = true;
-
-	// Sleep for a while
-	DWORD timer = 0;
-	while (!m_StopThreadFlag && timer < Config.ResetMemoryAfter)
+	// Wait for the timer or for StopThread
+	HANDLE hTimer = CreateWaitableTimer(nullptr, TRUE, nullptr);
+	LARGE_INTEGER DueTime;
+	DueTime.QuadPart = -(LONGLONG)Config.ResetMemoryAfter * 10000;
+	if (hTimer && SetWaitableTimer(hTimer, &DueTime, 0, nullptr, nullptr, FALSE))
 	{
-		Sleep(120);
-		timer += 120;
-	};
+		HANDLE Handles[] = { m_hStopEvent, hTimer };
+		WaitForMultipleObjects(_countof(Handles), Handles, FALSE, INFINITE);
+	}
+	else
+	{
+		WaitForSingleObject(m_hStopEvent, Config.ResetMemoryAfter);
+	}
+	if (hTimer)
+	{
+		CloseHandle(hTimer);
+	}
 
 	// Logging
 	Logging::Log() << __FUNCTION__ << " Undoing memory write...";
 
 	// Undo the memory write
-	if (!WriteAllByteMemory())
+	if (!WriteAllByteMemory(true))
 	{
 		// Logging
 		Logging::Log() << __FUNCTION__ << " Failed to undo memory write!";
 	}
 
-	// Reset thread flag before exiting
-	m_ThreadRunningFlag = false;
-
-	// Close handle
-	CloseHandle(InterlockedExchangePointer(&m_hThread, nullptr));
-
-	// Set thread ID back to 0
-	InterlockedExchange(&m_dwThreadID, 0);
-
 	// Return value
 	return 0;
 }
@@ -184,7 +269,7 @@ void WriteMemory::WriteMemory()
 		Logging::Log() << __FUNCTION__ << " Writing bytes to memory...";
 
 		// Write bytes to memory
-		if (!WriteAllByteMemory())
+		if (!WriteAllByteMemory(false))
 		{
 			Logging::Log() << __FUNCTION__ << " Failed to write bytes to memory...";
 			return;
@@ -193,7 +278,14 @@ void WriteMemory::WriteMemory()
 		// Starting thread to undo memory write after ResetMemoryAfter time
 		if (Config.ResetMemoryAfter > 0)
 		{
-			CreateThread(nullptr, 0, StartThreadFunc, nullptr, 0, &m_dwThreadID);
+			// A thread from an earlier write that is still waiting undoes this write as well
+			if (IsThreadRunning())
+			{
+				return;
+			}
+			CloseThreadHandles();
+			m_hStopEvent = CreateEvent(nullptr, TRUE, FALSE, nullptr);
+			m_hThread = CreateThread(nullptr, 0, StartThreadFunc, nullptr, 0, nullptr);
 		}
 	}
 	else
@@ -208,24 +300,49 @@ void WriteMemory::WriteMemory()
 // Is thread running
 bool WriteMemory::IsThreadRunning()
 {
-	return m_ThreadRunningFlag && InterlockedCompareExchange(&m_dwThreadID, 0, 0) && GetThreadId(InterlockedCompareExchangePointer(&m_hThread, nullptr, nullptr)) == InterlockedCompareExchange(&m_dwThreadID, 0, 0);
+	return m_hThread && WaitForSingleObject(m_hThread, 0) == WAIT_TIMEOUT;
+}
+
+// Close thread and event handles once the thread has exited
+void WriteMemory::CloseThreadHandles()
+{
+	if (m_hThread)
+	{
+		CloseHandle(m_hThread);
+		m_hThread = nullptr;
+	}
+	if (m_hStopEvent)
+	{
+		CloseHandle(m_hStopEvent);
+		m_hStopEvent = nullptr;
+	}
 }
 
 // Stop thread
 void WriteMemory::StopThread()
 {
-	// Set flag to stop thread
-	m_StopThreadFlag = true;
+	// Set event to stop thread
+	if (m_hStopEvent)
+	{
+		SetEvent(m_hStopEvent);
+	}
 
 	// Wait for thread to exit
 	if (IsThreadRunning())
 	{
 		Logging::Log() << __FUNCTION__ << " Stopping thread...";
 
-		// Wait for thread to exit
-		WaitForSingleObject(InterlockedCompareExchangePointer(&m_hThread, nullptr, nullptr), INFINITE);
+		// Only wait a short time, during FreeLibrary the thread cannot exit until DllMain returns
+		if (WaitForSingleObject(m_hThread, 1000) == WAIT_OBJECT_0)
+		{
+			// Thread stopped
+			Logging::Log() << __FUNCTION__ << " thread stopped";
+		}
+	}
 
-		// Thread stopped
-		Logging::Log() << __FUNCTION__ << " thread stopped";
+	// The thread still uses the stop event if it did not exit in time
+	if (!IsThreadRunning())
+	{
+		CloseThreadHandles();
 	}
 }
@@ -10,12 +10,17 @@
 namespace ShardProcs
 {
 	using namespace Wrapper;
+	HMODULE LazyDll = nullptr;
 	VISIT_PROCS_SHAREDPROCS(CREATE_PROC_STUB);
 	void Load(HMODULE dll)
 	{
 		if (dll)
 		{
-			VISIT_PROCS_SHAREDPROCS(LOAD_ORIGINAL_PROC);
+			if (LazyDll)
+			{
+				VISIT_PROCS_SHAREDPROCS(LOAD_ORIGINAL_PROC);
+			}
+			LazyDll = dll;
 		}
 	}
 	void AddToArray()
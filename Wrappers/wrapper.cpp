@@ -23,8 +23,17 @@
 
 #define VISIT_PROCS_BLANK(visit)
 
+// Exports start out jumping to a resolver stub that looks up the real proc on the first call and patches
+// procName_var, so only the exports that are actually used are looked up in the real dll
 #define CREATE_PROC_STUB(procName, prodAddr) \
-	FARPROC procName ## _var = prodAddr; \
+	extern LAZYPROC procName ## _lazy; \
+	__declspec(naked) void procName ## _resolve() \
+	{ \
+		__asm lea eax, procName ## _lazy \
+		__asm jmp lazyaddr \
+	} \
+	FARPROC procName ## _var = (FARPROC)*procName ## _resolve; \
+	LAZYPROC procName ## _lazy(#procName, &procName ## _var, prodAddr, &LazyDll); \
 	extern "C" __declspec(naked) void __stdcall procName() \
 	{ \
 		__asm mov edi, edi \
@@ -33,7 +42,14 @@
 	FARPROC procName ## _funct = (FARPROC)*procName;
 
 #define CREATE_PROC_STUB_SHARED(procName, procName_shared, prodAddr) \
-	FARPROC procName ## _var = prodAddr; \
+	extern LAZYPROC procName ## _lazy; \
+	__declspec(naked) void procName ## _resolve() \
+	{ \
+		__asm lea eax, procName ## _lazy \
+		__asm jmp lazyaddr \
+	} \
+	FARPROC procName ## _var = (FARPROC)*procName ## _resolve; \
+	LAZYPROC procName ## _lazy(#procName, &procName ## _var, prodAddr, &LazyDll); \
 	extern "C" __declspec(naked) void __stdcall procName_shared() \
 	{ \
 		__asm mov edi, edi \
@@ -41,9 +57,14 @@
 	} \
 	FARPROC procName ## _funct = (FARPROC)*procName_shared;
 
+// Used by a second Load, exports the new dll does not have keep the proc from the previous dll
 #define	LOAD_ORIGINAL_PROC(procName, unused) \
 	{ \
 		FARPROC prodAddr = GetProcAddress(dll, #procName); \
+		if (!prodAddr && procName ## _var == procName ## _lazy.Resolver) \
+		{ \
+			prodAddr = GetProcAddress(LazyDll, #procName); \
+		} \
 		if (prodAddr) \
 		{ \
 			procName ## _var = prodAddr; \
@@ -56,6 +77,7 @@
 #define	STORE_ORIGINAL_PROC(procName, unused) \
 	tmpMap.Proc = procName ## _funct; \
 	tmpMap.val = &(procName ## _var); \
+	tmpMap.Lazy = &(procName ## _lazy); \
 	jmpArray.push_back(tmpMap);
 
 #define	STORE_ORIGINAL_PROC_SHARED(procName, unused, unused_2) \
@@ -66,6 +88,7 @@
 	{ \
 		using namespace Wrapper; \
 		char *Name = #className ## "." ## #Extension; \
+		HMODULE LazyDll = nullptr; \
 		VISIT_PROCS(CREATE_PROC_STUB); \
 		VISIT_PROCS_SHARED(CREATE_PROC_STUB_SHARED); \
 		HMODULE Load(const char *ProxyDll, const char *MyDllName) \
@@ -95,10 +118,15 @@
 				strcat_s(path, MAX_PATH, Name); \
 				dll = LoadLibraryA(path); \
 			} \
+			/* The real dll is loaded right away, Dllmain keeps its handle and only hooks GetProcAddress once it loaded */ \
 			if (dll) \
 			{ \
-				VISIT_PROCS(LOAD_ORIGINAL_PROC); \
-				VISIT_PROCS_SHARED(LOAD_ORIGINAL_PROC_SHARED); \
+				if (LazyDll) \
+				{ \
+					VISIT_PROCS(LOAD_ORIGINAL_PROC); \
+					VISIT_PROCS_SHARED(LOAD_ORIGINAL_PROC_SHARED); \
+				} \
+				LazyDll = dll; \
 			} \
 			else \
 			{ \
@@ -116,23 +144,58 @@
 
 namespace Wrapper
 {
+	// Export that has not been looked up in the real dll yet
+	struct LAZYPROC
+	{
+		const char *Name;
+		FARPROC *var;
+		FARPROC Default;			// Used when the real dll does not have the export
+		FARPROC Resolver;			// Initial value of var
+		HMODULE *dll;
+		LAZYPROC *Next;
+
+		LAZYPROC(const char *ProcName, FARPROC *ProcVar, FARPROC ProcDefault, HMODULE *ProcDll);
+	};
+
 	struct wrapper_map
 	{
 		FARPROC Proc;
 		FARPROC *val;
+		LAZYPROC *Lazy;
+	};
+
+	// Export lookups in the real dll, logged when dxwrapper unloads
+	struct RESOLVESTATS
+	{
+		LONG OnFirstCall = 0;		// Looked up by the resolver stub when the export was first called
+		LONG Early = 0;				// Looked up by dxwrapper before the first call, e.g. by ShimProc
+		LONG64 Ticks = 0;			// Time spent looking up both
 	};
 
 	// Forward function declaration
 	HRESULT __stdcall _jmpaddr();
 	HRESULT __stdcall _jmpaddrvoid();
+	void __stdcall _lazyaddr();
+	FARPROC __stdcall ResolveLazyProc(LAZYPROC *Proc);
+	FARPROC LookupLazyProc(LAZYPROC *Proc, LONG &Count);
+	void GetLazyProcCounts(LONG &Total, LONG &Unresolved);
 
 	// Variable declaration
 	const FARPROC jmpaddr = (FARPROC)*_jmpaddr;
 	const FARPROC jmpaddrvoid = (FARPROC)*_jmpaddrvoid;
+	const FARPROC lazyaddr = (FARPROC)*_lazyaddr;
+	LAZYPROC *LazyProcs = nullptr;
+	RESOLVESTATS ResolveStats;
 	std::vector<wrapper_map> jmpArray;
 	HMODULE GetWrapperType(const char *ProxyDll, const char *WrapperMode, const char *MyDllName);
 }
 
+Wrapper::LAZYPROC::LAZYPROC(const char *ProcName, FARPROC *ProcVar, FARPROC ProcDefault, HMODULE *ProcDll) :
+	Name(ProcName), var(ProcVar), Default(ProcDefault), Resolver(*ProcVar), dll(ProcDll), Next(LazyProcs)
+{
+	LazyProcs = this;
+}
+
 #include "wrapper.h"
 
 __declspec(naked) HRESULT __stdcall Wrapper::_jmpaddrvoid()
@@ -152,12 +215,108 @@ __declspec(naked) HRESULT __stdcall Wrapper::_jmpaddr()
 	}
 }
 
+// Called by the resolver stubs with eax pointing to the export, caller saved registers are kept for the export
+__declspec(naked) void __stdcall Wrapper::_lazyaddr()
+{
+	__asm
+	{
+		push ecx
+		push edx
+		push eax
+		call ResolveLazyProc
+		pop edx
+		pop ecx
+		jmp eax
+	}
+}
+
+// Called by the resolver stub on the first call of an export
+FARPROC __stdcall Wrapper::ResolveLazyProc(LAZYPROC *Proc)
+{
+	return LookupLazyProc(Proc, ResolveStats.OnFirstCall);
+}
+
+// Looks up the export in the real dll and patches the jump target once, unless the proc was already
+// replaced by a wrapper function. Count is incremented by the call that patched it.
+FARPROC Wrapper::LookupLazyProc(LAZYPROC *Proc, LONG &Count)
+{
+	const DWORD LastError = GetLastError();
+	LARGE_INTEGER StartTime, EndTime;
+	QueryPerformanceCounter(&StartTime);
+	FARPROC ProcAddress = (*Proc->dll) ? GetProcAddress(*Proc->dll, Proc->Name) : nullptr;
+	if (!ProcAddress)
+	{
+		ProcAddress = Proc->Default;
+	}
+	if (InterlockedCompareExchangePointer((PVOID*)Proc->var, ProcAddress, Proc->Resolver) == (PVOID)Proc->Resolver)
+	{
+		InterlockedIncrement(&Count);
+	}
+	QueryPerformanceCounter(&EndTime);
+	InterlockedExchangeAdd64(&ResolveStats.Ticks, EndTime.QuadPart - StartTime.QuadPart);
+	SetLastError(LastError);
+	return ProcAddress;
+}
+
+// Counts the exports of the loaded wrapper and how many of them still point to their resolver stub
+void Wrapper::GetLazyProcCounts(LONG &Total, LONG &Unresolved)
+{
+	Total = 0;
+	Unresolved = 0;
+	for (LAZYPROC *Proc = LazyProcs; Proc; Proc = Proc->Next)
+	{
+		if (*Proc->dll)
+		{
+			Total++;
+			Unresolved += (*Proc->var == Proc->Resolver);
+		}
+	}
+}
+
+void Wrapper::LogResolveStats()
+{
+	LONG Total, Unresolved;
+	GetLazyProcCounts(Total, Unresolved);
+	if (!Total)
+	{
+		return;
+	}
+
+	// Exports a second Load replaced right away are neither looked up by the stub nor by dxwrapper
+	const LONG Loaded = Total - Unresolved - ResolveStats.OnFirstCall - ResolveStats.Early;
+	LARGE_INTEGER Frequency;
+	QueryPerformanceFrequency(&Frequency);
+	Logging::Log() << "Wrapper exports: " << Total << " total, " << ResolveStats.OnFirstCall << " resolved on first call, " <<
+		ResolveStats.Early << " resolved early by dxwrapper, " << Loaded << " loaded at startup, " << Unresolved << " never called, lookups took " <<
+		ResolveStats.Ticks * 1000000 / Frequency.QuadPart << "us";
+}
+
+// Resolves var now if the export has not been called yet
+void Wrapper::ResolveProc(FARPROC &var)
+{
+	for (LAZYPROC *Proc = LazyProcs; Proc; Proc = Proc->Next)
+	{
+		if (Proc->var == &var)
+		{
+			if (var == Proc->Resolver)
+			{
+				LookupLazyProc(Proc, ResolveStats.Early);
+			}
+			return;
+		}
+	}
+}
+
 bool Wrapper::ValidProcAddress(FARPROC ProcAddress)
 {
 	for (wrapper_map i : jmpArray)
 	{
 		if (i.Proc == ProcAddress)
 		{
+			if (*(i.val) == i.Lazy->Resolver)
+			{
+				LookupLazyProc(i.Lazy, ResolveStats.Early);
+			}
 			if (*(i.val) == jmpaddr || *(i.val) == jmpaddrvoid || *(i.val) == nullptr)
 			{
 				return false;
@@ -171,6 +330,7 @@ bool Wrapper::ValidProcAddress(FARPROC ProcAddress)
 
 void Wrapper::ShimProc(FARPROC &var, FARPROC in, FARPROC &out)
 {
+	ResolveProc(var);
 	if (ValidProcAddress(var) && var != in)
 	{
 		out = var;
@@ -221,11 +381,21 @@ bool Wrapper::CheckWrapperName(const char *WrapperMode)
 
 HMODULE Wrapper::CreateWrapper(const char *ProxyDll, const char *WrapperMode, const char *MyDllName)
 {
+	LARGE_INTEGER Frequency, StartTime, EndTime;
+	QueryPerformanceFrequency(&Frequency);
+	QueryPerformanceCounter(&StartTime);
+
 	HMODULE dll = GetWrapperType(ProxyDll, WrapperMode, MyDllName);
 
 	if (dll)
 	{
 		ShardProcs::Load(dll);
+
+		LONG Total, Unresolved;
+		GetLazyProcCounts(Total, Unresolved);
+		QueryPerformanceCounter(&EndTime);
+		Logging::Log() << "Wrapper started in " << (EndTime.QuadPart - StartTime.QuadPart) * 1000000 / Frequency.QuadPart << "us including the real dll load, " <<
+			Unresolved << " of " << Total << " exports are resolved on first call";
 	}
 
 	return dll;
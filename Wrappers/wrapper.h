@@ -2,11 +2,13 @@
 
 namespace Wrapper
 {
+	void ResolveProc(FARPROC &var);
 	bool ValidProcAddress(FARPROC ProcAddress);
 	void ShimProc(FARPROC &var, FARPROC in, FARPROC &out);
 	const char *GetWrapperName(const char *WrapperMode);
 	bool CheckWrapperName(const char *WrapperMode);
 	HMODULE CreateWrapper(const char *ProxyDll, const char *WrapperMode, const char *MyDllName);
+	void LogResolveStats();
 }
 
 struct DXWAPPERSETTINGS
@@ -1,15 +1,28 @@
 #pragma once
 
 #include <unordered_map>
+#include <vector>
 #include <algorithm>
 
 constexpr UINT MaxIndex = 16;
 
+// Allocation counters for the wrapper freelists
+struct AddressPoolStats
+{
+	DWORD Allocated = 0;	// Wrappers allocated from the heap
+	DWORD Reused = 0;		// Wrappers constructed in memory taken from the freelist
+	DWORD Recycled = 0;		// Released wrappers returned to the freelist
+	DWORD Freed = 0;		// Released wrappers freed because the freelist was full
+};
+
 template <typename D>
 class AddressLookupTableD3d9
 {
 public:
-	explicit AddressLookupTableD3d9(D *pDevice) : pDevice(pDevice) {}
+	explicit AddressLookupTableD3d9(D *pDevice) : pDevice(pDevice)
+	{
+		InitializeCriticalSection(&pcs);
+	}
 	~AddressLookupTableD3d9()
 	{
 		ConstructorFlag = true;
@@ -21,6 +34,20 @@ public:
 				entry.second->DeleteMe();
 			}
 		}
+
+		LogPoolStats();
+
+		// Wrappers in the freelist have already been destructed, only the memory is left
+		for (auto& pool : g_pool)
+		{
+			for (void* Memory : pool)
+			{
+				::operator delete(Memory);
+			}
+			pool.clear();
+		}
+
+		DeleteCriticalSection(&pcs);
 	}
 
 	template <typename T>
@@ -56,15 +83,90 @@ public:
 	template <>
 	struct AddressCacheIndex<m_IDirect3DVolumeTexture9> { static constexpr UINT CacheIndex = 15; };
 
-	m_IDirect3DSwapChain9Ex *CreateInterface(void *Proxy, REFIID riid)
+	// Wrappers for objects the device creates are top-level and can be pooled. Objects that are only
+	// looked up, like texture levels or back buffers, share their container's lifetime and are not.
+	m_IDirect3DSwapChain9Ex *CreateInterface(void *Proxy, REFIID riid, bool Poolable = true)
+	{
+		ScopedLock Lock(pcs);
+
+		RecycleStaleAddress<m_IDirect3DSwapChain9Ex>(Proxy);
+
+		m_IDirect3DSwapChain9Ex *Wrapper = new (AllocateInterface<m_IDirect3DSwapChain9Ex>()) m_IDirect3DSwapChain9Ex(static_cast<m_IDirect3DSwapChain9Ex*>(Proxy), pDevice, riid);
+		Wrapper->Poolable = Poolable;
+		return Wrapper;
+	}
+
+	template <typename T>
+	T *CreateInterface(void *Proxy, bool Poolable = true)
+	{
+		ScopedLock Lock(pcs);
+
+		RecycleStaleAddress<T>(Proxy);
+
+		T *Wrapper = new (AllocateInterface<T>()) T(static_cast<T *>(Proxy), pDevice);
+		Wrapper->Poolable = Poolable;
+		return Wrapper;
+	}
+
+	// Releases the proxy interface for the wrapper. The proxy release runs outside the lock because the
+	// runtime can call back into the wrapper from it. Once the proxy is gone the runtime can hand its
+	// address to another thread, so the wrapper is only recycled if it was not looked up again meanwhile.
+	template <typename T, typename P>
+	ULONG ReleaseInterface(T *Wrapper, P *Proxy)
 	{
-		return new m_IDirect3DSwapChain9Ex(static_cast<m_IDirect3DSwapChain9Ex*>(Proxy), pDevice, riid);
+		return ReleaseInterface(Wrapper, Proxy, [Proxy]() -> ULONG { return Proxy->Release(); });
+	}
+
+	// ReleaseProxy does the proxy release for wrappers that need more than Proxy->Release()
+	template <typename T, typename R>
+	ULONG ReleaseInterface(T *Wrapper, void *Proxy, R ReleaseProxy)
+	{
+		if (!Wrapper || ConstructorFlag)
+		{
+			return ReleaseProxy();
+		}
+
+		DWORD FoundCount;
+		{
+			ScopedLock Lock(pcs);
+			Wrapper->Releasing++;
+			FoundCount = Wrapper->FoundCount;
+		}
+
+		ULONG ref = ReleaseProxy();
+
+		ScopedLock Lock(pcs);
+		Wrapper->Releasing--;
+
+		// A wrapper found again after the final release belongs to a new proxy at the same address
+		if (ref == 0 && Wrapper->Poolable && Wrapper->FoundCount == FoundCount)
+		{
+			Wrapper->Released = true;
+		}
+
+		// The last thread still releasing the wrapper recycles it
+		if (!Wrapper->Releasing && (Wrapper->Released || Wrapper->Detached))
+		{
+			if (!Wrapper->Detached)
+			{
+				constexpr UINT CacheIndex = AddressCacheIndex<T>::CacheIndex;
+				auto it = g_map[CacheIndex].find(Proxy);
+
+				if (it != std::end(g_map[CacheIndex]) && it->second == Wrapper)
+				{
+					g_map[CacheIndex].erase(it);
+				}
+			}
+			RecycleInterface(Wrapper);
+		}
+
+		return ref;
 	}
 
 	template <typename T>
-	T *CreateInterface(void *Proxy)
+	const AddressPoolStats &GetPoolStats() const
 	{
-		return new T(static_cast<T *>(Proxy), pDevice);
+		return g_stats[AddressCacheIndex<T>::CacheIndex];
 	}
 
 	template <typename T>
@@ -76,20 +178,24 @@ public:
 		}
 
 		constexpr UINT CacheIndex = AddressCacheIndex<T>::CacheIndex;
+		ScopedLock Lock(pcs);
 		auto it = g_map[CacheIndex].find(Proxy);
 
 		if (it != std::end(g_map[CacheIndex]))
 		{
-			return static_cast<T *>(it->second);
+			T *Wrapper = static_cast<T *>(it->second);
+			Wrapper->FoundCount++;
+			Wrapper->Released = false;
+			return Wrapper;
 		}
 
 		if (riid == IID_IUnknown)
 		{
-			return CreateInterface<T>(Proxy);
+			return CreateInterface<T>(Proxy, false);
 		}
 		else
 		{
-			return (T*)CreateInterface(Proxy, riid);
+			return (T*)CreateInterface(Proxy, riid, false);
 		}
 	}
 
@@ -99,6 +205,7 @@ public:
 		constexpr UINT CacheIndex = AddressCacheIndex<T>::CacheIndex;
 		if (Wrapper && Proxy)
 		{
+			ScopedLock Lock(pcs);
 			g_map[CacheIndex][Proxy] = Wrapper;
 		}
 	}
@@ -112,6 +219,7 @@ public:
 		}
 
 		constexpr UINT CacheIndex = AddressCacheIndex<T>::CacheIndex;
+		ScopedLock Lock(pcs);
 		auto it = std::find_if(g_map[CacheIndex].begin(), g_map[CacheIndex].end(),
 			[=](auto Map) -> bool { return Map.second == Wrapper; });
 
@@ -122,9 +230,94 @@ public:
 	}
 
 private:
+	struct ScopedLock
+	{
+		explicit ScopedLock(CRITICAL_SECTION &cs) : cs(cs) { EnterCriticalSection(&cs); }
+		~ScopedLock() { LeaveCriticalSection(&cs); }
+		CRITICAL_SECTION &cs;
+	};
+
+	// Returns memory for a new wrapper, reusing a released wrapper's memory when one is available
+	template <typename T>
+	void *AllocateInterface()
+	{
+		constexpr UINT CacheIndex = AddressCacheIndex<T>::CacheIndex;
+
+		if (!g_pool[CacheIndex].empty())
+		{
+			void *Memory = g_pool[CacheIndex].back();
+			g_pool[CacheIndex].pop_back();
+			g_stats[CacheIndex].Reused++;
+			return Memory;
+		}
+
+		g_stats[CacheIndex].Allocated++;
+		return ::operator new(sizeof(T));
+	}
+
+	// Destructs the wrapper and keeps the memory of top-level wrappers in the freelist, up to the configured cap
+	template <typename T>
+	void RecycleInterface(T *Wrapper)
+	{
+		constexpr UINT CacheIndex = AddressCacheIndex<T>::CacheIndex;
+		const bool Poolable = Wrapper->Poolable;
+
+		Wrapper->~T();
+
+		if (Poolable && g_pool[CacheIndex].size() < Config.D3d9WrapperPoolSize)
+		{
+			g_pool[CacheIndex].push_back(Wrapper);
+			g_stats[CacheIndex].Recycled++;
+		}
+		else
+		{
+			::operator delete(Wrapper);
+			g_stats[CacheIndex].Freed++;
+		}
+	}
+
+	// A new proxy at an address that is still in the map means the old proxy was destroyed
+	// without the wrapper seeing its final release, so the old wrapper can be recycled. A wrapper
+	// that is still inside ReleaseInterface is recycled by that call instead.
+	template <typename T>
+	void RecycleStaleAddress(void *Proxy)
+	{
+		constexpr UINT CacheIndex = AddressCacheIndex<T>::CacheIndex;
+		auto it = g_map[CacheIndex].find(Proxy);
+
+		if (it != std::end(g_map[CacheIndex]))
+		{
+			T *Wrapper = static_cast<T *>(it->second);
+			g_map[CacheIndex].erase(it);
+			if (Wrapper->Releasing)
+			{
+				Wrapper->Detached = true;
+			}
+			else
+			{
+				RecycleInterface(Wrapper);
+			}
+		}
+	}
+
+	void LogPoolStats()
+	{
+		for (UINT x = 1; x < MaxIndex; x++)
+		{
+			if (g_stats[x].Allocated || g_stats[x].Reused)
+			{
+				LOG_DBG << __FUNCTION__ << " CacheIndex: " << x << " Allocated: " << g_stats[x].Allocated << " Reused: " << g_stats[x].Reused <<
+					" Recycled: " << g_stats[x].Recycled << " Freed: " << g_stats[x].Freed << " Pooled: " << g_pool[x].size();
+			}
+		}
+	}
+
 	bool ConstructorFlag = false;
 	D *const pDevice;
+	CRITICAL_SECTION pcs;
 	std::unordered_map<void*, class AddressLookupTableD3d9Object*> g_map[MaxIndex];
+	std::vector<void*> g_pool[MaxIndex];
+	AddressPoolStats g_stats[MaxIndex];
 };
 
 class AddressLookupTableD3d9Object
@@ -136,4 +329,15 @@ public:
 	{
 		delete this;
 	}
+
+private:
+	template <typename D>
+	friend class AddressLookupTableD3d9;
+
+	// Owned by the lookup table and only used under its lock
+	bool Poolable = false;		// Created by the device, not looked up from a container
+	bool Released = false;		// The proxy had its final release
+	bool Detached = false;		// Removed from the table as stale during a release
+	LONG Releasing = 0;			// Threads inside ReleaseInterface for this wrapper
+	DWORD FoundCount = 0;		// Times FindAddress returned this wrapper
 };
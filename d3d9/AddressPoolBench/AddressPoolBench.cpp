@@ -0,0 +1,239 @@
+/**
+* Copyright (C) 2022 Elisha Riedlinger
+*
+* This software is  provided 'as-is', without any express  or implied  warranty. In no event will the
+* authors be held liable for any damages arising from the use of this software.
+* Permission  is granted  to anyone  to use  this software  for  any  purpose,  including  commercial
+* applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*   1. The origin of this software must not be misrepresented; you must not claim that you  wrote the
+*      original  software. If you use this  software  in a product, an  acknowledgment in the product
+*      documentation would be appreciated but is not required.
+*   2. Altered source versions must  be plainly  marked as such, and  must not be  misrepresented  as
+*      being the original software.
+*   3. This notice may not be removed or altered from any source distribution.
+*
+* Create/release churn benchmark for the wrapper freelists in AddressLookupTable.h. A fake runtime reuses
+* released proxy addresses the way the d3d9 runtime does, so several threads also check that a wrapper is
+* never destructed while it is still in use. Standalone, the lookup table needs MSVC:
+*   cl /std:c++17 /EHsc /O2 AddressPoolBench.cpp
+*
+* Usage: addresspoolbench [iterations] [threads]
+*/
+
+#include <windows.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct CONFIG
+{
+	DWORD D3d9WrapperPoolSize = 0;
+} Config;
+
+struct NULLLOG
+{
+	template <typename T>
+	NULLLOG &operator<<(const T&) { return *this; }
+};
+#define LOG_DBG NULLLOG()
+
+class m_IDirect3D9Ex;
+class m_IDirect3DDevice9Ex;
+class m_IDirect3DCubeTexture9;
+class m_IDirect3DIndexBuffer9;
+class m_IDirect3DPixelShader9;
+class m_IDirect3DQuery9;
+class m_IDirect3DStateBlock9;
+class m_IDirect3DSurface9;
+class m_IDirect3DSwapChain9Ex;
+class m_IDirect3DTexture9;
+class m_IDirect3DVertexBuffer9;
+class m_IDirect3DVertexDeclaration9;
+class m_IDirect3DVertexShader9;
+class m_IDirect3DVolume9;
+class m_IDirect3DVolumeTexture9;
+
+#include "../AddressLookupTable.h"
+
+namespace
+{
+	constexpr size_t ObjectsPerIteration = 64;
+	constexpr DWORD AliveMagic = 0xA11FE;
+
+	std::atomic<LONG> LiveWrappers = 0;
+	std::atomic<LONG> Errors = 0;
+
+	// Proxy object of the fake runtime, released proxies go back to the runtime freelist
+	struct FAKEPROXY
+	{
+		std::atomic<ULONG> Ref = 1;
+
+		ULONG AddRef() { return ++Ref; }
+		ULONG Release();
+	};
+
+	std::mutex RuntimeLock;
+	std::vector<FAKEPROXY*> RuntimeFreelist;
+
+	FAKEPROXY *RuntimeCreate()
+	{
+		std::lock_guard<std::mutex> Lock(RuntimeLock);
+		if (RuntimeFreelist.empty())
+		{
+			return new FAKEPROXY;
+		}
+		FAKEPROXY *Proxy = RuntimeFreelist.back();
+		RuntimeFreelist.pop_back();
+		Proxy->Ref = 1;
+		return Proxy;
+	}
+
+	ULONG FAKEPROXY::Release()
+	{
+		ULONG ref = --Ref;
+		if (ref == 0)
+		{
+			std::lock_guard<std::mutex> Lock(RuntimeLock);
+			RuntimeFreelist.push_back(this);
+		}
+		return ref;
+	}
+
+	struct FAKEDEVICE
+	{
+		AddressLookupTableD3d9<FAKEDEVICE> *ProxyAddressLookupTable;
+	};
+}
+
+class m_IDirect3DTexture9 : public AddressLookupTableD3d9Object
+{
+private:
+	FAKEPROXY *ProxyInterface;
+	FAKEDEVICE *m_pDeviceEx;
+	DWORD Magic = AliveMagic;
+
+public:
+	m_IDirect3DTexture9(void *pProxy, FAKEDEVICE *pDevice) : ProxyInterface((FAKEPROXY*)pProxy), m_pDeviceEx(pDevice)
+	{
+		LiveWrappers++;
+		pDevice->ProxyAddressLookupTable->SaveAddress(this, ProxyInterface);
+	}
+	~m_IDirect3DTexture9()
+	{
+		if (Magic != AliveMagic)
+		{
+			Errors++;
+		}
+		Magic = 0;
+		LiveWrappers--;
+	}
+
+	ULONG AddRef()
+	{
+		Check();
+		return ProxyInterface->AddRef();
+	}
+	ULONG Release()
+	{
+		Check();
+		return m_pDeviceEx->ProxyAddressLookupTable->ReleaseInterface(this, ProxyInterface);
+	}
+	void Check()
+	{
+		if (Magic != AliveMagic)
+		{
+			Errors++;
+		}
+	}
+	FAKEPROXY *GetProxyInterface() { return ProxyInterface; }
+};
+
+class m_IDirect3DSwapChain9Ex : public AddressLookupTableD3d9Object
+{
+public:
+	m_IDirect3DSwapChain9Ex(void*, FAKEDEVICE*, REFIID) {}
+};
+
+// Creates and releases textures, half of them are also looked up again like GetTexture would
+static void Churn(FAKEDEVICE *pDevice, size_t Iterations, unsigned Seed)
+{
+	std::vector<m_IDirect3DTexture9*> Textures(ObjectsPerIteration);
+	for (size_t x = 0; x < Iterations; x++)
+	{
+		for (auto &Texture : Textures)
+		{
+			Texture = pDevice->ProxyAddressLookupTable->CreateInterface<m_IDirect3DTexture9>(RuntimeCreate());
+		}
+		for (size_t y = 0; y < Textures.size(); y += 2)
+		{
+			FAKEPROXY *Proxy = Textures[y]->GetProxyInterface();
+			Proxy->AddRef();
+			if (pDevice->ProxyAddressLookupTable->FindAddress<m_IDirect3DTexture9>(Proxy) != Textures[y])
+			{
+				Errors++;
+			}
+			Textures[y]->Release();
+		}
+		for (size_t y = 0; y < Textures.size(); y++)
+		{
+			Textures[(y * 7 + Seed) % Textures.size()]->Release();
+		}
+	}
+}
+
+static double Run(DWORD PoolSize, size_t Iterations, size_t ThreadCount)
+{
+	Config.D3d9WrapperPoolSize = PoolSize;
+	FAKEDEVICE Device;
+	Device.ProxyAddressLookupTable = new AddressLookupTableD3d9<FAKEDEVICE>(&Device);
+
+	auto Start = std::chrono::steady_clock::now();
+	std::vector<std::thread> Threads;
+	for (size_t x = 0; x < ThreadCount; x++)
+	{
+		Threads.emplace_back(Churn, &Device, Iterations, (unsigned)x);
+	}
+	for (auto &Thread : Threads)
+	{
+		Thread.join();
+	}
+	auto End = std::chrono::steady_clock::now();
+
+	const AddressPoolStats &Stats = Device.ProxyAddressLookupTable->GetPoolStats<m_IDirect3DTexture9>();
+	printf("  pool %-4lu allocated %-8lu reused %-8lu recycled %-8lu freed %lu\n", PoolSize, Stats.Allocated, Stats.Reused, Stats.Recycled, Stats.Freed);
+	delete Device.ProxyAddressLookupTable;
+
+	const double Pairs = (double)Iterations * ObjectsPerIteration * ThreadCount;
+	return std::chrono::duration<double, std::nano>(End - Start).count() / Pairs;
+}
+
+int main(int argc, char *argv[])
+{
+	const size_t Iterations = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 20000;
+	const size_t ThreadCount = (argc > 2) ? strtoul(argv[2], nullptr, 10) : 4;
+
+	for (size_t Threads : { (size_t)1, ThreadCount })
+	{
+		printf("%zu thread(s), %zu x %zu create/release pairs per thread\n", Threads, Iterations, ObjectsPerIteration);
+		const double Heap = Run(0, Iterations, Threads);
+		const double Pooled = Run(256, Iterations, Threads);
+		printf("  heap   %7.1f ns per pair\n  pooled %7.1f ns per pair\n", Heap, Pooled);
+	}
+
+	for (FAKEPROXY *Proxy : RuntimeFreelist)
+	{
+		delete Proxy;
+	}
+
+	if (Errors || LiveWrappers)
+	{
+		printf("FAILED: %ld wrapper errors, %ld wrappers left\n", (long)Errors, (long)LiveWrappers);
+		return 1;
+	}
+	return 0;
+}
@@ -29,7 +29,7 @@ void AdjustWindow(HWND MainhWnd, LONG displayWidth, LONG displayHeight);
 
 HRESULT m_IDirect3D9Ex::QueryInterface(REFIID riid, void** ppvObj)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	if ((riid == IID_IUnknown || riid == WrapperID) && ppvObj)
 	{
@@ -45,14 +45,14 @@ HRESULT m_IDirect3D9Ex::QueryInterface(REFIID riid, void** ppvObj)
 
 ULONG m_IDirect3D9Ex::AddRef()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->AddRef();
 }
 
 ULONG m_IDirect3D9Ex::Release()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	ULONG ref = ProxyInterface->Release();
 
@@ -87,77 +87,77 @@ void m_IDirect3D9Ex::LogAdapterNames()
 
 HRESULT m_IDirect3D9Ex::EnumAdapterModes(THIS_ UINT Adapter, D3DFORMAT Format, UINT Mode, D3DDISPLAYMODE* pMode)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->EnumAdapterModes(Adapter, Format, Mode, pMode);
 }
 
 UINT m_IDirect3D9Ex::GetAdapterCount()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->GetAdapterCount();
 }
 
 HRESULT m_IDirect3D9Ex::GetAdapterDisplayMode(UINT Adapter, D3DDISPLAYMODE *pMode)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->GetAdapterDisplayMode(Adapter, pMode);
 }
 
 HRESULT m_IDirect3D9Ex::GetAdapterIdentifier(UINT Adapter, DWORD Flags, D3DADAPTER_IDENTIFIER9 *pIdentifier)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->GetAdapterIdentifier(Adapter, Flags, pIdentifier);
 }
 
 UINT m_IDirect3D9Ex::GetAdapterModeCount(THIS_ UINT Adapter, D3DFORMAT Format)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->GetAdapterModeCount(Adapter, Format);
 }
 
 HMONITOR m_IDirect3D9Ex::GetAdapterMonitor(UINT Adapter)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->GetAdapterMonitor(Adapter);
 }
 
 HRESULT m_IDirect3D9Ex::GetDeviceCaps(UINT Adapter, D3DDEVTYPE DeviceType, D3DCAPS9 *pCaps)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->GetDeviceCaps(Adapter, DeviceType, pCaps);
 }
 
 HRESULT m_IDirect3D9Ex::RegisterSoftwareDevice(void *pInitializeFunction)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->RegisterSoftwareDevice(pInitializeFunction);
 }
 
 HRESULT m_IDirect3D9Ex::CheckDepthStencilMatch(UINT Adapter, D3DDEVTYPE DeviceType, D3DFORMAT AdapterFormat, D3DFORMAT RenderTargetFormat, D3DFORMAT DepthStencilFormat)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->CheckDepthStencilMatch(Adapter, DeviceType, AdapterFormat, RenderTargetFormat, DepthStencilFormat);
 }
 
 HRESULT m_IDirect3D9Ex::CheckDeviceFormat(UINT Adapter, D3DDEVTYPE DeviceType, D3DFORMAT AdapterFormat, DWORD Usage, D3DRESOURCETYPE RType, D3DFORMAT CheckFormat)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->CheckDeviceFormat(Adapter, DeviceType, AdapterFormat, Usage, RType, CheckFormat);
 }
 
 HRESULT m_IDirect3D9Ex::CheckDeviceMultiSampleType(THIS_ UINT Adapter, D3DDEVTYPE DeviceType, D3DFORMAT SurfaceFormat, BOOL Windowed, D3DMULTISAMPLE_TYPE MultiSampleType, DWORD* pQualityLevels)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	if (Config.EnableWindowMode)
 	{
@@ -169,7 +169,7 @@ HRESULT m_IDirect3D9Ex::CheckDeviceMultiSampleType(THIS_ UINT Adapter, D3DDEVTYP
 
 HRESULT m_IDirect3D9Ex::CheckDeviceType(UINT Adapter, D3DDEVTYPE CheckType, D3DFORMAT DisplayFormat, D3DFORMAT BackBufferFormat, BOOL Windowed)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	if (Config.EnableWindowMode)
 	{
@@ -181,7 +181,7 @@ HRESULT m_IDirect3D9Ex::CheckDeviceType(UINT Adapter, D3DDEVTYPE CheckType, D3DF
 
 HRESULT m_IDirect3D9Ex::CheckDeviceFormatConversion(THIS_ UINT Adapter, D3DDEVTYPE DeviceType, D3DFORMAT SourceFormat, D3DFORMAT TargetFormat)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->CheckDeviceFormatConversion(Adapter, DeviceType, SourceFormat, TargetFormat);
 }
@@ -261,7 +261,7 @@ HRESULT m_IDirect3D9Ex::CreateDeviceT(D3DPRESENT_PARAMETERS& d3dpp, bool& MultiS
 
 HRESULT m_IDirect3D9Ex::CreateDevice(UINT Adapter, D3DDEVTYPE DeviceType, HWND hFocusWindow, DWORD BehaviorFlags, D3DPRESENT_PARAMETERS *pPresentationParameters, IDirect3DDevice9 **ppReturnedDeviceInterface)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	if (!pPresentationParameters || !ppReturnedDeviceInterface)
 	{
@@ -281,13 +281,13 @@ HRESULT m_IDirect3D9Ex::CreateDevice(UINT Adapter, D3DDEVTYPE DeviceType, HWND h
 		return D3D_OK;
 	}
 
-	Logging::LogDebug() << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << Adapter << " " << DeviceType << " " << hFocusWindow << " " << BehaviorFlags << " " << pPresentationParameters;
+	LOG_DBG << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << Adapter << " " << DeviceType << " " << hFocusWindow << " " << BehaviorFlags << " " << pPresentationParameters;
 	return hr;
 }
 
 UINT m_IDirect3D9Ex::GetAdapterModeCountEx(THIS_ UINT Adapter, CONST D3DDISPLAYMODEFILTER* pFilter)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	if (!ProxyInterfaceEx)
 	{
@@ -300,7 +300,7 @@ UINT m_IDirect3D9Ex::GetAdapterModeCountEx(THIS_ UINT Adapter, CONST D3DDISPLAYM
 
 HRESULT m_IDirect3D9Ex::EnumAdapterModesEx(THIS_ UINT Adapter, CONST D3DDISPLAYMODEFILTER* pFilter, UINT Mode, D3DDISPLAYMODEEX* pMode)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	if (!ProxyInterfaceEx)
 	{
@@ -313,7 +313,7 @@ HRESULT m_IDirect3D9Ex::EnumAdapterModesEx(THIS_ UINT Adapter, CONST D3DDISPLAYM
 
 HRESULT m_IDirect3D9Ex::GetAdapterDisplayModeEx(THIS_ UINT Adapter, D3DDISPLAYMODEEX* pMode, D3DDISPLAYROTATION* pRotation)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	if (!ProxyInterfaceEx)
 	{
@@ -326,7 +326,7 @@ HRESULT m_IDirect3D9Ex::GetAdapterDisplayModeEx(THIS_ UINT Adapter, D3DDISPLAYMO
 
 HRESULT m_IDirect3D9Ex::CreateDeviceEx(THIS_ UINT Adapter, D3DDEVTYPE DeviceType, HWND hFocusWindow, DWORD BehaviorFlags, D3DPRESENT_PARAMETERS* pPresentationParameters, D3DDISPLAYMODEEX* pFullscreenDisplayMode, IDirect3DDevice9Ex** ppReturnedDeviceInterface)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	if (!pPresentationParameters || !ppReturnedDeviceInterface)
 	{
@@ -346,13 +346,13 @@ HRESULT m_IDirect3D9Ex::CreateDeviceEx(THIS_ UINT Adapter, D3DDEVTYPE DeviceType
 		return D3D_OK;
 	}
 
-	Logging::LogDebug() << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << Adapter << " " << DeviceType << " " << hFocusWindow << " " << BehaviorFlags << " " << pPresentationParameters << " " << pFullscreenDisplayMode;
+	LOG_DBG << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << Adapter << " " << DeviceType << " " << hFocusWindow << " " << BehaviorFlags << " " << pPresentationParameters << " " << pFullscreenDisplayMode;
 	return hr;
 }
 
 HRESULT m_IDirect3D9Ex::GetAdapterLUID(THIS_ UINT Adapter, LUID * pLUID)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	if (!ProxyInterfaceEx)
 	{
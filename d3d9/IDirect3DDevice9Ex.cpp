@@ -17,11 +17,15 @@
 #include "d3d9.h"
 #include "d3dx9.h"
 #include "Utils\Utils.h"
+#include "Logging\Trace.h"
+#include "Logging\CallStats.h"
+#include "Logging\ChromeTrace.h"
 #include <intrin.h>
 
 HRESULT m_IDirect3DDevice9Ex::QueryInterface(REFIID riid, void** ppvObj)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if ((riid == IID_IUnknown || riid == WrapperID) && ppvObj)
 	{
@@ -44,14 +48,16 @@ HRESULT m_IDirect3DDevice9Ex::QueryInterface(REFIID riid, void** ppvObj)
 
 ULONG m_IDirect3DDevice9Ex::AddRef()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->AddRef();
 }
 
 ULONG m_IDirect3DDevice9Ex::Release()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	ULONG ref = ProxyInterface->Release();
 
@@ -137,7 +143,8 @@ HRESULT m_IDirect3DDevice9Ex::ResetT(T func, D3DPRESENT_PARAMETERS &d3dpp, D3DPR
 
 HRESULT m_IDirect3DDevice9Ex::Reset(D3DPRESENT_PARAMETERS *pPresentationParameters)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!pPresentationParameters)
 	{
@@ -163,21 +170,26 @@ HRESULT m_IDirect3DDevice9Ex::Reset(D3DPRESENT_PARAMETERS *pPresentationParamete
 
 HRESULT m_IDirect3DDevice9Ex::EndScene()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_TRACE(D3d9EndScene, this);
+	LOG_CALLSTATS();
+	LOG_CHROMETRACE();
 
 	return ProxyInterface->EndScene();
 }
 
 void m_IDirect3DDevice9Ex::SetCursorPosition(int X, int Y, DWORD Flags)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->SetCursorPosition(X, Y, Flags);
 }
 
 HRESULT m_IDirect3DDevice9Ex::SetCursorProperties(UINT XHotSpot, UINT YHotSpot, IDirect3DSurface9 *pCursorBitmap)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (pCursorBitmap)
 	{
@@ -189,14 +201,16 @@ HRESULT m_IDirect3DDevice9Ex::SetCursorProperties(UINT XHotSpot, UINT YHotSpot,
 
 BOOL m_IDirect3DDevice9Ex::ShowCursor(BOOL bShow)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->ShowCursor(bShow);
 }
 
 HRESULT m_IDirect3DDevice9Ex::CreateAdditionalSwapChain(D3DPRESENT_PARAMETERS *pPresentationParameters, IDirect3DSwapChain9 **ppSwapChain)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!pPresentationParameters || !ppSwapChain)
 	{
@@ -245,17 +259,18 @@ HRESULT m_IDirect3DDevice9Ex::CreateAdditionalSwapChain(D3DPRESENT_PARAMETERS *p
 	{
 		CopyMemory(pPresentationParameters, &d3dpp, sizeof(D3DPRESENT_PARAMETERS));
 
-		*ppSwapChain = new m_IDirect3DSwapChain9Ex((IDirect3DSwapChain9Ex*)*ppSwapChain, this);
+		*ppSwapChain = ProxyAddressLookupTable->CreateInterface(*ppSwapChain, IID_IDirect3DSwapChain9);
 		return D3D_OK;
 	}
 
-	Logging::LogDebug() << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << *pPresentationParameters;
+	LOG_DBG << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << *pPresentationParameters;
 	return hr;
 }
 
 HRESULT m_IDirect3DDevice9Ex::CreateCubeTexture(THIS_ UINT EdgeLength, UINT Levels, DWORD Usage, D3DFORMAT Format, D3DPOOL Pool, IDirect3DCubeTexture9** ppCubeTexture, HANDLE* pSharedHandle)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!ppCubeTexture)
 	{
@@ -266,17 +281,18 @@ HRESULT m_IDirect3DDevice9Ex::CreateCubeTexture(THIS_ UINT EdgeLength, UINT Leve
 
 	if (SUCCEEDED(hr))
 	{
-		*ppCubeTexture = new m_IDirect3DCubeTexture9(*ppCubeTexture, this);
+		*ppCubeTexture = ProxyAddressLookupTable->CreateInterface<m_IDirect3DCubeTexture9>(*ppCubeTexture);
 		return D3D_OK;
 	}
 
-	Logging::LogDebug() << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << EdgeLength << " " << Levels << " " << Usage << " " << Format << " " << Pool << " " << pSharedHandle;
+	LOG_DBG << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << EdgeLength << " " << Levels << " " << Usage << " " << Format << " " << Pool << " " << pSharedHandle;
 	return hr;
 }
 
 HRESULT m_IDirect3DDevice9Ex::CreateDepthStencilSurface(THIS_ UINT Width, UINT Height, D3DFORMAT Format, D3DMULTISAMPLE_TYPE MultiSample, DWORD MultisampleQuality, BOOL Discard, IDirect3DSurface9** ppSurface, HANDLE* pSharedHandle)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!ppSurface)
 	{
@@ -287,17 +303,18 @@ HRESULT m_IDirect3DDevice9Ex::CreateDepthStencilSurface(THIS_ UINT Width, UINT H
 
 	if (SUCCEEDED(hr))
 	{
-		*ppSurface = new m_IDirect3DSurface9(*ppSurface, this);
+		*ppSurface = ProxyAddressLookupTable->CreateInterface<m_IDirect3DSurface9>(*ppSurface);
 		return D3D_OK;
 	}
 
-	Logging::LogDebug() << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << Width << " " << Height << " " << Format << " " << MultiSample << " " << MultisampleQuality << " " << Discard << " " << pSharedHandle;
+	LOG_DBG << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << Width << " " << Height << " " << Format << " " << MultiSample << " " << MultisampleQuality << " " << Discard << " " << pSharedHandle;
 	return hr;
 }
 
 HRESULT m_IDirect3DDevice9Ex::CreateIndexBuffer(THIS_ UINT Length, DWORD Usage, D3DFORMAT Format, D3DPOOL Pool, IDirect3DIndexBuffer9** ppIndexBuffer, HANDLE* pSharedHandle)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!ppIndexBuffer)
 	{
@@ -308,17 +325,18 @@ HRESULT m_IDirect3DDevice9Ex::CreateIndexBuffer(THIS_ UINT Length, DWORD Usage,
 
 	if (SUCCEEDED(hr))
 	{
-		*ppIndexBuffer = new m_IDirect3DIndexBuffer9(*ppIndexBuffer, this);
+		*ppIndexBuffer = ProxyAddressLookupTable->CreateInterface<m_IDirect3DIndexBuffer9>(*ppIndexBuffer);
 		return D3D_OK;
 	}
 
-	Logging::LogDebug() << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << Length << " " << Usage << " " << Format << " " << Pool << " " << pSharedHandle;
+	LOG_DBG << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << Length << " " << Usage << " " << Format << " " << Pool << " " << pSharedHandle;
 	return hr;
 }
 
 HRESULT m_IDirect3DDevice9Ex::CreateRenderTarget(THIS_ UINT Width, UINT Height, D3DFORMAT Format, D3DMULTISAMPLE_TYPE MultiSample, DWORD MultisampleQuality, BOOL Lockable, IDirect3DSurface9** ppSurface, HANDLE* pSharedHandle)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!ppSurface)
 	{
@@ -329,17 +347,18 @@ HRESULT m_IDirect3DDevice9Ex::CreateRenderTarget(THIS_ UINT Width, UINT Height,
 
 	if (SUCCEEDED(hr))
 	{
-		*ppSurface = new m_IDirect3DSurface9(*ppSurface, this);
+		*ppSurface = ProxyAddressLookupTable->CreateInterface<m_IDirect3DSurface9>(*ppSurface);
 		return D3D_OK;
 	}
 
-	Logging::LogDebug() << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << Width << " " << Height << " " << Format << " " << MultiSample << " " << MultisampleQuality << " " << Lockable << " " << pSharedHandle;
+	LOG_DBG << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << Width << " " << Height << " " << Format << " " << MultiSample << " " << MultisampleQuality << " " << Lockable << " " << pSharedHandle;
 	return hr;
 }
 
 HRESULT m_IDirect3DDevice9Ex::CreateTexture(THIS_ UINT Width, UINT Height, UINT Levels, DWORD Usage, D3DFORMAT Format, D3DPOOL Pool, IDirect3DTexture9** ppTexture, HANDLE* pSharedHandle)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!ppTexture)
 	{
@@ -350,17 +369,18 @@ HRESULT m_IDirect3DDevice9Ex::CreateTexture(THIS_ UINT Width, UINT Height, UINT
 
 	if (SUCCEEDED(hr))
 	{
-		*ppTexture = new m_IDirect3DTexture9(*ppTexture, this);
+		*ppTexture = ProxyAddressLookupTable->CreateInterface<m_IDirect3DTexture9>(*ppTexture);
 		return D3D_OK;
 	}
 
-	Logging::LogDebug() << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << Width << " " << Height << " " << Levels << " " << Usage << " " << Format << " " << Pool << " " << pSharedHandle;
+	LOG_DBG << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << Width << " " << Height << " " << Levels << " " << Usage << " " << Format << " " << Pool << " " << pSharedHandle;
 	return hr;
 }
 
 HRESULT m_IDirect3DDevice9Ex::CreateVertexBuffer(THIS_ UINT Length, DWORD Usage, DWORD FVF, D3DPOOL Pool, IDirect3DVertexBuffer9** ppVertexBuffer, HANDLE* pSharedHandle)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!ppVertexBuffer)
 	{
@@ -377,17 +397,18 @@ HRESULT m_IDirect3DDevice9Ex::CreateVertexBuffer(THIS_ UINT Length, DWORD Usage,
 
 	if (SUCCEEDED(hr))
 	{
-		*ppVertexBuffer = new m_IDirect3DVertexBuffer9(*ppVertexBuffer, this);
+		*ppVertexBuffer = ProxyAddressLookupTable->CreateInterface<m_IDirect3DVertexBuffer9>(*ppVertexBuffer);
 		return D3D_OK;
 	}
 
-	Logging::LogDebug() << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << Length << " " << Usage << " " << FVF << " " << Pool << " " << pSharedHandle;
+	LOG_DBG << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << Length << " " << Usage << " " << FVF << " " << Pool << " " << pSharedHandle;
 	return hr;
 }
 
 HRESULT m_IDirect3DDevice9Ex::CreateVolumeTexture(THIS_ UINT Width, UINT Height, UINT Depth, UINT Levels, DWORD Usage, D3DFORMAT Format, D3DPOOL Pool, IDirect3DVolumeTexture9** ppVolumeTexture, HANDLE* pSharedHandle)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!ppVolumeTexture)
 	{
@@ -398,24 +419,26 @@ HRESULT m_IDirect3DDevice9Ex::CreateVolumeTexture(THIS_ UINT Width, UINT Height,
 
 	if (SUCCEEDED(hr))
 	{
-		*ppVolumeTexture = new m_IDirect3DVolumeTexture9(*ppVolumeTexture, this);
+		*ppVolumeTexture = ProxyAddressLookupTable->CreateInterface<m_IDirect3DVolumeTexture9>(*ppVolumeTexture);
 		return D3D_OK;
 	}
 
-	Logging::LogDebug() << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << Width << " " << Height << " " << Depth << " " << Levels << " " << Usage << " " << Format << " " << Pool << " " << pSharedHandle;
+	LOG_DBG << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << Width << " " << Height << " " << Depth << " " << Levels << " " << Usage << " " << Format << " " << Pool << " " << pSharedHandle;
 	return hr;
 }
 
 HRESULT m_IDirect3DDevice9Ex::BeginStateBlock()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->BeginStateBlock();
 }
 
 HRESULT m_IDirect3DDevice9Ex::CreateStateBlock(THIS_ D3DSTATEBLOCKTYPE Type, IDirect3DStateBlock9** ppSB)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!ppSB)
 	{
@@ -426,17 +449,18 @@ HRESULT m_IDirect3DDevice9Ex::CreateStateBlock(THIS_ D3DSTATEBLOCKTYPE Type, IDi
 
 	if (SUCCEEDED(hr))
 	{
-		*ppSB = new m_IDirect3DStateBlock9(*ppSB, this);
+		*ppSB = ProxyAddressLookupTable->CreateInterface<m_IDirect3DStateBlock9>(*ppSB);
 		return D3D_OK;
 	}
 
-	Logging::LogDebug() << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << Type;
+	LOG_DBG << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << Type;
 	return hr;
 }
 
 HRESULT m_IDirect3DDevice9Ex::EndStateBlock(THIS_ IDirect3DStateBlock9** ppSB)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	HRESULT hr = ProxyInterface->EndStateBlock(ppSB);
 
@@ -450,28 +474,32 @@ HRESULT m_IDirect3DDevice9Ex::EndStateBlock(THIS_ IDirect3DStateBlock9** ppSB)
 
 HRESULT m_IDirect3DDevice9Ex::GetClipStatus(D3DCLIPSTATUS9 *pClipStatus)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetClipStatus(pClipStatus);
 }
 
 HRESULT m_IDirect3DDevice9Ex::GetDisplayMode(THIS_ UINT iSwapChain, D3DDISPLAYMODE* pMode)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetDisplayMode(iSwapChain, pMode);
 }
 
 HRESULT m_IDirect3DDevice9Ex::GetRenderState(D3DRENDERSTATETYPE State, DWORD *pValue)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetRenderState(State, pValue);
 }
 
 HRESULT m_IDirect3DDevice9Ex::GetRenderTarget(THIS_ DWORD RenderTargetIndex, IDirect3DSurface9** ppRenderTarget)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	HRESULT hr = ProxyInterface->GetRenderTarget(RenderTargetIndex, ppRenderTarget);
 
@@ -485,21 +513,25 @@ HRESULT m_IDirect3DDevice9Ex::GetRenderTarget(THIS_ DWORD RenderTargetIndex, IDi
 
 HRESULT m_IDirect3DDevice9Ex::GetTransform(D3DTRANSFORMSTATETYPE State, D3DMATRIX *pMatrix)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetTransform(State, pMatrix);
 }
 
 HRESULT m_IDirect3DDevice9Ex::SetClipStatus(CONST D3DCLIPSTATUS9 *pClipStatus)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->SetClipStatus(pClipStatus);
 }
 
 HRESULT m_IDirect3DDevice9Ex::SetRenderState(D3DRENDERSTATETYPE State, DWORD Value)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_TRACE(D3d9SetRenderState, this, State, Value);
+	LOG_CALLSTATS();
 
 	// Set for Multisample
 	if (DeviceMultiSampleFlag && State == D3DRS_MULTISAMPLEANTIALIAS)
@@ -520,7 +552,9 @@ HRESULT m_IDirect3DDevice9Ex::SetRenderState(D3DRENDERSTATETYPE State, DWORD Val
 
 HRESULT m_IDirect3DDevice9Ex::SetRenderTarget(THIS_ DWORD RenderTargetIndex, IDirect3DSurface9* pRenderTarget)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_TRACE(D3d9SetRenderTarget, this, RenderTargetIndex, pRenderTarget);
+	LOG_CALLSTATS();
 
 	if (pRenderTarget)
 	{
@@ -532,49 +566,57 @@ HRESULT m_IDirect3DDevice9Ex::SetRenderTarget(THIS_ DWORD RenderTargetIndex, IDi
 
 HRESULT m_IDirect3DDevice9Ex::SetTransform(D3DTRANSFORMSTATETYPE State, CONST D3DMATRIX *pMatrix)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_TRACE(D3d9SetTransform, this, State, pMatrix);
+	LOG_CALLSTATS();
 
 	return ProxyInterface->SetTransform(State, pMatrix);
 }
 
 void m_IDirect3DDevice9Ex::GetGammaRamp(THIS_ UINT iSwapChain, D3DGAMMARAMP* pRamp)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetGammaRamp(iSwapChain, pRamp);
 }
 
 void m_IDirect3DDevice9Ex::SetGammaRamp(THIS_ UINT iSwapChain, DWORD Flags, CONST D3DGAMMARAMP* pRamp)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->SetGammaRamp(iSwapChain, Flags, pRamp);
 }
 
 HRESULT m_IDirect3DDevice9Ex::DeletePatch(UINT Handle)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->DeletePatch(Handle);
 }
 
 HRESULT m_IDirect3DDevice9Ex::DrawRectPatch(UINT Handle, CONST float *pNumSegs, CONST D3DRECTPATCH_INFO *pRectPatchInfo)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->DrawRectPatch(Handle, pNumSegs, pRectPatchInfo);
 }
 
 HRESULT m_IDirect3DDevice9Ex::DrawTriPatch(UINT Handle, CONST float *pNumSegs, CONST D3DTRIPATCH_INFO *pTriPatchInfo)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->DrawTriPatch(Handle, pNumSegs, pTriPatchInfo);
 }
 
 HRESULT m_IDirect3DDevice9Ex::GetIndices(THIS_ IDirect3DIndexBuffer9** ppIndexData)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	HRESULT hr = ProxyInterface->GetIndices(ppIndexData);
 
@@ -588,7 +630,9 @@ HRESULT m_IDirect3DDevice9Ex::GetIndices(THIS_ IDirect3DIndexBuffer9** ppIndexDa
 
 HRESULT m_IDirect3DDevice9Ex::SetIndices(THIS_ IDirect3DIndexBuffer9* pIndexData)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_TRACE(D3d9SetIndices, this, pIndexData);
+	LOG_CALLSTATS();
 
 	if (pIndexData)
 	{
@@ -600,28 +644,32 @@ HRESULT m_IDirect3DDevice9Ex::SetIndices(THIS_ IDirect3DIndexBuffer9* pIndexData
 
 UINT m_IDirect3DDevice9Ex::GetAvailableTextureMem()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetAvailableTextureMem();
 }
 
 HRESULT m_IDirect3DDevice9Ex::GetCreationParameters(D3DDEVICE_CREATION_PARAMETERS *pParameters)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetCreationParameters(pParameters);
 }
 
 HRESULT m_IDirect3DDevice9Ex::GetDeviceCaps(D3DCAPS9 *pCaps)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetDeviceCaps(pCaps);
 }
 
 HRESULT m_IDirect3DDevice9Ex::GetDirect3D(IDirect3D9 **ppD3D9)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!ppD3D9)
 	{
@@ -637,35 +685,40 @@ HRESULT m_IDirect3DDevice9Ex::GetDirect3D(IDirect3D9 **ppD3D9)
 
 HRESULT m_IDirect3DDevice9Ex::GetRasterStatus(THIS_ UINT iSwapChain, D3DRASTER_STATUS* pRasterStatus)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetRasterStatus(iSwapChain, pRasterStatus);
 }
 
 HRESULT m_IDirect3DDevice9Ex::GetLight(DWORD Index, D3DLIGHT9 *pLight)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetLight(Index, pLight);
 }
 
 HRESULT m_IDirect3DDevice9Ex::GetLightEnable(DWORD Index, BOOL *pEnable)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetLightEnable(Index, pEnable);
 }
 
 HRESULT m_IDirect3DDevice9Ex::GetMaterial(D3DMATERIAL9 *pMaterial)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetMaterial(pMaterial);
 }
 
 HRESULT m_IDirect3DDevice9Ex::LightEnable(DWORD LightIndex, BOOL bEnable)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->LightEnable(LightIndex, bEnable);
 }
@@ -673,28 +726,32 @@ HRESULT m_IDirect3DDevice9Ex::LightEnable(DWORD LightIndex, BOOL bEnable)
 HRESULT m_IDirect3DDevice9Ex::SetLight(DWORD Index, CONST D3DLIGHT9 *pLight)
 {
 
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->SetLight(Index, pLight);
 }
 
 HRESULT m_IDirect3DDevice9Ex::SetMaterial(CONST D3DMATERIAL9 *pMaterial)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->SetMaterial(pMaterial);
 }
 
 HRESULT m_IDirect3DDevice9Ex::MultiplyTransform(D3DTRANSFORMSTATETYPE State, CONST D3DMATRIX *pMatrix)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->MultiplyTransform(State, pMatrix);
 }
 
 HRESULT m_IDirect3DDevice9Ex::ProcessVertices(THIS_ UINT SrcStartIndex, UINT DestIndex, UINT VertexCount, IDirect3DVertexBuffer9* pDestBuffer, IDirect3DVertexDeclaration9* pVertexDecl, DWORD Flags)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (pDestBuffer)
 	{
@@ -711,63 +768,94 @@ HRESULT m_IDirect3DDevice9Ex::ProcessVertices(THIS_ UINT SrcStartIndex, UINT Des
 
 HRESULT m_IDirect3DDevice9Ex::TestCooperativeLevel()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->TestCooperativeLevel();
 }
 
 HRESULT m_IDirect3DDevice9Ex::GetCurrentTexturePalette(UINT *pPaletteNumber)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetCurrentTexturePalette(pPaletteNumber);
 }
 
 HRESULT m_IDirect3DDevice9Ex::GetPaletteEntries(UINT PaletteNumber, PALETTEENTRY *pEntries)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetPaletteEntries(PaletteNumber, pEntries);
 }
 
 HRESULT m_IDirect3DDevice9Ex::SetCurrentTexturePalette(UINT PaletteNumber)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->SetCurrentTexturePalette(PaletteNumber);
 }
 
 HRESULT m_IDirect3DDevice9Ex::SetPaletteEntries(UINT PaletteNumber, CONST PALETTEENTRY *pEntries)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->SetPaletteEntries(PaletteNumber, pEntries);
 }
 
 HRESULT m_IDirect3DDevice9Ex::CreatePixelShader(THIS_ CONST DWORD* pFunction, IDirect3DPixelShader9** ppShader)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!ppShader)
 	{
 		return D3DERR_INVALIDCALL;
 	}
 
+	// Share the existing shader if this bytecode was already created, so the driver compile is skipped
+	const UINT Size = Config.D3d9ShaderCache ? ShaderBytecodeCache::GetFunctionSize(pFunction, 0xFFFF) : 0;
+	const UINT64 Hash = Size ? ShaderBytecodeCache::GetFunctionHash(pFunction, Size) : 0;
+	if (Size)
+	{
+		IDirect3DPixelShader9 *pCachedShader = (IDirect3DPixelShader9*)PixelShaderCache.Find(pFunction, Size, Hash);
+		if (pCachedShader)
+		{
+			*ppShader = ProxyAddressLookupTable->FindAddress<m_IDirect3DPixelShader9>(pCachedShader);
+			return D3D_OK;
+		}
+	}
+
 	HRESULT hr = ProxyInterface->CreatePixelShader(pFunction, ppShader);
 
 	if (SUCCEEDED(hr))
 	{
-		*ppShader = new m_IDirect3DPixelShader9(*ppShader, this);
+		if (Size)
+		{
+			IDirect3DPixelShader9 *pCachedShader = (IDirect3DPixelShader9*)PixelShaderCache.FindOrAdd(pFunction, Size, Hash, *ppShader);
+			if (pCachedShader)
+			{
+				(*ppShader)->Release();
+				*ppShader = ProxyAddressLookupTable->FindAddress<m_IDirect3DPixelShader9>(pCachedShader);
+				return D3D_OK;
+			}
+		}
+
+		*ppShader = ProxyAddressLookupTable->CreateInterface<m_IDirect3DPixelShader9>(*ppShader);
 		return D3D_OK;
 	}
 
-	Logging::LogDebug() << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << pFunction;
+	LOG_DBG << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << pFunction;
 	return hr;
 }
 
 HRESULT m_IDirect3DDevice9Ex::GetPixelShader(THIS_ IDirect3DPixelShader9** ppShader)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	HRESULT hr = ProxyInterface->GetPixelShader(ppShader);
 
@@ -781,7 +869,9 @@ HRESULT m_IDirect3DDevice9Ex::GetPixelShader(THIS_ IDirect3DPixelShader9** ppSha
 
 HRESULT m_IDirect3DDevice9Ex::SetPixelShader(THIS_ IDirect3DPixelShader9* pShader)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_TRACE(D3d9SetPixelShader, this, pShader);
+	LOG_CALLSTATS();
 
 	if (pShader)
 	{
@@ -793,14 +883,24 @@ HRESULT m_IDirect3DDevice9Ex::SetPixelShader(THIS_ IDirect3DPixelShader9* pShade
 
 HRESULT m_IDirect3DDevice9Ex::Present(CONST RECT *pSourceRect, CONST RECT *pDestRect, HWND hDestWindowOverride, CONST RGNDATA *pDirtyRegion)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_TRACE(D3d9Present, this, pSourceRect, pDestRect, hDestWindowOverride, pDirtyRegion);
+	LOG_CALLSTATS();
+	LOG_CHROMETRACE();
 
-	return ProxyInterface->Present(pSourceRect, pDestRect, hDestWindowOverride, pDirtyRegion);
+	HRESULT hr = ProxyInterface->Present(pSourceRect, pDestRect, hDestWindowOverride, pDirtyRegion);
+
+	Logging::ChromeTraceFrame();
+
+	return hr;
 }
 
 HRESULT m_IDirect3DDevice9Ex::DrawIndexedPrimitive(THIS_ D3DPRIMITIVETYPE Type, INT BaseVertexIndex, UINT MinVertexIndex, UINT NumVertices, UINT startIndex, UINT primCount)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_TRACE(D3d9DrawIndexedPrimitive, this, Type, BaseVertexIndex, MinVertexIndex, NumVertices, startIndex, primCount);
+	LOG_CALLSTATS();
+	LOG_CHROMETRACE();
 
 	// CacheClipPlane
 	if (Config.CacheClipPlane && isClipPlaneSet)
@@ -819,7 +919,10 @@ HRESULT m_IDirect3DDevice9Ex::DrawIndexedPrimitive(THIS_ D3DPRIMITIVETYPE Type,
 
 HRESULT m_IDirect3DDevice9Ex::DrawIndexedPrimitiveUP(D3DPRIMITIVETYPE PrimitiveType, UINT MinIndex, UINT NumVertices, UINT PrimitiveCount, CONST void *pIndexData, D3DFORMAT IndexDataFormat, CONST void *pVertexStreamZeroData, UINT VertexStreamZeroStride)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_TRACE(D3d9DrawIndexedPrimitiveUP, this, PrimitiveType, MinIndex, NumVertices, PrimitiveCount, pIndexData, IndexDataFormat, pVertexStreamZeroData, VertexStreamZeroStride);
+	LOG_CALLSTATS();
+	LOG_CHROMETRACE();
 
 	// CacheClipPlane
 	if (Config.CacheClipPlane && isClipPlaneSet)
@@ -838,7 +941,10 @@ HRESULT m_IDirect3DDevice9Ex::DrawIndexedPrimitiveUP(D3DPRIMITIVETYPE PrimitiveT
 
 HRESULT m_IDirect3DDevice9Ex::DrawPrimitive(D3DPRIMITIVETYPE PrimitiveType, UINT StartVertex, UINT PrimitiveCount)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_TRACE(D3d9DrawPrimitive, this, PrimitiveType, StartVertex, PrimitiveCount);
+	LOG_CALLSTATS();
+	LOG_CHROMETRACE();
 
 	// CacheClipPlane
 	if (Config.CacheClipPlane && isClipPlaneSet)
@@ -857,7 +963,10 @@ HRESULT m_IDirect3DDevice9Ex::DrawPrimitive(D3DPRIMITIVETYPE PrimitiveType, UINT
 
 HRESULT m_IDirect3DDevice9Ex::DrawPrimitiveUP(D3DPRIMITIVETYPE PrimitiveType, UINT PrimitiveCount, CONST void *pVertexStreamZeroData, UINT VertexStreamZeroStride)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_TRACE(D3d9DrawPrimitiveUP, this, PrimitiveType, PrimitiveCount, pVertexStreamZeroData, VertexStreamZeroStride);
+	LOG_CALLSTATS();
+	LOG_CHROMETRACE();
 
 	// CacheClipPlane
 	if (Config.CacheClipPlane && isClipPlaneSet)
@@ -876,7 +985,10 @@ HRESULT m_IDirect3DDevice9Ex::DrawPrimitiveUP(D3DPRIMITIVETYPE PrimitiveType, UI
 
 HRESULT m_IDirect3DDevice9Ex::BeginScene()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_TRACE(D3d9BeginScene, this);
+	LOG_CALLSTATS();
+	LOG_CHROMETRACE();
 
 	HRESULT hr = ProxyInterface->BeginScene();
 
@@ -910,7 +1022,8 @@ HRESULT m_IDirect3DDevice9Ex::BeginScene()
 
 HRESULT m_IDirect3DDevice9Ex::GetStreamSource(THIS_ UINT StreamNumber, IDirect3DVertexBuffer9** ppStreamData, UINT* OffsetInBytes, UINT* pStride)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	HRESULT hr = ProxyInterface->GetStreamSource(StreamNumber, ppStreamData, OffsetInBytes, pStride);
 
@@ -924,7 +1037,9 @@ HRESULT m_IDirect3DDevice9Ex::GetStreamSource(THIS_ UINT StreamNumber, IDirect3D
 
 HRESULT m_IDirect3DDevice9Ex::SetStreamSource(THIS_ UINT StreamNumber, IDirect3DVertexBuffer9* pStreamData, UINT OffsetInBytes, UINT Stride)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_TRACE(D3d9SetStreamSource, this, StreamNumber, pStreamData, OffsetInBytes, Stride);
+	LOG_CALLSTATS();
 
 	if (pStreamData)
 	{
@@ -936,7 +1051,8 @@ HRESULT m_IDirect3DDevice9Ex::SetStreamSource(THIS_ UINT StreamNumber, IDirect3D
 
 HRESULT m_IDirect3DDevice9Ex::GetBackBuffer(THIS_ UINT iSwapChain, UINT iBackBuffer, D3DBACKBUFFER_TYPE Type, IDirect3DSurface9** ppBackBuffer)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	HRESULT hr = ProxyInterface->GetBackBuffer(iSwapChain, iBackBuffer, Type, ppBackBuffer);
 
@@ -950,7 +1066,8 @@ HRESULT m_IDirect3DDevice9Ex::GetBackBuffer(THIS_ UINT iSwapChain, UINT iBackBuf
 
 HRESULT m_IDirect3DDevice9Ex::GetDepthStencilSurface(IDirect3DSurface9 **ppZStencilSurface)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	HRESULT hr = ProxyInterface->GetDepthStencilSurface(ppZStencilSurface);
 
@@ -964,7 +1081,8 @@ HRESULT m_IDirect3DDevice9Ex::GetDepthStencilSurface(IDirect3DSurface9 **ppZSten
 
 HRESULT m_IDirect3DDevice9Ex::GetTexture(DWORD Stage, IDirect3DBaseTexture9 **ppTexture)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	HRESULT hr = ProxyInterface->GetTexture(Stage, ppTexture);
 
@@ -991,14 +1109,17 @@ HRESULT m_IDirect3DDevice9Ex::GetTexture(DWORD Stage, IDirect3DBaseTexture9 **pp
 
 HRESULT m_IDirect3DDevice9Ex::GetTextureStageState(DWORD Stage, D3DTEXTURESTAGESTATETYPE Type, DWORD *pValue)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetTextureStageState(Stage, Type, pValue);
 }
 
 HRESULT m_IDirect3DDevice9Ex::SetTexture(DWORD Stage, IDirect3DBaseTexture9 *pTexture)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_TRACE(D3d9SetTexture, this, Stage, pTexture);
+	LOG_CALLSTATS();
 
 	if (pTexture)
 	{
@@ -1035,14 +1156,17 @@ HRESULT m_IDirect3DDevice9Ex::SetTexture(DWORD Stage, IDirect3DBaseTexture9 *pTe
 
 HRESULT m_IDirect3DDevice9Ex::SetTextureStageState(DWORD Stage, D3DTEXTURESTAGESTATETYPE Type, DWORD Value)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_TRACE(D3d9SetTextureStageState, this, Stage, Type, Value);
+	LOG_CALLSTATS();
 
 	return ProxyInterface->SetTextureStageState(Stage, Type, Value);
 }
 
 HRESULT m_IDirect3DDevice9Ex::UpdateTexture(IDirect3DBaseTexture9 *pSourceTexture, IDirect3DBaseTexture9 *pDestinationTexture)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (pSourceTexture)
 	{
@@ -1084,14 +1208,16 @@ HRESULT m_IDirect3DDevice9Ex::UpdateTexture(IDirect3DBaseTexture9 *pSourceTextur
 
 HRESULT m_IDirect3DDevice9Ex::ValidateDevice(DWORD *pNumPasses)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->ValidateDevice(pNumPasses);
 }
 
 HRESULT m_IDirect3DDevice9Ex::GetClipPlane(DWORD Index, float *pPlane)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	// CacheClipPlane
 	if (Config.CacheClipPlane)
@@ -1111,7 +1237,8 @@ HRESULT m_IDirect3DDevice9Ex::GetClipPlane(DWORD Index, float *pPlane)
 
 HRESULT m_IDirect3DDevice9Ex::SetClipPlane(DWORD Index, CONST float *pPlane)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	// CacheClipPlane
 	if (Config.CacheClipPlane)
@@ -1134,7 +1261,8 @@ HRESULT m_IDirect3DDevice9Ex::SetClipPlane(DWORD Index, CONST float *pPlane)
 // CacheClipPlane
 void m_IDirect3DDevice9Ex::ApplyClipPlanes()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	DWORD index = 0;
 	for (const auto clipPlane : m_storedClipPlanes)
@@ -1149,7 +1277,10 @@ void m_IDirect3DDevice9Ex::ApplyClipPlanes()
 
 HRESULT m_IDirect3DDevice9Ex::Clear(DWORD Count, CONST D3DRECT *pRects, DWORD Flags, D3DCOLOR Color, float Z, DWORD Stencil)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_TRACE(D3d9Clear, this, Count, pRects, Flags, Color, Z, Stencil);
+	LOG_CALLSTATS();
+	LOG_CHROMETRACE();
 
 	if (IsWindow(DeviceWindow) && (Config.FullscreenWindowMode || Config.EnableWindowMode))
 	{
@@ -1171,42 +1302,71 @@ HRESULT m_IDirect3DDevice9Ex::Clear(DWORD Count, CONST D3DRECT *pRects, DWORD Fl
 
 HRESULT m_IDirect3DDevice9Ex::GetViewport(D3DVIEWPORT9 *pViewport)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetViewport(pViewport);
 }
 
 HRESULT m_IDirect3DDevice9Ex::SetViewport(CONST D3DVIEWPORT9 *pViewport)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_TRACE(D3d9SetViewport, this, pViewport);
+	LOG_CALLSTATS();
 
 	return ProxyInterface->SetViewport(pViewport);
 }
 
 HRESULT m_IDirect3DDevice9Ex::CreateVertexShader(THIS_ CONST DWORD* pFunction, IDirect3DVertexShader9** ppShader)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!ppShader)
 	{
 		return D3DERR_INVALIDCALL;
 	}
 
+	// Share the existing shader if this bytecode was already created, so the driver compile is skipped
+	const UINT Size = Config.D3d9ShaderCache ? ShaderBytecodeCache::GetFunctionSize(pFunction, 0xFFFE) : 0;
+	const UINT64 Hash = Size ? ShaderBytecodeCache::GetFunctionHash(pFunction, Size) : 0;
+	if (Size)
+	{
+		IDirect3DVertexShader9 *pCachedShader = (IDirect3DVertexShader9*)VertexShaderCache.Find(pFunction, Size, Hash);
+		if (pCachedShader)
+		{
+			*ppShader = ProxyAddressLookupTable->FindAddress<m_IDirect3DVertexShader9>(pCachedShader);
+			return D3D_OK;
+		}
+	}
+
 	HRESULT hr = ProxyInterface->CreateVertexShader(pFunction, ppShader);
 
 	if (SUCCEEDED(hr))
 	{
-		*ppShader = new m_IDirect3DVertexShader9(*ppShader, this);
+		if (Size)
+		{
+			IDirect3DVertexShader9 *pCachedShader = (IDirect3DVertexShader9*)VertexShaderCache.FindOrAdd(pFunction, Size, Hash, *ppShader);
+			if (pCachedShader)
+			{
+				(*ppShader)->Release();
+				*ppShader = ProxyAddressLookupTable->FindAddress<m_IDirect3DVertexShader9>(pCachedShader);
+				return D3D_OK;
+			}
+		}
+
+		*ppShader = ProxyAddressLookupTable->CreateInterface<m_IDirect3DVertexShader9>(*ppShader);
 		return D3D_OK;
 	}
 
-	Logging::LogDebug() << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << pFunction;
+	LOG_DBG << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << pFunction;
 	return hr;
 }
 
 HRESULT m_IDirect3DDevice9Ex::GetVertexShader(THIS_ IDirect3DVertexShader9** ppShader)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	HRESULT hr = ProxyInterface->GetVertexShader(ppShader);
 
@@ -1220,7 +1380,9 @@ HRESULT m_IDirect3DDevice9Ex::GetVertexShader(THIS_ IDirect3DVertexShader9** ppS
 
 HRESULT m_IDirect3DDevice9Ex::SetVertexShader(THIS_ IDirect3DVertexShader9* pShader)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_TRACE(D3d9SetVertexShader, this, pShader);
+	LOG_CALLSTATS();
 
 	if (pShader)
 	{
@@ -1232,7 +1394,8 @@ HRESULT m_IDirect3DDevice9Ex::SetVertexShader(THIS_ IDirect3DVertexShader9* pSha
 
 HRESULT m_IDirect3DDevice9Ex::CreateQuery(THIS_ D3DQUERYTYPE Type, IDirect3DQuery9** ppQuery)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!ppQuery)
 	{
@@ -1243,129 +1406,149 @@ HRESULT m_IDirect3DDevice9Ex::CreateQuery(THIS_ D3DQUERYTYPE Type, IDirect3DQuer
 
 	if (SUCCEEDED(hr))
 	{
-		*ppQuery = new m_IDirect3DQuery9(*ppQuery, this);
+		*ppQuery = ProxyAddressLookupTable->CreateInterface<m_IDirect3DQuery9>(*ppQuery);
 		return D3D_OK;
 	}
 
-	Logging::LogDebug() << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << Type;
+	LOG_DBG << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << Type;
 	return hr;
 }
 
 HRESULT m_IDirect3DDevice9Ex::SetPixelShaderConstantB(THIS_ UINT StartRegister, CONST BOOL* pConstantData, UINT  BoolCount)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->SetPixelShaderConstantB(StartRegister, pConstantData, BoolCount);
 }
 
 HRESULT m_IDirect3DDevice9Ex::GetPixelShaderConstantB(THIS_ UINT StartRegister, BOOL* pConstantData, UINT BoolCount)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetPixelShaderConstantB(StartRegister, pConstantData, BoolCount);
 }
 
 HRESULT m_IDirect3DDevice9Ex::SetPixelShaderConstantI(THIS_ UINT StartRegister, CONST int* pConstantData, UINT Vector4iCount)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->SetPixelShaderConstantI(StartRegister, pConstantData, Vector4iCount);
 }
 
 HRESULT m_IDirect3DDevice9Ex::GetPixelShaderConstantI(THIS_ UINT StartRegister, int* pConstantData, UINT Vector4iCount)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetPixelShaderConstantI(StartRegister, pConstantData, Vector4iCount);
 }
 
 HRESULT m_IDirect3DDevice9Ex::SetPixelShaderConstantF(THIS_ UINT StartRegister, CONST float* pConstantData, UINT Vector4fCount)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_TRACE(D3d9SetPixelShaderConstantF, this, StartRegister, pConstantData, Vector4fCount);
+	LOG_CALLSTATS();
 
 	return ProxyInterface->SetPixelShaderConstantF(StartRegister, pConstantData, Vector4fCount);
 }
 
 HRESULT m_IDirect3DDevice9Ex::GetPixelShaderConstantF(THIS_ UINT StartRegister, float* pConstantData, UINT Vector4fCount)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetPixelShaderConstantF(StartRegister, pConstantData, Vector4fCount);
 }
 
 HRESULT m_IDirect3DDevice9Ex::SetStreamSourceFreq(THIS_ UINT StreamNumber, UINT Divider)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->SetStreamSourceFreq(StreamNumber, Divider);
 }
 
 HRESULT m_IDirect3DDevice9Ex::GetStreamSourceFreq(THIS_ UINT StreamNumber, UINT* Divider)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetStreamSourceFreq(StreamNumber, Divider);
 }
 
 HRESULT m_IDirect3DDevice9Ex::SetVertexShaderConstantB(THIS_ UINT StartRegister, CONST BOOL* pConstantData, UINT  BoolCount)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->SetVertexShaderConstantB(StartRegister, pConstantData, BoolCount);
 }
 
 HRESULT m_IDirect3DDevice9Ex::GetVertexShaderConstantB(THIS_ UINT StartRegister, BOOL* pConstantData, UINT BoolCount)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetVertexShaderConstantB(StartRegister, pConstantData, BoolCount);
 }
 
 HRESULT m_IDirect3DDevice9Ex::SetVertexShaderConstantF(THIS_ UINT StartRegister, CONST float* pConstantData, UINT Vector4fCount)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_TRACE(D3d9SetVertexShaderConstantF, this, StartRegister, pConstantData, Vector4fCount);
+	LOG_CALLSTATS();
 
 	return ProxyInterface->SetVertexShaderConstantF(StartRegister, pConstantData, Vector4fCount);
 }
 
 HRESULT m_IDirect3DDevice9Ex::GetVertexShaderConstantF(THIS_ UINT StartRegister, float* pConstantData, UINT Vector4fCount)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetVertexShaderConstantF(StartRegister, pConstantData, Vector4fCount);
 }
 
 HRESULT m_IDirect3DDevice9Ex::SetVertexShaderConstantI(THIS_ UINT StartRegister, CONST int* pConstantData, UINT Vector4iCount)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->SetVertexShaderConstantI(StartRegister, pConstantData, Vector4iCount);
 }
 
 HRESULT m_IDirect3DDevice9Ex::GetVertexShaderConstantI(THIS_ UINT StartRegister, int* pConstantData, UINT Vector4iCount)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetVertexShaderConstantI(StartRegister, pConstantData, Vector4iCount);
 }
 
 HRESULT m_IDirect3DDevice9Ex::SetFVF(THIS_ DWORD FVF)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_TRACE(D3d9SetFVF, this, FVF);
+	LOG_CALLSTATS();
 
 	return ProxyInterface->SetFVF(FVF);
 }
 
 HRESULT m_IDirect3DDevice9Ex::GetFVF(THIS_ DWORD* pFVF)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetFVF(pFVF);
 }
 
 HRESULT m_IDirect3DDevice9Ex::CreateVertexDeclaration(THIS_ CONST D3DVERTEXELEMENT9* pVertexElements, IDirect3DVertexDeclaration9** ppDecl)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!ppDecl)
 	{
@@ -1376,17 +1559,19 @@ HRESULT m_IDirect3DDevice9Ex::CreateVertexDeclaration(THIS_ CONST D3DVERTEXELEME
 
 	if (SUCCEEDED(hr))
 	{
-		*ppDecl = new m_IDirect3DVertexDeclaration9(*ppDecl, this);
+		*ppDecl = ProxyAddressLookupTable->CreateInterface<m_IDirect3DVertexDeclaration9>(*ppDecl);
 		return D3D_OK;
 	}
 
-	Logging::LogDebug() << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << pVertexElements;
+	LOG_DBG << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << pVertexElements;
 	return hr;
 }
 
 HRESULT m_IDirect3DDevice9Ex::SetVertexDeclaration(THIS_ IDirect3DVertexDeclaration9* pDecl)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_TRACE(D3d9SetVertexDeclaration, this, pDecl);
+	LOG_CALLSTATS();
 
 	if (pDecl)
 	{
@@ -1398,7 +1583,8 @@ HRESULT m_IDirect3DDevice9Ex::SetVertexDeclaration(THIS_ IDirect3DVertexDeclarat
 
 HRESULT m_IDirect3DDevice9Ex::GetVertexDeclaration(THIS_ IDirect3DVertexDeclaration9** ppDecl)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	HRESULT hr = ProxyInterface->GetVertexDeclaration(ppDecl);
 
@@ -1412,70 +1598,81 @@ HRESULT m_IDirect3DDevice9Ex::GetVertexDeclaration(THIS_ IDirect3DVertexDeclarat
 
 HRESULT m_IDirect3DDevice9Ex::SetNPatchMode(THIS_ float nSegments)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->SetNPatchMode(nSegments);
 }
 
 float m_IDirect3DDevice9Ex::GetNPatchMode(THIS)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetNPatchMode();
 }
 
 int m_IDirect3DDevice9Ex::GetSoftwareVertexProcessing(THIS)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetSoftwareVertexProcessing();
 }
 
 unsigned int m_IDirect3DDevice9Ex::GetNumberOfSwapChains(THIS)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetNumberOfSwapChains();
 }
 
 HRESULT m_IDirect3DDevice9Ex::EvictManagedResources(THIS)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->EvictManagedResources();
 }
 
 HRESULT m_IDirect3DDevice9Ex::SetSoftwareVertexProcessing(THIS_ BOOL bSoftware)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->SetSoftwareVertexProcessing(bSoftware);
 }
 
 HRESULT m_IDirect3DDevice9Ex::SetScissorRect(THIS_ CONST RECT* pRect)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->SetScissorRect(pRect);
 }
 
 HRESULT m_IDirect3DDevice9Ex::GetScissorRect(THIS_ RECT* pRect)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetScissorRect(pRect);
 }
 
 HRESULT m_IDirect3DDevice9Ex::GetSamplerState(THIS_ DWORD Sampler, D3DSAMPLERSTATETYPE Type, DWORD* pValue)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetSamplerState(Sampler, Type, pValue);
 }
 
 HRESULT m_IDirect3DDevice9Ex::SetSamplerState(THIS_ DWORD Sampler, D3DSAMPLERSTATETYPE Type, DWORD Value)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_TRACE(D3d9SetSamplerState, this, Sampler, Type, Value);
+	LOG_CALLSTATS();
 
 	// Disable AntiAliasing when using point filtering
 	if (Config.AntiAliasing)
@@ -1570,7 +1767,8 @@ void m_IDirect3DDevice9Ex::ReeableAnisotropicSamplerState()
 
 HRESULT m_IDirect3DDevice9Ex::SetDepthStencilSurface(THIS_ IDirect3DSurface9* pNewZStencil)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (pNewZStencil)
 	{
@@ -1582,7 +1780,8 @@ HRESULT m_IDirect3DDevice9Ex::SetDepthStencilSurface(THIS_ IDirect3DSurface9* pN
 
 HRESULT m_IDirect3DDevice9Ex::CreateOffscreenPlainSurface(THIS_ UINT Width, UINT Height, D3DFORMAT Format, D3DPOOL Pool, IDirect3DSurface9** ppSurface, HANDLE* pSharedHandle)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!ppSurface)
 	{
@@ -1593,17 +1792,18 @@ HRESULT m_IDirect3DDevice9Ex::CreateOffscreenPlainSurface(THIS_ UINT Width, UINT
 
 	if (SUCCEEDED(hr))
 	{
-		*ppSurface = new m_IDirect3DSurface9(*ppSurface, this);
+		*ppSurface = ProxyAddressLookupTable->CreateInterface<m_IDirect3DSurface9>(*ppSurface);
 		return D3D_OK;
 	}
 
-	Logging::LogDebug() << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << Width << " " << Height << " " << Format << " " << Pool << " " << pSharedHandle;
+	LOG_DBG << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << Width << " " << Height << " " << Format << " " << Pool << " " << pSharedHandle;
 	return hr;
 }
 
 HRESULT m_IDirect3DDevice9Ex::ColorFill(THIS_ IDirect3DSurface9* pSurface, CONST RECT* pRect, D3DCOLOR color)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (pSurface)
 	{
@@ -1616,7 +1816,8 @@ HRESULT m_IDirect3DDevice9Ex::ColorFill(THIS_ IDirect3DSurface9* pSurface, CONST
 // Copy surface rect to destination rect
 HRESULT m_IDirect3DDevice9Ex::CopyRects(THIS_ IDirect3DSurface9 *pSourceSurface, const RECT *pSourceRectsArray, UINT cRects, IDirect3DSurface9 *pDestinationSurface, const POINT *pDestPointsArray)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!pSourceSurface || !pDestinationSurface || pSourceSurface == pDestinationSurface)
 	{
@@ -1708,7 +1909,10 @@ HRESULT m_IDirect3DDevice9Ex::CopyRects(THIS_ IDirect3DSurface9 *pSourceSurface,
 
 HRESULT m_IDirect3DDevice9Ex::StretchRect(THIS_ IDirect3DSurface9* pSourceSurface, CONST RECT* pSourceRect, IDirect3DSurface9* pDestSurface, CONST RECT* pDestRect, D3DTEXTUREFILTERTYPE Filter)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_TRACE(D3d9StretchRect, this, pSourceSurface, pSourceRect, pDestSurface, pDestRect, Filter);
+	LOG_CALLSTATS();
+	LOG_CHROMETRACE();
 
 	if (pSourceSurface)
 	{
@@ -1726,7 +1930,8 @@ HRESULT m_IDirect3DDevice9Ex::StretchRect(THIS_ IDirect3DSurface9* pSourceSurfac
 // Stretch source rect to destination rect
 HRESULT m_IDirect3DDevice9Ex::StretchRectFake(THIS_ IDirect3DSurface9* pSourceSurface, CONST RECT* pSourceRect, IDirect3DSurface9* pDestSurface, CONST RECT* pDestRect, D3DTEXTUREFILTERTYPE Filter)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	UNREFERENCED_PARAMETER(Filter);
 
@@ -1837,7 +2042,8 @@ HRESULT m_IDirect3DDevice9Ex::StretchRectFake(THIS_ IDirect3DSurface9* pSourceSu
 
 HRESULT m_IDirect3DDevice9Ex::GetFrontBufferData(THIS_ UINT iSwapChain, IDirect3DSurface9* pDestSurface)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.EnableWindowMode && (BufferWidth != screenWidth || BufferHeight != screenHeight))
 	{
@@ -1928,7 +2134,8 @@ HRESULT m_IDirect3DDevice9Ex::FakeGetFrontBufferData(THIS_ UINT iSwapChain, IDir
 
 HRESULT m_IDirect3DDevice9Ex::GetRenderTargetData(THIS_ IDirect3DSurface9* pRenderTarget, IDirect3DSurface9* pDestSurface)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (pRenderTarget)
 	{
@@ -1945,7 +2152,8 @@ HRESULT m_IDirect3DDevice9Ex::GetRenderTargetData(THIS_ IDirect3DSurface9* pRend
 
 HRESULT m_IDirect3DDevice9Ex::UpdateSurface(THIS_ IDirect3DSurface9* pSourceSurface, CONST RECT* pSourceRect, IDirect3DSurface9* pDestinationSurface, CONST POINT* pDestPoint)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (pSourceSurface)
 	{
@@ -1962,7 +2170,8 @@ HRESULT m_IDirect3DDevice9Ex::UpdateSurface(THIS_ IDirect3DSurface9* pSourceSurf
 
 HRESULT m_IDirect3DDevice9Ex::SetDialogBoxMode(THIS_ BOOL bEnableDialogs)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->SetDialogBoxMode(bEnableDialogs);
 }
@@ -1987,7 +2196,7 @@ HRESULT m_IDirect3DDevice9Ex::GetSwapChain(THIS_ UINT iSwapChain, IDirect3DSwapC
 	__nop();
 	__nop();
 
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	if (!ppSwapChain)
 	{
@@ -2006,7 +2215,8 @@ HRESULT m_IDirect3DDevice9Ex::GetSwapChain(THIS_ UINT iSwapChain, IDirect3DSwapC
 
 HRESULT m_IDirect3DDevice9Ex::SetConvolutionMonoKernel(THIS_ UINT width, UINT height, float* rows, float* columns)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!ProxyInterfaceEx)
 	{
@@ -2019,7 +2229,8 @@ HRESULT m_IDirect3DDevice9Ex::SetConvolutionMonoKernel(THIS_ UINT width, UINT he
 
 HRESULT m_IDirect3DDevice9Ex::ComposeRects(THIS_ IDirect3DSurface9* pSrc, IDirect3DSurface9* pDst, IDirect3DVertexBuffer9* pSrcRectDescs, UINT NumRects, IDirect3DVertexBuffer9* pDstRectDescs, D3DCOMPOSERECTSOP Operation, int Xoffset, int Yoffset)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!ProxyInterfaceEx)
 	{
@@ -2052,7 +2263,9 @@ HRESULT m_IDirect3DDevice9Ex::ComposeRects(THIS_ IDirect3DSurface9* pSrc, IDirec
 
 HRESULT m_IDirect3DDevice9Ex::PresentEx(THIS_ CONST RECT* pSourceRect, CONST RECT* pDestRect, HWND hDestWindowOverride, CONST RGNDATA* pDirtyRegion, DWORD dwFlags)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
+	LOG_CHROMETRACE();
 
 	if (!ProxyInterfaceEx)
 	{
@@ -2060,12 +2273,17 @@ HRESULT m_IDirect3DDevice9Ex::PresentEx(THIS_ CONST RECT* pSourceRect, CONST REC
 		return D3DERR_INVALIDCALL;
 	}
 
-	return ProxyInterfaceEx->PresentEx(pSourceRect, pDestRect, hDestWindowOverride, pDirtyRegion, dwFlags);
+	HRESULT hr = ProxyInterfaceEx->PresentEx(pSourceRect, pDestRect, hDestWindowOverride, pDirtyRegion, dwFlags);
+
+	Logging::ChromeTraceFrame();
+
+	return hr;
 }
 
 HRESULT m_IDirect3DDevice9Ex::GetGPUThreadPriority(THIS_ INT* pPriority)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!ProxyInterfaceEx)
 	{
@@ -2078,7 +2296,8 @@ HRESULT m_IDirect3DDevice9Ex::GetGPUThreadPriority(THIS_ INT* pPriority)
 
 HRESULT m_IDirect3DDevice9Ex::SetGPUThreadPriority(THIS_ INT Priority)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!ProxyInterfaceEx)
 	{
@@ -2091,7 +2310,8 @@ HRESULT m_IDirect3DDevice9Ex::SetGPUThreadPriority(THIS_ INT Priority)
 
 HRESULT m_IDirect3DDevice9Ex::WaitForVBlank(THIS_ UINT iSwapChain)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!ProxyInterfaceEx)
 	{
@@ -2104,7 +2324,8 @@ HRESULT m_IDirect3DDevice9Ex::WaitForVBlank(THIS_ UINT iSwapChain)
 
 HRESULT m_IDirect3DDevice9Ex::CheckResourceResidency(THIS_ IDirect3DResource9** pResourceArray, UINT32 NumResources)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!ProxyInterfaceEx)
 	{
@@ -2153,7 +2374,8 @@ HRESULT m_IDirect3DDevice9Ex::CheckResourceResidency(THIS_ IDirect3DResource9**
 
 HRESULT m_IDirect3DDevice9Ex::SetMaximumFrameLatency(THIS_ UINT MaxLatency)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!ProxyInterfaceEx)
 	{
@@ -2166,7 +2388,8 @@ HRESULT m_IDirect3DDevice9Ex::SetMaximumFrameLatency(THIS_ UINT MaxLatency)
 
 HRESULT m_IDirect3DDevice9Ex::GetMaximumFrameLatency(THIS_ UINT* pMaxLatency)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!ProxyInterfaceEx)
 	{
@@ -2179,7 +2402,8 @@ HRESULT m_IDirect3DDevice9Ex::GetMaximumFrameLatency(THIS_ UINT* pMaxLatency)
 
 HRESULT m_IDirect3DDevice9Ex::CheckDeviceState(THIS_ HWND hDestinationWindow)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!ProxyInterfaceEx)
 	{
@@ -2192,7 +2416,8 @@ HRESULT m_IDirect3DDevice9Ex::CheckDeviceState(THIS_ HWND hDestinationWindow)
 
 HRESULT m_IDirect3DDevice9Ex::CreateRenderTargetEx(THIS_ UINT Width, UINT Height, D3DFORMAT Format, D3DMULTISAMPLE_TYPE MultiSample, DWORD MultisampleQuality, BOOL Lockable, IDirect3DSurface9** ppSurface, HANDLE* pSharedHandle, DWORD Usage)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!ProxyInterfaceEx)
 	{
@@ -2209,17 +2434,18 @@ HRESULT m_IDirect3DDevice9Ex::CreateRenderTargetEx(THIS_ UINT Width, UINT Height
 
 	if (SUCCEEDED(hr))
 	{
-		*ppSurface = new m_IDirect3DSurface9(*ppSurface, this);
+		*ppSurface = ProxyAddressLookupTable->CreateInterface<m_IDirect3DSurface9>(*ppSurface);
 		return D3D_OK;
 	}
 
-	Logging::LogDebug() << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << Width << " " << Height << " " << Format << " " << MultiSample << " " << MultisampleQuality << " " << Lockable << " " << pSharedHandle << " " << Usage;
+	LOG_DBG << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << Width << " " << Height << " " << Format << " " << MultiSample << " " << MultisampleQuality << " " << Lockable << " " << pSharedHandle << " " << Usage;
 	return hr;
 }
 
 HRESULT m_IDirect3DDevice9Ex::CreateOffscreenPlainSurfaceEx(THIS_ UINT Width, UINT Height, D3DFORMAT Format, D3DPOOL Pool, IDirect3DSurface9** ppSurface, HANDLE* pSharedHandle, DWORD Usage)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!ProxyInterfaceEx)
 	{
@@ -2236,17 +2462,18 @@ HRESULT m_IDirect3DDevice9Ex::CreateOffscreenPlainSurfaceEx(THIS_ UINT Width, UI
 
 	if (SUCCEEDED(hr))
 	{
-		*ppSurface = new m_IDirect3DSurface9(*ppSurface, this);
+		*ppSurface = ProxyAddressLookupTable->CreateInterface<m_IDirect3DSurface9>(*ppSurface);
 		return D3D_OK;
 	}
 
-	Logging::LogDebug() << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << Width << " " << Height << " " << Format << " " << Pool << " " << pSharedHandle;
+	LOG_DBG << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << Width << " " << Height << " " << Format << " " << Pool << " " << pSharedHandle;
 	return hr;
 }
 
 HRESULT m_IDirect3DDevice9Ex::CreateDepthStencilSurfaceEx(THIS_ UINT Width, UINT Height, D3DFORMAT Format, D3DMULTISAMPLE_TYPE MultiSample, DWORD MultisampleQuality, BOOL Discard, IDirect3DSurface9** ppSurface, HANDLE* pSharedHandle, DWORD Usage)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!ProxyInterfaceEx)
 	{
@@ -2263,17 +2490,18 @@ HRESULT m_IDirect3DDevice9Ex::CreateDepthStencilSurfaceEx(THIS_ UINT Width, UINT
 
 	if (SUCCEEDED(hr))
 	{
-		*ppSurface = new m_IDirect3DSurface9(*ppSurface, this);
+		*ppSurface = ProxyAddressLookupTable->CreateInterface<m_IDirect3DSurface9>(*ppSurface);
 		return D3D_OK;
 	}
 
-	Logging::LogDebug() << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << Width << " " << Height << " " << Format << " " << MultiSample << " " << MultisampleQuality << " " << Discard << " " << pSharedHandle << " " << Usage;
+	LOG_DBG << __FUNCTION__ << " FAILED! " << (D3DERR)hr << " " << Width << " " << Height << " " << Format << " " << MultiSample << " " << MultisampleQuality << " " << Discard << " " << pSharedHandle << " " << Usage;
 	return hr;
 }
 
 HRESULT m_IDirect3DDevice9Ex::ResetEx(THIS_ D3DPRESENT_PARAMETERS* pPresentationParameters, D3DDISPLAYMODEEX *pFullscreenDisplayMode)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!pPresentationParameters)
 	{
@@ -2299,7 +2527,8 @@ HRESULT m_IDirect3DDevice9Ex::ResetEx(THIS_ D3DPRESENT_PARAMETERS* pPresentation
 
 HRESULT m_IDirect3DDevice9Ex::GetDisplayModeEx(THIS_ UINT iSwapChain, D3DDISPLAYMODEEX* pMode, D3DDISPLAYROTATION* pRotation)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!ProxyInterfaceEx)
 	{
@@ -83,11 +83,21 @@ public:
 	{
 		LOG_LIMIT(3, __FUNCTION__ << " (" << this << ")" << " deleting interface!");
 
+		if (Config.D3d9ShaderCache)
+		{
+			Logging::Log() << __FUNCTION__ << " Shader cache: vertex hits " << VertexShaderCache.GetHits() << "/" << VertexShaderCache.GetLookups() <<
+				" pixel hits " << PixelShaderCache.GetHits() << "/" << PixelShaderCache.GetLookups();
+		}
+
 		delete ProxyAddressLookupTable;
 	}
 
 	AddressLookupTableD3d9<m_IDirect3DDevice9Ex> *ProxyAddressLookupTable;
 
+	// Shader bytecode deduplication
+	ShaderBytecodeCache VertexShaderCache;
+	ShaderBytecodeCache PixelShaderCache;
+
 	/*** IUnknown methods ***/
 	STDMETHOD(QueryInterface)(THIS_ REFIID riid, void** ppvObj);
 	STDMETHOD_(ULONG, AddRef)(THIS);
@@ -18,7 +18,7 @@
 
 HRESULT m_IDirect3DIndexBuffer9::QueryInterface(THIS_ REFIID riid, void** ppvObj)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	if ((riid == IID_IDirect3DIndexBuffer9 || riid == IID_IUnknown || riid == IID_IDirect3DResource9) && ppvObj)
 	{
@@ -41,21 +41,21 @@ HRESULT m_IDirect3DIndexBuffer9::QueryInterface(THIS_ REFIID riid, void** ppvObj
 
 ULONG m_IDirect3DIndexBuffer9::AddRef(THIS)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->AddRef();
 }
 
 ULONG m_IDirect3DIndexBuffer9::Release(THIS)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
-	return ProxyInterface->Release();
+	return m_pDeviceEx->ProxyAddressLookupTable->ReleaseInterface(this, ProxyInterface);
 }
 
 HRESULT m_IDirect3DIndexBuffer9::GetDevice(THIS_ IDirect3DDevice9** ppDevice)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	if (!ppDevice)
 	{
@@ -71,70 +71,70 @@ HRESULT m_IDirect3DIndexBuffer9::GetDevice(THIS_ IDirect3DDevice9** ppDevice)
 
 HRESULT m_IDirect3DIndexBuffer9::SetPrivateData(THIS_ REFGUID refguid, CONST void* pData, DWORD SizeOfData, DWORD Flags)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->SetPrivateData(refguid, pData, SizeOfData, Flags);
 }
 
 HRESULT m_IDirect3DIndexBuffer9::GetPrivateData(THIS_ REFGUID refguid, void* pData, DWORD* pSizeOfData)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->GetPrivateData(refguid, pData, pSizeOfData);
 }
 
 HRESULT m_IDirect3DIndexBuffer9::FreePrivateData(THIS_ REFGUID refguid)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->FreePrivateData(refguid);
 }
 
 DWORD m_IDirect3DIndexBuffer9::SetPriority(THIS_ DWORD PriorityNew)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->SetPriority(PriorityNew);
 }
 
 DWORD m_IDirect3DIndexBuffer9::GetPriority(THIS)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->GetPriority();
 }
 
 void m_IDirect3DIndexBuffer9::PreLoad(THIS)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->PreLoad();
 }
 
 D3DRESOURCETYPE m_IDirect3DIndexBuffer9::GetType(THIS)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->GetType();
 }
 
 HRESULT m_IDirect3DIndexBuffer9::Lock(THIS_ UINT OffsetToLock, UINT SizeToLock, void** ppbData, DWORD Flags)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->Lock(OffsetToLock, SizeToLock, ppbData, Flags);
 }
 
 HRESULT m_IDirect3DIndexBuffer9::Unlock(THIS)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->Unlock();
 }
 
 HRESULT m_IDirect3DIndexBuffer9::GetDesc(THIS_ D3DINDEXBUFFER_DESC *pDesc)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->GetDesc(pDesc);
 }
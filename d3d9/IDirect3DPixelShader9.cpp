@@ -18,7 +18,7 @@
 
 HRESULT m_IDirect3DPixelShader9::QueryInterface(THIS_ REFIID riid, void** ppvObj)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	if ((riid == IID_IDirect3DPixelShader9 || riid == IID_IUnknown) && ppvObj)
 	{
@@ -41,21 +41,24 @@ HRESULT m_IDirect3DPixelShader9::QueryInterface(THIS_ REFIID riid, void** ppvObj
 
 ULONG m_IDirect3DPixelShader9::AddRef(THIS)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->AddRef();
 }
 
 ULONG m_IDirect3DPixelShader9::Release(THIS)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
-	return ProxyInterface->Release();
+	return m_pDeviceEx->ProxyAddressLookupTable->ReleaseInterface(this, ProxyInterface, [this]() -> ULONG
+	{
+		return m_pDeviceEx->PixelShaderCache.Release(ProxyInterface);
+	});
 }
 
 HRESULT m_IDirect3DPixelShader9::GetDevice(THIS_ IDirect3DDevice9** ppDevice)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	if (!ppDevice)
 	{
@@ -71,7 +74,7 @@ HRESULT m_IDirect3DPixelShader9::GetDevice(THIS_ IDirect3DDevice9** ppDevice)
 
 HRESULT m_IDirect3DPixelShader9::GetFunction(THIS_ void* pData, UINT* pSizeOfData)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->GetFunction(pData, pSizeOfData);
 }
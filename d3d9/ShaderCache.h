@@ -0,0 +1,191 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+// Shares one proxy shader between all Create calls that pass identical bytecode
+class ShaderBytecodeCache
+{
+private:
+	struct CACHEENTRY
+	{
+		std::vector<DWORD> Function;
+		IUnknown *Proxy = nullptr;
+	};
+
+	CRITICAL_SECTION scs;
+	std::unordered_multimap<UINT64, CACHEENTRY> ShaderMap;
+	std::unordered_map<IUnknown*, UINT64> ProxyMap;
+
+	// Cache statistics
+	DWORD Lookups = 0;
+	DWORD Hits = 0;
+
+	struct ScopedLock
+	{
+		explicit ScopedLock(CRITICAL_SECTION &cs) : cs(cs) { EnterCriticalSection(&cs); }
+		~ScopedLock() { LeaveCriticalSection(&cs); }
+		CRITICAL_SECTION &cs;
+	};
+
+public:
+	ShaderBytecodeCache()
+	{
+		InitializeCriticalSection(&scs);
+	}
+	~ShaderBytecodeCache()
+	{
+		DeleteCriticalSection(&scs);
+	}
+
+	// Returns the size of the shader function in DWORDs, including the end token, or 0 if the version token
+	// is not a shader of the given type (0xFFFE vertex, 0xFFFF pixel) or no end token is found. This runs
+	// before the runtime has seen the bytecode; like the runtime, it finds the end from the version and end tokens.
+	static UINT GetFunctionSize(CONST DWORD *pFunction, DWORD ShaderType)
+	{
+		constexpr UINT MaxFunctionSize = 0x100000;
+		if (!pFunction || (pFunction[0] >> 16) != ShaderType)
+		{
+			return 0;
+		}
+		const DWORD MajorVersion = D3DSHADER_VERSION_MAJOR(pFunction[0]);
+		if (MajorVersion < 1 || MajorVersion > 3)
+		{
+			return 0;
+		}
+		CONST DWORD *pToken = pFunction + 1;
+
+		while (*pToken != D3DSIO_END)
+		{
+			if ((UINT)(pToken - pFunction) >= MaxFunctionSize)
+			{
+				return 0;
+			}
+
+			const DWORD Opcode = *pToken & D3DSI_OPCODE_MASK;
+
+			// Shader model 1 has no instruction length, its parameter tokens have the top bit set
+			if (MajorVersion < 2 && (*pToken & 0x80000000))
+			{
+				pToken++;
+				continue;
+			}
+
+			if (Opcode == D3DSIO_COMMENT)
+			{
+				pToken += (*pToken & D3DSI_COMMENTSIZE_MASK) >> D3DSI_COMMENTSIZE_SHIFT;
+			}
+			else if (MajorVersion >= 2)
+			{
+				pToken += (*pToken & D3DSI_INSTLENGTH_MASK) >> D3DSI_INSTLENGTH_SHIFT;
+			}
+			else if (Opcode == D3DSIO_DEF)
+			{
+				// The register and the four float constants, which may not have the top bit set
+				pToken += 5;
+			}
+			pToken++;
+		}
+
+		return (UINT)(pToken - pFunction) + 1;
+	}
+
+	// 64-bit FNV-1a over the shader tokens
+	static UINT64 GetFunctionHash(CONST DWORD *pFunction, UINT Size)
+	{
+		UINT64 Hash = 0xCBF29CE484222325ull;
+		for (UINT x = 0; x < Size; x++)
+		{
+			Hash = (Hash ^ pFunction[x]) * 0x100000001B3ull;
+		}
+		return Hash;
+	}
+
+private:
+	IUnknown *FindLocked(CONST DWORD *pFunction, UINT Size, UINT64 Hash)
+	{
+		auto range = ShaderMap.equal_range(Hash);
+		for (auto it = range.first; it != range.second; it++)
+		{
+			if (it->second.Function.size() == Size && memcmp(it->second.Function.data(), pFunction, Size * sizeof(DWORD)) == 0)
+			{
+				it->second.Proxy->AddRef();
+				return it->second.Proxy;
+			}
+		}
+		return nullptr;
+	}
+
+public:
+	// Returns an AddRef'ed proxy shader with the same bytecode, or nullptr if none is cached. Called before
+	// the proxy shader is created, so a hit skips the driver compile.
+	IUnknown *Find(CONST DWORD *pFunction, UINT Size, UINT64 Hash)
+	{
+		ScopedLock Lock(scs);
+
+		Lookups++;
+
+		IUnknown *Cached = FindLocked(pFunction, Size, Hash);
+		if (Cached)
+		{
+			Hits++;
+		}
+		return Cached;
+	}
+
+	// Adds a newly created proxy shader. If another thread added the same bytecode in the meantime, returns
+	// its AddRef'ed proxy instead and Proxy is not added.
+	IUnknown *FindOrAdd(CONST DWORD *pFunction, UINT Size, UINT64 Hash, IUnknown *Proxy)
+	{
+		ScopedLock Lock(scs);
+
+		IUnknown *Cached = FindLocked(pFunction, Size, Hash);
+		if (Cached)
+		{
+			return Cached;
+		}
+
+		if (ProxyMap.find(Proxy) == ProxyMap.end())
+		{
+			CACHEENTRY Entry;
+			Entry.Function.assign(pFunction, pFunction + Size);
+			Entry.Proxy = Proxy;
+			ShaderMap.emplace(Hash, std::move(Entry));
+			ProxyMap[Proxy] = Hash;
+		}
+
+		return nullptr;
+	}
+
+	// Releases the proxy shader, the lock keeps FindOrAdd from reviving a shader that is being destroyed
+	ULONG Release(IUnknown *Proxy)
+	{
+		ScopedLock Lock(scs);
+
+		ULONG ref = Proxy->Release();
+
+		if (ref == 0)
+		{
+			auto it = ProxyMap.find(Proxy);
+			if (it != ProxyMap.end())
+			{
+				auto range = ShaderMap.equal_range(it->second);
+				for (auto entry = range.first; entry != range.second; entry++)
+				{
+					if (entry->second.Proxy == Proxy)
+					{
+						ShaderMap.erase(entry);
+						break;
+					}
+				}
+				ProxyMap.erase(it);
+			}
+		}
+
+		return ref;
+	}
+
+	DWORD GetLookups() const { return Lookups; }
+	DWORD GetHits() const { return Hits; }
+	size_t GetCount() const { return ProxyMap.size(); }
+};
@@ -18,9 +18,10 @@ class m_IDirect3DVertexShader9;
 class m_IDirect3DVolume9;
 class m_IDirect3DVolumeTexture9;
 
-#include "AddressLookupTable.h"
 #include "Settings\Settings.h"
 #include "Logging\Logging.h"
+#include "AddressLookupTable.h"
+#include "ShaderCache.h"
 
 typedef int(WINAPI* D3DPERF_BeginEventProc)(D3DCOLOR, LPCWSTR);
 typedef int(WINAPI* D3DPERF_EndEventProc)();
@@ -0,0 +1,331 @@
+/**
+* Copyright (C) 2022 Elisha Riedlinger
+*
+* This software is  provided 'as-is', without any express  or implied  warranty. In no event will the
+* authors be held liable for any damages arising from the use of this software.
+* Permission  is granted  to anyone  to use  this software  for  any  purpose,  including  commercial
+* applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*   1. The origin of this software must not be misrepresented; you must not claim that you  wrote the
+*      original  software. If you use this  software  in a product, an  acknowledgment in the product
+*      documentation would be appreciated but is not required.
+*   2. Altered source versions must  be plainly  marked as such, and  must not be  misrepresented  as
+*      being the original software.
+*   3. This notice may not be removed or altered from any source distribution.
+*
+* Writes the DirectDraw and Direct3D7 calls entering the Dd7to9 wrappers to a file that
+* ddraw\CaptureReplay replays through the d3d9 wrapper against a mock Direct3D9 device. Only the calls listed in
+* Capture.h are recorded, the rest of the wrapper activity is not part of a capture.
+*/
+
+#include <fstream>
+#include <unordered_map>
+#include "Capture.h"
+
+bool DdrawCapture::IsCapturing = false;
+
+namespace
+{
+	struct SURFACEINFO
+	{
+		uint32_t Id = 0;
+		DdrawCapture::CAPTURESURFACE Desc = {};
+	};
+
+	CRITICAL_SECTION CaptureLock;
+	bool CaptureInitialized = false;
+	std::ofstream CaptureFile;
+	std::unordered_map<const void*, SURFACEINFO> Surfaces;
+	uint32_t NextSurfaceId = 1;
+	DWORD FramesLeft = 0;
+
+	class SCOPEDCAPTURELOCK
+	{
+	public:
+		SCOPEDCAPTURELOCK() { EnterCriticalSection(&CaptureLock); }
+		~SCOPEDCAPTURELOCK() { LeaveCriticalSection(&CaptureLock); }
+	};
+
+	int64_t GetTimestamp()
+	{
+		LARGE_INTEGER Counter;
+		QueryPerformanceCounter(&Counter);
+		return Counter.QuadPart;
+	}
+
+	void WriteRecord(DdrawCapture::CAPTUREID Id, uint32_t Object, const void *Payload, uint32_t Size)
+	{
+		DdrawCapture::CAPTURERECORD Record = {};
+		Record.Id = Id;
+		Record.Object = Object;
+		Record.Timestamp = GetTimestamp();
+		Record.Size = Size;
+		CaptureFile.write((const char*)&Record, sizeof(Record));
+		if (Size)
+		{
+			CaptureFile.write((const char*)Payload, Size);
+		}
+	}
+
+	DdrawCapture::CAPTURERECT GetCaptureRect(LPRECT lpRect, const DDSURFACEDESC2 &Desc)
+	{
+		if (lpRect)
+		{
+			return { lpRect->left, lpRect->top, lpRect->right, lpRect->bottom };
+		}
+		return { 0, 0, (int32_t)Desc.dwWidth, (int32_t)Desc.dwHeight };
+	}
+
+	// Returns the capture ID of a surface and declares it if it is new or has changed
+	uint32_t GetSurfaceId(const void *Surface, const DDSURFACEDESC2 *Desc)
+	{
+		if (!Surface)
+		{
+			return 0;
+		}
+
+		SURFACEINFO &Info = Surfaces[Surface];
+		if (!Info.Id)
+		{
+			Info.Id = NextSurfaceId++;
+		}
+		if (Desc && (Info.Desc.Width != Desc->dwWidth || Info.Desc.Height != Desc->dwHeight || Info.Desc.BitCount != Desc->ddpfPixelFormat.dwRGBBitCount))
+		{
+			Info.Desc = { Desc->dwWidth, Desc->dwHeight, Desc->ddpfPixelFormat.dwRGBBitCount, Desc->ddsCaps.dwCaps };
+			WriteRecord(DdrawCapture::CAPTURE_SURFACE, Info.Id, &Info.Desc, sizeof(Info.Desc));
+		}
+		return Info.Id;
+	}
+
+	void WriteDraw(const DdrawCapture::CAPTUREDRAW &Draw, const void *Vertices, const WORD *Indices)
+	{
+		const uint32_t VertexBytes = Draw.VertexCount * Draw.Stride;
+
+		DdrawCapture::CAPTURERECORD Record = {};
+		Record.Id = DdrawCapture::CAPTURE_DRAW;
+		Record.Timestamp = GetTimestamp();
+		Record.Size = sizeof(Draw) + VertexBytes + Draw.IndexCount * sizeof(WORD);
+		CaptureFile.write((const char*)&Record, sizeof(Record));
+		CaptureFile.write((const char*)&Draw, sizeof(Draw));
+		CaptureFile.write((const char*)Vertices, VertexBytes);
+		CaptureFile.write((const char*)Indices, Draw.IndexCount * sizeof(WORD));
+	}
+}
+
+// Captures the next Frames presented frames
+void DdrawCapture::Start(DWORD Frames)
+{
+	if (CaptureInitialized || !Frames)
+	{
+		return;
+	}
+
+	char path[MAX_PATH];
+	Logging::GetLogPath(path, ".capture");
+	CaptureFile.open(path, std::ios::binary | std::ios::trunc);
+	if (!CaptureFile.is_open())
+	{
+		Logging::Log() << __FUNCTION__ << " Error: failed to create capture file: " << path;
+		return;
+	}
+
+	LARGE_INTEGER Frequency;
+	QueryPerformanceFrequency(&Frequency);
+	CAPTUREFILEHEADER Header = {};
+	memcpy(Header.Magic, CaptureMagic, sizeof(Header.Magic));
+	Header.Version = CaptureVersion;
+	Header.TimerFrequency = Frequency.QuadPart;
+	CaptureFile.write((const char*)&Header, sizeof(Header));
+
+	InitializeCriticalSection(&CaptureLock);
+	CaptureInitialized = true;
+	FramesLeft = Frames;
+	IsCapturing = true;
+	Logging::Log() << "Capturing " << Frames << " frames to: " << path;
+}
+
+// Closes a capture that is still running, other threads may already be gone during process termination
+void DdrawCapture::Stop()
+{
+	if (!CaptureInitialized)
+	{
+		return;
+	}
+
+	bool Locked = false;
+	for (int x = 0; x < 100 && !(Locked = TryEnterCriticalSection(&CaptureLock)); x++)
+	{
+		Sleep(1);
+	}
+	if (IsCapturing)
+	{
+		IsCapturing = false;
+		CaptureFile.close();
+		Logging::Log() << "Capture stopped with " << FramesLeft << " frames left";
+	}
+	if (Locked)
+	{
+		LeaveCriticalSection(&CaptureLock);
+	}
+}
+
+void DdrawCapture::EndFrame()
+{
+	if (!IsCapturing)
+	{
+		return;
+	}
+
+	SCOPEDCAPTURELOCK ScopedLock;
+	if (IsCapturing)
+	{
+		WriteRecord(CAPTURE_FRAME, 0, nullptr, 0);
+		if (--FramesLeft == 0)
+		{
+			IsCapturing = false;
+			CaptureFile.close();
+			Logging::Log() << "Capture complete";
+		}
+	}
+}
+
+void DdrawCapture::Lock(const void *Surface, const DDSURFACEDESC2 &Desc, LPRECT lpRect, DWORD dwFlags)
+{
+	SCOPEDCAPTURELOCK ScopedLock;
+	if (IsCapturing)
+	{
+		CAPTURELOCK Lock = { GetCaptureRect(lpRect, Desc), dwFlags };
+		WriteRecord(CAPTURE_LOCK, GetSurfaceId(Surface, &Desc), &Lock, sizeof(Lock));
+	}
+}
+
+// Stores what the game wrote to the locked rect so the replay can upload the same data
+void DdrawCapture::Unlock(const void *Surface, const DDSURFACEDESC2 &Desc, const RECT &Rect, const void *Bits, LONG Pitch, bool ReadOnly)
+{
+	SCOPEDCAPTURELOCK ScopedLock;
+	if (IsCapturing)
+	{
+		CAPTUREUNLOCK Unlock = { { Rect.left, Rect.top, Rect.right, Rect.bottom }, 0, 0 };
+		const DWORD BitCount = Desc.ddpfPixelFormat.dwRGBBitCount;
+		if (!ReadOnly && Bits && BitCount && Rect.right > Rect.left && Rect.bottom > Rect.top)
+		{
+			Unlock.Rows = Rect.bottom - Rect.top;
+			Unlock.RowBytes = (Rect.right - Rect.left) * BitCount / 8;
+		}
+
+		CAPTURERECORD Record = {};
+		Record.Id = CAPTURE_UNLOCK;
+		Record.Object = GetSurfaceId(Surface, &Desc);
+		Record.Timestamp = GetTimestamp();
+		Record.Size = sizeof(Unlock) + Unlock.Rows * Unlock.RowBytes;
+		CaptureFile.write((const char*)&Record, sizeof(Record));
+		CaptureFile.write((const char*)&Unlock, sizeof(Unlock));
+
+		// Rows are written one at a time since the surface pitch is usually wider than the rect
+		for (uint32_t y = 0; y < Unlock.Rows; y++)
+		{
+			CaptureFile.write((const char*)Bits + y * Pitch, Unlock.RowBytes);
+		}
+	}
+}
+
+void DdrawCapture::Blt(const void *Surface, const DDSURFACEDESC2 &Desc, LPRECT lpDestRect, const void *SrcSurface, const DDSURFACEDESC2 *SrcDesc, LPRECT lpSrcRect, DWORD dwFlags, LPDDBLTFX lpDDBltFx)
+{
+	SCOPEDCAPTURELOCK ScopedLock;
+	if (IsCapturing)
+	{
+		CAPTUREBLT Blt = {};
+		Blt.DestRect = GetCaptureRect(lpDestRect, Desc);
+
+		const bool Rop = (dwFlags & DDBLT_ROP) && lpDDBltFx;
+		if ((dwFlags & DDBLT_COLORFILL) && lpDDBltFx)
+		{
+			Blt.Flags = CAPTUREBLT_COLORFILL;
+			Blt.Color = lpDDBltFx->dwFillColor;
+		}
+		else if (Rop && (lpDDBltFx->dwROP == BLACKNESS || lpDDBltFx->dwROP == WHITENESS))
+		{
+			Blt.Flags = CAPTUREBLT_COLORFILL;
+			Blt.Color = (lpDDBltFx->dwROP == BLACKNESS) ? 0x00000000 : 0xFFFFFFFF;
+		}
+		else
+		{
+			Blt.Source = SrcSurface ? GetSurfaceId(SrcSurface, SrcDesc) : GetSurfaceId(Surface, &Desc);
+			Blt.SrcRect = GetCaptureRect(lpSrcRect, SrcDesc ? *SrcDesc : Desc);
+			Blt.Flags =
+				((dwFlags & (DDBLT_KEYDESTOVERRIDE | DDBLT_KEYSRCOVERRIDE | DDBLT_KEYDEST | DDBLT_KEYSRC)) ? CAPTUREBLT_COLORKEY : 0) |
+				((dwFlags & DDBLT_DDFX) && lpDDBltFx && (lpDDBltFx->dwDDFX & DDBLTFX_MIRRORLEFTRIGHT) ? CAPTUREBLT_MIRRORLEFTRIGHT : 0) |
+				((dwFlags & DDBLT_DDFX) && lpDDBltFx && (lpDDBltFx->dwDDFX & DDBLTFX_MIRRORUPDOWN) ? CAPTUREBLT_MIRRORUPDOWN : 0);
+			if ((dwFlags & DDBLT_KEYSRCOVERRIDE) && lpDDBltFx)
+			{
+				Blt.Color = lpDDBltFx->ddckSrcColorkey.dwColorSpaceLowValue;
+			}
+		}
+		WriteRecord(CAPTURE_BLT, GetSurfaceId(Surface, &Desc), &Blt, sizeof(Blt));
+	}
+}
+
+void DdrawCapture::Flip(const void *Surface, const DDSURFACEDESC2 &Desc, DWORD dwFlags)
+{
+	SCOPEDCAPTURELOCK ScopedLock;
+	if (IsCapturing)
+	{
+		CAPTUREFLIP Flip = { dwFlags };
+		WriteRecord(CAPTURE_FLIP, GetSurfaceId(Surface, &Desc), &Flip, sizeof(Flip));
+	}
+}
+
+void DdrawCapture::SetRenderState(DWORD State, DWORD Value)
+{
+	SCOPEDCAPTURELOCK ScopedLock;
+	if (IsCapturing)
+	{
+		CAPTURESTATE RenderState = { State, Value };
+		WriteRecord(CAPTURE_SETRENDERSTATE, 0, &RenderState, sizeof(RenderState));
+	}
+}
+
+void DdrawCapture::SetTexture(DWORD Stage, const void *Surface, const DDSURFACEDESC2 *Desc)
+{
+	SCOPEDCAPTURELOCK ScopedLock;
+	if (IsCapturing)
+	{
+		CAPTURETEXTURE Texture = { Stage, GetSurfaceId(Surface, Desc) };
+		WriteRecord(CAPTURE_SETTEXTURE, 0, &Texture, sizeof(Texture));
+	}
+}
+
+void DdrawCapture::Draw(DWORD PrimitiveType, DWORD FVF, const void *Vertices, DWORD VertexCount, UINT Stride, const WORD *Indices, DWORD IndexCount)
+{
+	SCOPEDCAPTURELOCK ScopedLock;
+	if (IsCapturing)
+	{
+		CAPTUREDRAW Draw = { PrimitiveType, FVF, Vertices ? VertexCount : 0, Stride, Indices ? IndexCount : 0, CAPTUREDRAW_USERPOINTER };
+		WriteDraw(Draw, Vertices, Indices);
+	}
+}
+
+void DdrawCapture::DrawStrided(DWORD PrimitiveType, DWORD FVF, DWORD VertexCount, const WORD *Indices, DWORD IndexCount)
+{
+	SCOPEDCAPTURELOCK ScopedLock;
+	if (IsCapturing)
+	{
+		CAPTUREDRAW Draw = { PrimitiveType, FVF, VertexCount, 0, Indices ? IndexCount : 0, CAPTUREDRAW_STRIDED };
+		WriteDraw(Draw, nullptr, Indices);
+	}
+}
+
+void DdrawCapture::DrawVB(DWORD PrimitiveType, LPDIRECT3DVERTEXBUFFER7 VertexBuffer, DWORD VertexCount, const WORD *Indices, DWORD IndexCount)
+{
+	SCOPEDCAPTURELOCK ScopedLock;
+	if (IsCapturing)
+	{
+		m_IDirect3DVertexBufferX *VertexBufferX = nullptr;
+		if (VertexBuffer)
+		{
+			VertexBuffer->QueryInterface(IID_GetInterfaceX, (LPVOID*)&VertexBufferX);
+		}
+		CAPTUREDRAW Draw = { PrimitiveType, VertexBufferX ? VertexBufferX->GetFVF() : 0, VertexCount, 0, Indices ? IndexCount : 0, CAPTUREDRAW_VERTEXBUFFER };
+		WriteDraw(Draw, nullptr, Indices);
+	}
+}
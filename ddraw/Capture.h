@@ -0,0 +1,29 @@
+#pragma once
+
+#include "ddraw.h"
+#include "CaptureFormat.h"
+
+namespace DdrawCapture
+{
+	extern bool IsCapturing;
+
+	void Start(DWORD Frames);
+	void Stop();
+	void EndFrame();
+
+	// Surface calls are recorded with the surface they were made on, the description is used to declare new surfaces
+	void Lock(const void *Surface, const DDSURFACEDESC2 &Desc, LPRECT lpRect, DWORD dwFlags);
+	void Unlock(const void *Surface, const DDSURFACEDESC2 &Desc, const RECT &Rect, const void *Bits, LONG Pitch, bool ReadOnly);
+	void Blt(const void *Surface, const DDSURFACEDESC2 &Desc, LPRECT lpDestRect, const void *SrcSurface, const DDSURFACEDESC2 *SrcDesc, LPRECT lpSrcRect, DWORD dwFlags, LPDDBLTFX lpDDBltFx);
+	void Flip(const void *Surface, const DDSURFACEDESC2 &Desc, DWORD dwFlags);
+
+	// Device calls
+	void SetRenderState(DWORD State, DWORD Value);
+	void SetTexture(DWORD Stage, const void *Surface, const DDSURFACEDESC2 *Desc);
+	void Draw(DWORD PrimitiveType, DWORD FVF, const void *Vertices, DWORD VertexCount, UINT Stride, const WORD *Indices, DWORD IndexCount);
+	void DrawStrided(DWORD PrimitiveType, DWORD FVF, DWORD VertexCount, const WORD *Indices, DWORD IndexCount);
+	void DrawVB(DWORD PrimitiveType, LPDIRECT3DVERTEXBUFFER7 VertexBuffer, DWORD VertexCount, const WORD *Indices, DWORD IndexCount);
+}
+
+// Records a call entering the Dd7to9 wrappers while a capture is running
+#define CAPTURE_CALL(Call, ...) if (!DdrawCapture::IsCapturing) {} else DdrawCapture::Call(__VA_ARGS__)
@@ -0,0 +1,123 @@
+#pragma once
+
+// Capture file layout shared by the Dd7to9 capture writer and the replay tool.
+// Only standard headers may be used here so that the replay tool builds on any platform.
+
+#include <cstdint>
+
+namespace DdrawCapture
+{
+	constexpr char CaptureMagic[8] = { 'D', 'X', 'W', 'C', 'A', 'P', 'T', 'R' };
+	constexpr uint32_t CaptureVersion = 3;
+
+	enum CAPTUREID : uint16_t
+	{
+		CAPTURE_SURFACE,			// CAPTURESURFACE, sent the first time a surface is used or when its size changes
+		CAPTURE_LOCK,				// CAPTURELOCK
+		CAPTURE_UNLOCK,				// CAPTUREUNLOCK followed by Rows * RowBytes bytes of surface contents
+		CAPTURE_BLT,				// CAPTUREBLT
+		CAPTURE_FLIP,				// CAPTUREFLIP
+		CAPTURE_SETRENDERSTATE,		// CAPTURESTATE with the Direct3D7 render state
+		CAPTURE_SETTEXTURE,			// CAPTURETEXTURE
+		CAPTURE_DRAW,				// CAPTUREDRAW followed by VertexCount * Stride vertex bytes and IndexCount 16 bit indices
+		CAPTURE_FRAME,				// No payload, marks a presented frame
+		CAPTURE_COUNT
+	};
+
+	// Blt flags, reduced to what changes the work done by the blit
+	constexpr uint32_t CAPTUREBLT_COLORFILL = 0x1;
+	constexpr uint32_t CAPTUREBLT_COLORKEY = 0x2;
+	constexpr uint32_t CAPTUREBLT_MIRRORLEFTRIGHT = 0x4;
+	constexpr uint32_t CAPTUREBLT_MIRRORUPDOWN = 0x8;
+
+	// Where the vertices of a draw come from. Dd7to9 does not implement strided and vertex buffer draws yet,
+	// so those are recorded without vertex data (Stride is 0) to show how much of a frame they make up.
+	constexpr uint32_t CAPTUREDRAW_USERPOINTER = 0;
+	constexpr uint32_t CAPTUREDRAW_STRIDED = 1;
+	constexpr uint32_t CAPTUREDRAW_VERTEXBUFFER = 2;
+
+#pragma pack(push, 1)
+	struct CAPTUREFILEHEADER
+	{
+		char Magic[8];
+		uint32_t Version;
+		uint32_t Reserved;
+		int64_t TimerFrequency;		// Timestamp ticks per second
+	};
+
+	// Followed by Size bytes of payload, Object is the surface the call was made on or 0
+	struct CAPTURERECORD
+	{
+		uint16_t Id;
+		uint16_t Reserved;
+		uint32_t Object;
+		int64_t Timestamp;
+		uint32_t Size;
+	};
+
+	struct CAPTURERECT
+	{
+		int32_t Left;
+		int32_t Top;
+		int32_t Right;
+		int32_t Bottom;
+	};
+
+	struct CAPTURESURFACE
+	{
+		uint32_t Width;
+		uint32_t Height;
+		uint32_t BitCount;
+		uint32_t Caps;
+	};
+
+	struct CAPTURELOCK
+	{
+		CAPTURERECT Rect;
+		uint32_t Flags;
+	};
+
+	struct CAPTUREUNLOCK
+	{
+		CAPTURERECT Rect;
+		uint32_t Rows;				// 0 for read only locks
+		uint32_t RowBytes;
+	};
+
+	struct CAPTUREBLT
+	{
+		uint32_t Source;			// 0 for color fills
+		CAPTURERECT DestRect;
+		CAPTURERECT SrcRect;
+		uint32_t Flags;
+		uint32_t Color;				// Fill color or color key
+	};
+
+	struct CAPTUREFLIP
+	{
+		uint32_t Flags;
+	};
+
+	struct CAPTURESTATE
+	{
+		uint32_t State;
+		uint32_t Value;
+	};
+
+	struct CAPTURETEXTURE
+	{
+		uint32_t Stage;
+		uint32_t Surface;			// 0 to unset the texture
+	};
+
+	struct CAPTUREDRAW
+	{
+		uint32_t PrimitiveType;
+		uint32_t FVF;
+		uint32_t VertexCount;
+		uint32_t Stride;
+		uint32_t IndexCount;		// 0 for non indexed draws
+		uint32_t Source;			// CAPTUREDRAW_USERPOINTER, CAPTUREDRAW_STRIDED or CAPTUREDRAW_VERTEXBUFFER
+	};
+#pragma pack(pop)
+}
@@ -0,0 +1,608 @@
+/**
+* Copyright (C) 2022 Elisha Riedlinger
+*
+* This software is  provided 'as-is', without any express  or implied  warranty. In no event will the
+* authors be held liable for any damages arising from the use of this software.
+* Permission  is granted  to anyone  to use  this software  for  any  purpose,  including  commercial
+* applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*   1. The origin of this software must not be misrepresented; you must not claim that you  wrote the
+*      original  software. If you use this  software  in a product, an  acknowledgment in the product
+*      documentation would be appreciated but is not required.
+*   2. Altered source versions must  be plainly  marked as such, and  must not be  misrepresented  as
+*      being the original software.
+*   3. This notice may not be removed or altered from any source distribution.
+*
+* Replays a capture written with DdrawCaptureFrames enabled. Each captured call is issued as the Direct3D9
+* calls Dd7to9 makes for it, once straight to a mock device and once through the d3d9 wrapper
+* (m_IDirect3DDevice9Ex) in front of another mock device. The difference between the two is the cost of the
+* wrapper, rebuild the replay before and after a wrapper change to compare. See MockDirect3DDevice9.h for
+* what the mock does. Windows only, it builds the d3d9 wrapper sources from this folder:
+*   cl /std:c++17 /EHsc /O2 /I..\.. /I..\..\Libraries /I..\..\Libraries\DirectX81SDK\include CaptureReplay.cpp ReplayStubs.cpp
+*      ..\..\d3d9\I*.cpp ..\..\Logging\*.cpp user32.lib gdi32.lib ole32.lib
+*
+* Usage: capturereplay <file.capture> [iterations]
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+#include "../../d3d9/d3d9.h"
+#include "../CaptureFormat.h"
+#include "MockDirect3DDevice9.h"
+
+using namespace DdrawCapture;
+
+struct REPLAYRECORD
+{
+	CAPTURERECORD Header;
+	size_t Offset;		// Offset of the payload in the file data
+};
+
+struct REPLAYSURFACE
+{
+	IDirect3DTexture9 *Texture = nullptr;
+	IDirect3DSurface9 *Surface = nullptr;
+	LONG Width = 0;
+	LONG Height = 0;
+	UINT BytesPerPixel = 0;
+	D3DLOCKED_RECT Locked = {};		// Set between a captured Lock and Unlock
+	bool IsLocked = false;
+};
+
+static bool ReadFileData(const char *path, std::vector<uint8_t> &data)
+{
+	std::ifstream file(path, std::ios::binary);
+	if (!file)
+	{
+		return false;
+	}
+	data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	return true;
+}
+
+template <typename T>
+static bool ReadPayload(const REPLAYRECORD &Record, const std::vector<uint8_t> &data, T &Payload)
+{
+	if (Record.Header.Size < sizeof(T))
+	{
+		return false;
+	}
+	memcpy(&Payload, data.data() + Record.Offset, sizeof(T));
+	return true;
+}
+
+static D3DFORMAT GetFormat(uint32_t BitCount)
+{
+	switch (BitCount)
+	{
+	case 8:
+		return D3DFMT_P8;
+	case 16:
+		return D3DFMT_R5G6B5;
+	case 24:
+		return D3DFMT_R8G8B8;
+	default:
+		return D3DFMT_X8R8G8B8;
+	}
+}
+
+static UINT GetPrimitiveCount(uint32_t PrimitiveType, uint32_t Count)
+{
+	switch (PrimitiveType)
+	{
+	case D3DPT_POINTLIST:
+		return Count;
+	case D3DPT_LINELIST:
+		return Count / 2;
+	case D3DPT_LINESTRIP:
+		return Count > 1 ? Count - 1 : 0;
+	case D3DPT_TRIANGLELIST:
+		return Count / 3;
+	case D3DPT_TRIANGLESTRIP:
+	case D3DPT_TRIANGLEFAN:
+		return Count > 2 ? Count - 2 : 0;
+	default:
+		return 0;
+	}
+}
+
+// Clips a captured rect to the surface, returns false if nothing is left
+static bool ClipRect(const REPLAYSURFACE &Surface, const CAPTURERECT &In, RECT &Rect)
+{
+	Rect.left = std::max<LONG>(In.Left, 0);
+	Rect.top = std::max<LONG>(In.Top, 0);
+	Rect.right = std::min<LONG>(In.Right, Surface.Width);
+	Rect.bottom = std::min<LONG>(In.Bottom, Surface.Height);
+	return Rect.left < Rect.right && Rect.top < Rect.bottom;
+}
+
+// Issues the Direct3D9 calls the Dd7to9 wrappers make for the captured calls
+class REPLAYDEVICE
+{
+private:
+	IDirect3DDevice9 *Device;
+	std::unordered_map<uint32_t, REPLAYSURFACE> Surfaces;
+	std::vector<uint8_t> Temp;
+	bool InScene = false;
+
+	REPLAYSURFACE *GetSurface(uint32_t Id)
+	{
+		auto it = Surfaces.find(Id);
+		return (it != Surfaces.end() && it->second.Surface) ? &it->second : nullptr;
+	}
+
+	bool Check(HRESULT hr)
+	{
+		FailedCalls += FAILED(hr);
+		return SUCCEEDED(hr);
+	}
+
+	void ReleaseSurface(REPLAYSURFACE &Surface)
+	{
+		if (Surface.IsLocked)
+		{
+			Surface.Surface->UnlockRect();
+		}
+		if (Surface.Surface)
+		{
+			Surface.Surface->Release();
+		}
+		if (Surface.Texture)
+		{
+			Surface.Texture->Release();
+		}
+		Surface = {};
+	}
+
+	void CreateSurface(uint32_t Id, const CAPTURESURFACE &Desc)
+	{
+		REPLAYSURFACE &Surface = Surfaces[Id];
+		ReleaseSurface(Surface);
+		const D3DFORMAT Format = GetFormat(Desc.BitCount);
+		if (Check(Device->CreateTexture(Desc.Width, Desc.Height, 1, 0, Format, D3DPOOL_MANAGED, &Surface.Texture, nullptr)) &&
+			Check(Surface.Texture->GetSurfaceLevel(0, &Surface.Surface)))
+		{
+			Surface.Width = Desc.Width;
+			Surface.Height = Desc.Height;
+			Surface.BytesPerPixel = MockDirect3DSurface9::GetBytesPerPixel(Format);
+		}
+	}
+
+	// Dd7to9 does color keyed and mirrored blits on the CPU between the locked surfaces
+	void CopyLocked(REPLAYSURFACE &Src, const RECT &SrcRect, REPLAYSURFACE &Dest, const RECT &DestRect, const CAPTUREBLT &Blt)
+	{
+		if (Src.BytesPerPixel != Dest.BytesPerPixel || Src.IsLocked || Dest.IsLocked)
+		{
+			return;
+		}
+		const UINT Bpp = Dest.BytesPerPixel;
+		const LONG SrcWidth = SrcRect.right - SrcRect.left, SrcHeight = SrcRect.bottom - SrcRect.top;
+		const LONG DestWidth = DestRect.right - DestRect.left, DestHeight = DestRect.bottom - DestRect.top;
+
+		// Blits within one surface read from a copy of the source rect
+		D3DLOCKED_RECT SrcLock = {}, DestLock = {};
+		if (&Src == &Dest)
+		{
+			RECT Rect = { 0, 0, Dest.Width, Dest.Height };
+			if (!Check(Dest.Surface->LockRect(&DestLock, &Rect, 0)))
+			{
+				return;
+			}
+			Temp.resize((size_t)SrcWidth * SrcHeight * Bpp);
+			for (LONG y = 0; y < SrcHeight; y++)
+			{
+				memcpy(&Temp[(size_t)y * SrcWidth * Bpp], (BYTE*)DestLock.pBits + (SrcRect.top + y) * DestLock.Pitch + SrcRect.left * Bpp, (size_t)SrcWidth * Bpp);
+			}
+			SrcLock.pBits = Temp.data();
+			SrcLock.Pitch = SrcWidth * Bpp;
+			DestLock.pBits = (BYTE*)DestLock.pBits + DestRect.top * DestLock.Pitch + DestRect.left * Bpp;
+		}
+		else if (!Check(Src.Surface->LockRect(&SrcLock, &SrcRect, D3DLOCK_READONLY)))
+		{
+			return;
+		}
+		else if (!Check(Dest.Surface->LockRect(&DestLock, &DestRect, 0)))
+		{
+			Src.Surface->UnlockRect();
+			return;
+		}
+
+		const bool ColorKey = (Blt.Flags & CAPTUREBLT_COLORKEY) != 0;
+		const bool MirrorLeftRight = (Blt.Flags & CAPTUREBLT_MIRRORLEFTRIGHT) != 0;
+		const bool MirrorUpDown = (Blt.Flags & CAPTUREBLT_MIRRORUPDOWN) != 0;
+		for (LONG y = 0; y < DestHeight; y++)
+		{
+			const LONG sy = (MirrorUpDown ? DestHeight - 1 - y : y) * SrcHeight / DestHeight;
+			const BYTE *SrcRow = (const BYTE*)SrcLock.pBits + sy * SrcLock.Pitch;
+			BYTE *DestRow = (BYTE*)DestLock.pBits + y * DestLock.Pitch;
+			for (LONG x = 0; x < DestWidth; x++)
+			{
+				const LONG sx = (MirrorLeftRight ? DestWidth - 1 - x : x) * SrcWidth / DestWidth;
+				const BYTE *Pixel = SrcRow + sx * Bpp;
+				DWORD Value = 0;
+				memcpy(&Value, Pixel, Bpp);
+				if (!ColorKey || Value != Blt.Color)
+				{
+					memcpy(DestRow + x * Bpp, Pixel, Bpp);
+				}
+			}
+		}
+
+		if (&Src != &Dest)
+		{
+			Src.Surface->UnlockRect();
+		}
+		Dest.Surface->UnlockRect();
+	}
+
+	void Blt(uint32_t Id, const CAPTUREBLT &Blt)
+	{
+		REPLAYSURFACE *Dest = GetSurface(Id);
+		RECT DestRect;
+		if (!Dest || !ClipRect(*Dest, Blt.DestRect, DestRect))
+		{
+			return;
+		}
+		if (Blt.Flags & CAPTUREBLT_COLORFILL)
+		{
+			Check(Device->ColorFill(Dest->Surface, &DestRect, Blt.Color));
+			return;
+		}
+		REPLAYSURFACE *Src = GetSurface(Blt.Source);
+		RECT SrcRect;
+		if (!Src || !ClipRect(*Src, Blt.SrcRect, SrcRect))
+		{
+			return;
+		}
+		if (Src == Dest || (Blt.Flags & (CAPTUREBLT_COLORKEY | CAPTUREBLT_MIRRORLEFTRIGHT | CAPTUREBLT_MIRRORUPDOWN)))
+		{
+			CopyLocked(*Src, SrcRect, *Dest, DestRect, Blt);
+			return;
+		}
+		Check(Device->StretchRect(Src->Surface, &SrcRect, Dest->Surface, &DestRect, D3DTEXF_NONE));
+	}
+
+	void Draw(const CAPTUREDRAW &Draw, const uint8_t *Vertices, const uint8_t *Indices)
+	{
+		if (Draw.Source != CAPTUREDRAW_USERPOINTER || !Draw.VertexCount || !Draw.Stride)
+		{
+			UnsupportedDraws++;
+			return;
+		}
+		const UINT PrimitiveCount = GetPrimitiveCount(Draw.PrimitiveType, Draw.IndexCount ? Draw.IndexCount : Draw.VertexCount);
+		if (!PrimitiveCount)
+		{
+			return;
+		}
+		if (!InScene)
+		{
+			InScene = Check(Device->BeginScene());
+		}
+		Check(Device->SetFVF(Draw.FVF));
+		if (Draw.IndexCount)
+		{
+			Check(Device->DrawIndexedPrimitiveUP((D3DPRIMITIVETYPE)Draw.PrimitiveType, 0, Draw.VertexCount, PrimitiveCount, Indices, D3DFMT_INDEX16, Vertices, Draw.Stride));
+		}
+		else
+		{
+			Check(Device->DrawPrimitiveUP((D3DPRIMITIVETYPE)Draw.PrimitiveType, PrimitiveCount, Vertices, Draw.Stride));
+		}
+	}
+
+public:
+	size_t FailedCalls = 0;
+	size_t UnsupportedDraws = 0;
+	size_t Flips = 0;
+
+	explicit REPLAYDEVICE(IDirect3DDevice9 *Device) : Device(Device) {}
+	~REPLAYDEVICE()
+	{
+		for (auto &Entry : Surfaces)
+		{
+			ReleaseSurface(Entry.second);
+		}
+	}
+
+	void ResetStats()
+	{
+		FailedCalls = 0;
+		UnsupportedDraws = 0;
+		Flips = 0;
+	}
+
+	bool ReplayRecord(const REPLAYRECORD &Record, const std::vector<uint8_t> &data)
+	{
+		const uint8_t *Extra = data.data() + Record.Offset;
+		switch (Record.Header.Id)
+		{
+		case CAPTURE_SURFACE:
+		{
+			CAPTURESURFACE Surface;
+			if (!ReadPayload(Record, data, Surface))
+			{
+				return false;
+			}
+			CreateSurface(Record.Header.Object, Surface);
+			return true;
+		}
+		case CAPTURE_LOCK:
+		{
+			CAPTURELOCK Lock;
+			if (!ReadPayload(Record, data, Lock))
+			{
+				return false;
+			}
+			REPLAYSURFACE *Surface = GetSurface(Record.Header.Object);
+			RECT Rect;
+			if (Surface && !Surface->IsLocked && ClipRect(*Surface, Lock.Rect, Rect))
+			{
+				// DDLOCK_READONLY has the same value as D3DLOCK_READONLY
+				Surface->IsLocked = Check(Surface->Surface->LockRect(&Surface->Locked, &Rect, Lock.Flags & D3DLOCK_READONLY));
+			}
+			return true;
+		}
+		case CAPTURE_UNLOCK:
+		{
+			CAPTUREUNLOCK Unlock;
+			if (!ReadPayload(Record, data, Unlock) || Record.Header.Size - sizeof(Unlock) < (uint64_t)Unlock.Rows * Unlock.RowBytes)
+			{
+				return false;
+			}
+			REPLAYSURFACE *Surface = GetSurface(Record.Header.Object);
+			if (!Surface || !Surface->IsLocked)
+			{
+				return true;
+			}
+
+			// Write what the game stored into the locked rect
+			const LONG Width = std::max<LONG>(std::min<LONG>(Unlock.Rect.Right, Surface->Width) - std::max<LONG>(Unlock.Rect.Left, 0), 0);
+			const LONG Height = std::max<LONG>(std::min<LONG>(Unlock.Rect.Bottom, Surface->Height) - std::max<LONG>(Unlock.Rect.Top, 0), 0);
+			const size_t RowBytes = std::min<size_t>(Unlock.RowBytes, (size_t)Width * Surface->BytesPerPixel);
+			const uint32_t Rows = std::min<uint32_t>(Unlock.Rows, Height);
+			for (uint32_t y = 0; y < Rows; y++)
+			{
+				memcpy((BYTE*)Surface->Locked.pBits + (size_t)y * Surface->Locked.Pitch, Extra + sizeof(Unlock) + (size_t)y * Unlock.RowBytes, RowBytes);
+			}
+			Check(Surface->Surface->UnlockRect());
+			Surface->IsLocked = false;
+			return true;
+		}
+		case CAPTURE_BLT:
+		{
+			CAPTUREBLT Payload;
+			if (!ReadPayload(Record, data, Payload))
+			{
+				return false;
+			}
+			Blt(Record.Header.Object, Payload);
+			return true;
+		}
+		case CAPTURE_FLIP:
+			Flips++;
+			return true;
+		case CAPTURE_SETRENDERSTATE:
+		{
+			CAPTURESTATE State;
+			if (!ReadPayload(Record, data, State))
+			{
+				return false;
+			}
+			Check(Device->SetRenderState((D3DRENDERSTATETYPE)State.State, State.Value));
+			return true;
+		}
+		case CAPTURE_SETTEXTURE:
+		{
+			CAPTURETEXTURE Texture;
+			if (!ReadPayload(Record, data, Texture))
+			{
+				return false;
+			}
+			REPLAYSURFACE *Surface = GetSurface(Texture.Surface);
+			Check(Device->SetTexture(Texture.Stage, Surface ? Surface->Texture : nullptr));
+			return true;
+		}
+		case CAPTURE_DRAW:
+		{
+			CAPTUREDRAW Payload;
+			if (!ReadPayload(Record, data, Payload))
+			{
+				return false;
+			}
+			const uint64_t VertexBytes = (uint64_t)Payload.VertexCount * Payload.Stride;
+			const uint64_t IndexBytes = (uint64_t)Payload.IndexCount * sizeof(uint16_t);
+			if (Record.Header.Size - sizeof(Payload) < VertexBytes + IndexBytes)
+			{
+				return false;
+			}
+			Draw(Payload, Extra + sizeof(Payload), Extra + sizeof(Payload) + VertexBytes);
+			return true;
+		}
+		case CAPTURE_FRAME:
+			if (InScene)
+			{
+				Check(Device->EndScene());
+				InScene = false;
+			}
+			Check(Device->Present(nullptr, nullptr, nullptr, nullptr));
+			return true;
+		default:
+			return false;
+		}
+	}
+};
+
+struct REPLAYRESULT
+{
+	std::vector<double> Times;
+	MOCKSTATS Stats;
+	size_t FailedCalls = 0;
+	size_t UnsupportedDraws = 0;
+	size_t Flips = 0;
+	size_t Malformed = 0;
+};
+
+// The first pass creates the surfaces and warms up the caches, later passes are timed
+static REPLAYRESULT Replay(IDirect3DDevice9 *Device, MockDirect3DDevice9 &Mock, const std::vector<REPLAYRECORD> &Records, const std::vector<uint8_t> &data, int Iterations)
+{
+	REPLAYRESULT Result;
+	REPLAYDEVICE Replayer(Device);
+	for (int Pass = 0; Pass <= Iterations; Pass++)
+	{
+		if (Pass == 1)
+		{
+			Mock.ResetStats();
+			Replayer.ResetStats();
+		}
+		auto Start = std::chrono::steady_clock::now();
+		for (const auto &Record : Records)
+		{
+			if (!Replayer.ReplayRecord(Record, data) && Pass == 0)
+			{
+				Result.Malformed++;
+			}
+			if (Record.Header.Id == CAPTURE_FRAME)
+			{
+				const auto End = std::chrono::steady_clock::now();
+				if (Pass > 0)
+				{
+					Result.Times.push_back(std::chrono::duration<double, std::milli>(End - Start).count());
+				}
+				Start = End;
+			}
+		}
+	}
+	Result.Stats = Mock.GetStats();
+	Result.FailedCalls = Replayer.FailedCalls;
+	Result.UnsupportedDraws = Replayer.UnsupportedDraws;
+	Result.Flips = Replayer.Flips;
+	return Result;
+}
+
+static double PrintTimes(const char *Name, std::vector<double> Times)
+{
+	if (Times.empty())
+	{
+		return 0;
+	}
+	std::sort(Times.begin(), Times.end());
+	double Total = 0;
+	for (double Time : Times)
+	{
+		Total += Time;
+	}
+	const size_t p99 = std::min(Times.size() - 1, Times.size() * 99 / 100);
+	printf("%-16s avg %9.3f  min %9.3f  max %9.3f  p99 %9.3f ms\n", Name, Total / Times.size(), Times.front(), Times.back(), Times[p99]);
+	return Total / Times.size();
+}
+
+int main(int argc, char *argv[])
+{
+	if (argc < 2)
+	{
+		std::cerr << "Usage: " << argv[0] << " <file.capture> [iterations]\n";
+		return 1;
+	}
+	const int Iterations = argc > 2 ? std::max(1, atoi(argv[2])) : 10;
+
+	std::vector<uint8_t> data;
+	if (!ReadFileData(argv[1], data))
+	{
+		std::cerr << "Failed to open " << argv[1] << "\n";
+		return 1;
+	}
+
+	CAPTUREFILEHEADER FileHeader;
+	if (data.size() < sizeof(FileHeader) || (memcpy(&FileHeader, data.data(), sizeof(FileHeader)),
+		memcmp(FileHeader.Magic, CaptureMagic, sizeof(CaptureMagic)) != 0))
+	{
+		std::cerr << argv[1] << " is not a dxwrapper capture\n";
+		return 1;
+	}
+	if (FileHeader.Version != CaptureVersion)
+	{
+		std::cerr << "Unsupported capture version " << FileHeader.Version << "\n";
+		return 1;
+	}
+
+	std::vector<REPLAYRECORD> Records;
+	size_t Offset = sizeof(FileHeader);
+	size_t Frames = 0;
+	while (data.size() - Offset >= sizeof(CAPTURERECORD))
+	{
+		REPLAYRECORD Record;
+		memcpy(&Record.Header, data.data() + Offset, sizeof(Record.Header));
+		Record.Offset = Offset + sizeof(CAPTURERECORD);
+		if (data.size() - Record.Offset < Record.Header.Size)
+		{
+			std::cerr << "Truncated record at offset " << Offset << "\n";
+			break;
+		}
+		Records.push_back(Record);
+		Frames += (Record.Header.Id == CAPTURE_FRAME);
+		Offset = Record.Offset + Record.Header.Size;
+	}
+	if (!Frames)
+	{
+		std::cerr << "No complete frames in " << argv[1] << "\n";
+		return 1;
+	}
+
+	// Frame times of the original run, includes the game, the wrapper and the real driver
+	std::vector<double> CapturedTimes;
+	int64_t FrameStart = Records.front().Header.Timestamp;
+	for (const auto &Record : Records)
+	{
+		if (Record.Header.Id == CAPTURE_FRAME)
+		{
+			CapturedTimes.push_back(FileHeader.TimerFrequency ? (Record.Header.Timestamp - FrameStart) * 1000.0 / FileHeader.TimerFrequency : 0.0);
+			FrameStart = Record.Header.Timestamp;
+		}
+	}
+
+	// Replay straight to the mock device, then through the d3d9 wrapper in front of a second mock device
+	MockDirect3DDevice9 DirectDevice;
+	const REPLAYRESULT Direct = Replay(&DirectDevice, DirectDevice, Records, data, Iterations);
+
+	MockDirect3DDevice9 WrappedDevice;
+	m_IDirect3DDevice9Ex *WrapperDevice = new m_IDirect3DDevice9Ex((LPDIRECT3DDEVICE9EX)&WrappedDevice, nullptr, IID_IDirect3DDevice9);
+	const REPLAYRESULT Wrapped = Replay(WrapperDevice, WrappedDevice, Records, data, Iterations);
+	WrapperDevice->Release();
+
+	printf("%zu records, %zu frames, %d iterations\n", Records.size(), Frames, Iterations);
+	PrintTimes("Captured frame", CapturedTimes);
+	const double DirectTime = PrintTimes("Mock only", Direct.Times);
+	const double WrappedTime = PrintTimes("Wrapper + mock", Wrapped.Times);
+	printf("Wrapper cost: %.3f ms per frame\n", WrappedTime - DirectTime);
+
+	// Per frame device work, averaged over all timed passes
+	const MOCKSTATS &Stats = Wrapped.Stats;
+	const double Count = (double)Frames * Iterations;
+	printf("Per frame: %.1f locks, %.1f KB locked for writing, %.1f fills (%.1f KB), %.1f copies (%.1f KB)\n",
+		Stats.Locks / Count, Stats.BytesUploaded / Count / 1024, Stats.ColorFills / Count, Stats.BytesFilled / Count / 1024,
+		Stats.Copies / Count, Stats.BytesCopied / Count / 1024);
+	printf("Per frame: %.1f render states (%.1f redundant), %.1f texture changes (%.1f KB bound), %.1f draws (%.1f KB vertex data), %.1f buffer discards, %.1f flips\n",
+		Stats.RenderStates / Count, Stats.RedundantRenderStates / Count, Stats.TextureChanges / Count, Stats.TextureBytes / Count / 1024,
+		Stats.Draws / Count, Stats.VertexBytes / Count / 1024, Stats.BufferDiscards / Count, Wrapped.Flips / Count);
+	if (Wrapped.UnsupportedDraws)
+	{
+		printf("Per frame: %.1f strided or vertex buffer draws, not implemented by Dd7to9 and not replayed\n", Wrapped.UnsupportedDraws / Count);
+	}
+
+	// The wrapper should pass every call on unchanged
+	if (!(Wrapped.Stats == Direct.Stats) || Wrapped.FailedCalls != Direct.FailedCalls)
+	{
+		printf("The device work differs through the wrapper: %zu failed calls through the wrapper, %zu direct\n", Wrapped.FailedCalls, Direct.FailedCalls);
+	}
+
+	if (Direct.Malformed)
+	{
+		std::cerr << Direct.Malformed << " malformed records\n";
+	}
+	return Direct.Malformed ? 2 : 0;
+}
@@ -0,0 +1,652 @@
+#pragma once
+
+// Mock Direct3D9 device for the capture replay. It implements IDirect3DDevice9, so it can be handed to the
+// d3d9 wrapper (m_IDirect3DDevice9Ex) in place of the runtime device and the replayed calls run through the
+// wrapper methods. Only the calls the replay makes do any work: textures and surfaces live in system memory,
+// color fills and stretch copies write to them, and user pointer draws copy their vertices into a dynamic
+// buffer the way the runtime does. Every other method fails with D3DERR_INVALIDCALL. The runtime, the driver
+// and the GPU are missing, so replayed frame times show the cost of the wrapper plus this memory traffic.
+
+#include <d3d9.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+struct MOCKSTATS
+{
+	uint64_t Locks = 0;
+	uint64_t BytesUploaded = 0;			// Size of the rects locked for writing
+	uint64_t ColorFills = 0;
+	uint64_t BytesFilled = 0;
+	uint64_t Copies = 0;
+	uint64_t BytesCopied = 0;
+	uint64_t RenderStates = 0;
+	uint64_t RedundantRenderStates = 0;	// SetRenderState calls that did not change the value
+	uint64_t TextureChanges = 0;
+	uint64_t TextureBytes = 0;			// Size of the textures bound by the texture changes
+	uint64_t Draws = 0;
+	uint64_t VertexBytes = 0;			// Bytes copied into the dynamic vertex and index buffers
+	uint64_t BufferDiscards = 0;
+	uint64_t Presents = 0;
+
+	bool operator==(const MOCKSTATS &Other) const { return memcmp(this, &Other, sizeof(MOCKSTATS)) == 0; }
+};
+
+class MockDirect3DDevice9;
+
+class MockDirect3DSurface9 : public IDirect3DSurface9
+{
+private:
+	ULONG Ref = 1;
+	MockDirect3DDevice9 *pDevice;
+	IDirect3DTexture9 *pContainer;		// Texture that owns this surface level, shares its reference count
+	MOCKSTATS &Stats;
+	D3DSURFACE_DESC Desc = {};
+	UINT BytesPerPixel = 0;
+	UINT Pitch = 0;
+	std::vector<BYTE> Bits;
+	bool IsLocked = false;
+
+public:
+	MockDirect3DSurface9(MockDirect3DDevice9 *pDevice, IDirect3DTexture9 *pContainer, MOCKSTATS &Stats, UINT Width, UINT Height, D3DFORMAT Format, D3DPOOL Pool) :
+		pDevice(pDevice), pContainer(pContainer), Stats(Stats)
+	{
+		Desc.Format = Format;
+		Desc.Type = D3DRTYPE_SURFACE;
+		Desc.Pool = Pool;
+		Desc.Width = Width;
+		Desc.Height = Height;
+		BytesPerPixel = GetBytesPerPixel(Format);
+		Pitch = (Width * BytesPerPixel + 3) & ~3u;
+		Bits.assign((size_t)Pitch * Height, 0);
+	}
+
+	static UINT GetBytesPerPixel(D3DFORMAT Format)
+	{
+		switch (Format)
+		{
+		case D3DFMT_P8:
+		case D3DFMT_L8:
+		case D3DFMT_A8:
+			return 1;
+		case D3DFMT_R5G6B5:
+		case D3DFMT_X1R5G5B5:
+		case D3DFMT_A1R5G5B5:
+		case D3DFMT_X4R4G4B4:
+		case D3DFMT_A4R4G4B4:
+			return 2;
+		case D3DFMT_R8G8B8:
+			return 3;
+		default:
+			return 4;
+		}
+	}
+
+	// Clips a rect to the surface, returns false if nothing is left
+	bool ClipRect(CONST RECT *pRect, RECT &Rect) const
+	{
+		Rect = { 0, 0, (LONG)Desc.Width, (LONG)Desc.Height };
+		if (pRect)
+		{
+			Rect.left = std::max<LONG>(pRect->left, 0);
+			Rect.top = std::max<LONG>(pRect->top, 0);
+			Rect.right = std::min<LONG>(pRect->right, Desc.Width);
+			Rect.bottom = std::min<LONG>(pRect->bottom, Desc.Height);
+		}
+		return Rect.left < Rect.right && Rect.top < Rect.bottom;
+	}
+
+	BYTE *GetBits(LONG x, LONG y) { return &Bits[(size_t)y * Pitch + (size_t)x * BytesPerPixel]; }
+	UINT GetBytesPerPixel() const { return BytesPerPixel; }
+	size_t GetSize() const { return Bits.size(); }
+
+	/*** IUnknown methods ***/
+	STDMETHOD(QueryInterface)(THIS_ REFIID riid, void** ppvObj)
+	{
+		if ((riid == IID_IUnknown || riid == IID_IDirect3DResource9 || riid == IID_IDirect3DSurface9) && ppvObj)
+		{
+			AddRef();
+			*ppvObj = this;
+			return D3D_OK;
+		}
+		return E_NOINTERFACE;
+	}
+	STDMETHOD_(ULONG, AddRef)(THIS)
+	{
+		return pContainer ? pContainer->AddRef() : ++Ref;
+	}
+	STDMETHOD_(ULONG, Release)(THIS)
+	{
+		if (pContainer)
+		{
+			return pContainer->Release();
+		}
+		ULONG ref = --Ref;
+		if (ref == 0)
+		{
+			delete this;
+		}
+		return ref;
+	}
+
+	/*** IDirect3DResource9 methods ***/
+	STDMETHOD(GetDevice)(THIS_ IDirect3DDevice9** ppDevice);
+	STDMETHOD(SetPrivateData)(THIS_ REFGUID refguid, CONST void* pData, DWORD SizeOfData, DWORD Flags) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetPrivateData)(THIS_ REFGUID refguid, void* pData, DWORD* pSizeOfData) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(FreePrivateData)(THIS_ REFGUID refguid) { return D3DERR_INVALIDCALL; }
+	STDMETHOD_(DWORD, SetPriority)(THIS_ DWORD PriorityNew) { return 0; }
+	STDMETHOD_(DWORD, GetPriority)(THIS) { return 0; }
+	STDMETHOD_(void, PreLoad)(THIS) {}
+	STDMETHOD_(D3DRESOURCETYPE, GetType)(THIS) { return D3DRTYPE_SURFACE; }
+
+	/*** IDirect3DSurface9 methods ***/
+	STDMETHOD(GetContainer)(THIS_ REFIID riid, void** ppContainer)
+	{
+		if (!pContainer || !ppContainer)
+		{
+			return D3DERR_INVALIDCALL;
+		}
+		return pContainer->QueryInterface(riid, ppContainer);
+	}
+	STDMETHOD(GetDesc)(THIS_ D3DSURFACE_DESC *pDesc)
+	{
+		if (!pDesc)
+		{
+			return D3DERR_INVALIDCALL;
+		}
+		*pDesc = Desc;
+		return D3D_OK;
+	}
+	STDMETHOD(LockRect)(THIS_ D3DLOCKED_RECT* pLockedRect, CONST RECT* pRect, DWORD Flags)
+	{
+		RECT Rect;
+		if (!pLockedRect || IsLocked || !ClipRect(pRect, Rect))
+		{
+			return D3DERR_INVALIDCALL;
+		}
+		IsLocked = true;
+		pLockedRect->Pitch = Pitch;
+		pLockedRect->pBits = GetBits(Rect.left, Rect.top);
+		Stats.Locks++;
+		if (!(Flags & D3DLOCK_READONLY))
+		{
+			Stats.BytesUploaded += (uint64_t)(Rect.bottom - Rect.top) * (Rect.right - Rect.left) * BytesPerPixel;
+		}
+		return D3D_OK;
+	}
+	STDMETHOD(UnlockRect)(THIS)
+	{
+		if (!IsLocked)
+		{
+			return D3DERR_INVALIDCALL;
+		}
+		IsLocked = false;
+		return D3D_OK;
+	}
+	STDMETHOD(GetDC)(THIS_ HDC *phdc) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(ReleaseDC)(THIS_ HDC hdc) { return D3DERR_INVALIDCALL; }
+};
+
+// Texture with a single level
+class MockDirect3DTexture9 : public IDirect3DTexture9
+{
+private:
+	ULONG Ref = 1;
+	MockDirect3DDevice9 *pDevice;
+	MockDirect3DSurface9 *pLevel;
+
+public:
+	MockDirect3DTexture9(MockDirect3DDevice9 *pDevice, MOCKSTATS &Stats, UINT Width, UINT Height, D3DFORMAT Format, D3DPOOL Pool) :
+		pDevice(pDevice), pLevel(new MockDirect3DSurface9(pDevice, this, Stats, Width, Height, Format, Pool)) {}
+	~MockDirect3DTexture9()
+	{
+		delete pLevel;
+	}
+
+	MockDirect3DSurface9 *GetLevel() { return pLevel; }
+
+	/*** IUnknown methods ***/
+	STDMETHOD(QueryInterface)(THIS_ REFIID riid, void** ppvObj)
+	{
+		if ((riid == IID_IUnknown || riid == IID_IDirect3DResource9 || riid == IID_IDirect3DBaseTexture9 || riid == IID_IDirect3DTexture9) && ppvObj)
+		{
+			AddRef();
+			*ppvObj = this;
+			return D3D_OK;
+		}
+		return E_NOINTERFACE;
+	}
+	STDMETHOD_(ULONG, AddRef)(THIS)
+	{
+		return ++Ref;
+	}
+	STDMETHOD_(ULONG, Release)(THIS)
+	{
+		ULONG ref = --Ref;
+		if (ref == 0)
+		{
+			delete this;
+		}
+		return ref;
+	}
+
+	/*** IDirect3DBaseTexture9 methods ***/
+	STDMETHOD(GetDevice)(THIS_ IDirect3DDevice9** ppDevice);
+	STDMETHOD(SetPrivateData)(THIS_ REFGUID refguid, CONST void* pData, DWORD SizeOfData, DWORD Flags) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetPrivateData)(THIS_ REFGUID refguid, void* pData, DWORD* pSizeOfData) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(FreePrivateData)(THIS_ REFGUID refguid) { return D3DERR_INVALIDCALL; }
+	STDMETHOD_(DWORD, SetPriority)(THIS_ DWORD PriorityNew) { return 0; }
+	STDMETHOD_(DWORD, GetPriority)(THIS) { return 0; }
+	STDMETHOD_(void, PreLoad)(THIS) {}
+	STDMETHOD_(DWORD, SetLOD)(THIS_ DWORD LODNew) { return 0; }
+	STDMETHOD_(DWORD, GetLOD)(THIS) { return 0; }
+	STDMETHOD(SetAutoGenFilterType)(THIS_ D3DTEXTUREFILTERTYPE FilterType) { return D3DERR_INVALIDCALL; }
+	STDMETHOD_(D3DTEXTUREFILTERTYPE, GetAutoGenFilterType)(THIS) { return D3DTEXF_NONE; }
+	STDMETHOD_(void, GenerateMipSubLevels)(THIS) {}
+	STDMETHOD_(D3DRESOURCETYPE, GetType)(THIS) { return D3DRTYPE_TEXTURE; }
+	STDMETHOD_(DWORD, GetLevelCount)(THIS) { return 1; }
+
+	/*** IDirect3DTexture9 methods ***/
+	STDMETHOD(GetLevelDesc)(THIS_ UINT Level, D3DSURFACE_DESC *pDesc)
+	{
+		return (Level == 0) ? pLevel->GetDesc(pDesc) : D3DERR_INVALIDCALL;
+	}
+	STDMETHOD(GetSurfaceLevel)(THIS_ UINT Level, IDirect3DSurface9** ppSurfaceLevel)
+	{
+		if (Level != 0 || !ppSurfaceLevel)
+		{
+			return D3DERR_INVALIDCALL;
+		}
+		pLevel->AddRef();
+		*ppSurfaceLevel = pLevel;
+		return D3D_OK;
+	}
+	STDMETHOD(LockRect)(THIS_ UINT Level, D3DLOCKED_RECT* pLockedRect, CONST RECT* pRect, DWORD Flags)
+	{
+		return (Level == 0) ? pLevel->LockRect(pLockedRect, pRect, Flags) : D3DERR_INVALIDCALL;
+	}
+	STDMETHOD(UnlockRect)(THIS_ UINT Level)
+	{
+		return (Level == 0) ? pLevel->UnlockRect() : D3DERR_INVALIDCALL;
+	}
+	STDMETHOD(AddDirtyRect)(THIS_ CONST RECT* pDirtyRect) { return D3DERR_INVALIDCALL; }
+};
+
+class MockDirect3DDevice9 : public IDirect3DDevice9
+{
+private:
+	static constexpr size_t DynamicBufferSize = 4 * 1024 * 1024;
+	static constexpr DWORD MaxTextureStages = 8;
+
+	// The device is owned by the replay, releasing the last reference does not delete it
+	ULONG Ref = 1;
+	std::unordered_map<DWORD, DWORD> RenderStates;
+	IDirect3DBaseTexture9 *Textures[MaxTextureStages] = {};
+	std::vector<BYTE> DynamicBuffer = std::vector<BYTE>(DynamicBufferSize);
+	size_t DynamicBufferOffset = 0;
+	DWORD FVF = 0;
+	bool InScene = false;
+	MOCKSTATS Stats;
+
+	static UINT GetVertexCount(D3DPRIMITIVETYPE PrimitiveType, UINT PrimitiveCount)
+	{
+		switch (PrimitiveType)
+		{
+		case D3DPT_POINTLIST:
+			return PrimitiveCount;
+		case D3DPT_LINELIST:
+			return PrimitiveCount * 2;
+		case D3DPT_LINESTRIP:
+			return PrimitiveCount + 1;
+		case D3DPT_TRIANGLELIST:
+			return PrimitiveCount * 3;
+		case D3DPT_TRIANGLESTRIP:
+		case D3DPT_TRIANGLEFAN:
+			return PrimitiveCount + 2;
+		default:
+			return 0;
+		}
+	}
+
+	// Copies Size bytes into the dynamic buffer the same way DrawPrimitiveUP does inside the runtime
+	void UploadToDynamicBuffer(const void *Data, size_t Size)
+	{
+		Size = std::min(Size, DynamicBufferSize);
+		if (DynamicBufferOffset + Size > DynamicBufferSize)
+		{
+			DynamicBufferOffset = 0;
+			Stats.BufferDiscards++;
+		}
+		memcpy(DynamicBuffer.data() + DynamicBufferOffset, Data, Size);
+		DynamicBufferOffset += Size;
+		Stats.VertexBytes += Size;
+	}
+
+public:
+	const MOCKSTATS &GetStats() const { return Stats; }
+	void ResetStats() { Stats = {}; }
+
+	/*** IUnknown methods ***/
+	STDMETHOD(QueryInterface)(THIS_ REFIID riid, void** ppvObj)
+	{
+		if ((riid == IID_IUnknown || riid == IID_IDirect3DDevice9) && ppvObj)
+		{
+			AddRef();
+			*ppvObj = this;
+			return D3D_OK;
+		}
+		return E_NOINTERFACE;
+	}
+	STDMETHOD_(ULONG, AddRef)(THIS)
+	{
+		return ++Ref;
+	}
+	STDMETHOD_(ULONG, Release)(THIS)
+	{
+		return (Ref > 0) ? --Ref : 0;
+	}
+
+	/*** IDirect3DDevice9 methods the replay uses ***/
+	STDMETHOD(TestCooperativeLevel)(THIS) { return D3D_OK; }
+	STDMETHOD(GetDirect3D)(THIS_ IDirect3D9** ppD3D9) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetDeviceCaps)(THIS_ D3DCAPS9* pCaps)
+	{
+		if (!pCaps)
+		{
+			return D3DERR_INVALIDCALL;
+		}
+		memset(pCaps, 0, sizeof(D3DCAPS9));
+		pCaps->DeviceType = D3DDEVTYPE_HAL;
+		pCaps->MaxTextureWidth = 8192;
+		pCaps->MaxTextureHeight = 8192;
+		pCaps->MaxSimultaneousTextures = MaxTextureStages;
+		return D3D_OK;
+	}
+	STDMETHOD(CreateTexture)(THIS_ UINT Width, UINT Height, UINT Levels, DWORD Usage, D3DFORMAT Format, D3DPOOL Pool, IDirect3DTexture9** ppTexture, HANDLE* pSharedHandle)
+	{
+		if (!ppTexture || !Width || !Height || Levels > 1 || pSharedHandle)
+		{
+			return D3DERR_INVALIDCALL;
+		}
+		*ppTexture = new MockDirect3DTexture9(this, Stats, Width, Height, Format, Pool);
+		return D3D_OK;
+	}
+	STDMETHOD(CreateOffscreenPlainSurface)(THIS_ UINT Width, UINT Height, D3DFORMAT Format, D3DPOOL Pool, IDirect3DSurface9** ppSurface, HANDLE* pSharedHandle)
+	{
+		if (!ppSurface || !Width || !Height || pSharedHandle)
+		{
+			return D3DERR_INVALIDCALL;
+		}
+		*ppSurface = new MockDirect3DSurface9(this, nullptr, Stats, Width, Height, Format, Pool);
+		return D3D_OK;
+	}
+	STDMETHOD(ColorFill)(THIS_ IDirect3DSurface9* pSurface, CONST RECT* pRect, D3DCOLOR color)
+	{
+		MockDirect3DSurface9 *Surface = static_cast<MockDirect3DSurface9*>(pSurface);
+		RECT Rect;
+		if (!Surface || !Surface->ClipRect(pRect, Rect))
+		{
+			return D3DERR_INVALIDCALL;
+		}
+		const UINT Bpp = Surface->GetBytesPerPixel();
+		for (LONG y = Rect.top; y < Rect.bottom; y++)
+		{
+			BYTE *Row = Surface->GetBits(Rect.left, y);
+			for (LONG x = 0; x < Rect.right - Rect.left; x++)
+			{
+				memcpy(Row + x * Bpp, &color, Bpp);
+			}
+		}
+		Stats.ColorFills++;
+		Stats.BytesFilled += (uint64_t)(Rect.bottom - Rect.top) * (Rect.right - Rect.left) * Bpp;
+		return D3D_OK;
+	}
+	// Nearest point copy between two surfaces of the same format, like StretchRect with D3DTEXF_NONE
+	STDMETHOD(StretchRect)(THIS_ IDirect3DSurface9* pSourceSurface, CONST RECT* pSourceRect, IDirect3DSurface9* pDestSurface, CONST RECT* pDestRect, D3DTEXTUREFILTERTYPE Filter)
+	{
+		MockDirect3DSurface9 *Src = static_cast<MockDirect3DSurface9*>(pSourceSurface);
+		MockDirect3DSurface9 *Dest = static_cast<MockDirect3DSurface9*>(pDestSurface);
+		RECT SrcRect, DestRect;
+		if (!Src || !Dest || Src == Dest || Src->GetBytesPerPixel() != Dest->GetBytesPerPixel() ||
+			!Src->ClipRect(pSourceRect, SrcRect) || !Dest->ClipRect(pDestRect, DestRect))
+		{
+			return D3DERR_INVALIDCALL;
+		}
+		const UINT Bpp = Dest->GetBytesPerPixel();
+		const LONG SrcWidth = SrcRect.right - SrcRect.left, SrcHeight = SrcRect.bottom - SrcRect.top;
+		const LONG DestWidth = DestRect.right - DestRect.left, DestHeight = DestRect.bottom - DestRect.top;
+		for (LONG y = 0; y < DestHeight; y++)
+		{
+			const LONG sy = SrcRect.top + y * SrcHeight / DestHeight;
+			BYTE *DestRow = Dest->GetBits(DestRect.left, DestRect.top + y);
+			if (SrcWidth == DestWidth)
+			{
+				memcpy(DestRow, Src->GetBits(SrcRect.left, sy), (size_t)DestWidth * Bpp);
+				continue;
+			}
+			for (LONG x = 0; x < DestWidth; x++)
+			{
+				memcpy(DestRow + x * Bpp, Src->GetBits(SrcRect.left + x * SrcWidth / DestWidth, sy), Bpp);
+			}
+		}
+		Stats.Copies++;
+		Stats.BytesCopied += (uint64_t)DestWidth * DestHeight * Bpp;
+		return D3D_OK;
+	}
+	STDMETHOD(BeginScene)(THIS)
+	{
+		if (InScene)
+		{
+			return D3DERR_INVALIDCALL;
+		}
+		InScene = true;
+		return D3D_OK;
+	}
+	STDMETHOD(EndScene)(THIS)
+	{
+		if (!InScene)
+		{
+			return D3DERR_INVALIDCALL;
+		}
+		InScene = false;
+		return D3D_OK;
+	}
+	STDMETHOD(SetRenderState)(THIS_ D3DRENDERSTATETYPE State, DWORD Value)
+	{
+		Stats.RenderStates++;
+		auto it = RenderStates.find(State);
+		if (it != RenderStates.end() && it->second == Value)
+		{
+			Stats.RedundantRenderStates++;
+			return D3D_OK;
+		}
+		RenderStates[State] = Value;
+		return D3D_OK;
+	}
+	STDMETHOD(GetRenderState)(THIS_ D3DRENDERSTATETYPE State, DWORD* pValue)
+	{
+		if (!pValue)
+		{
+			return D3DERR_INVALIDCALL;
+		}
+		auto it = RenderStates.find(State);
+		*pValue = (it != RenderStates.end()) ? it->second : 0;
+		return D3D_OK;
+	}
+	STDMETHOD(SetTexture)(THIS_ DWORD Stage, IDirect3DBaseTexture9* pTexture)
+	{
+		if (Stage >= MaxTextureStages)
+		{
+			return D3DERR_INVALIDCALL;
+		}
+		if (Textures[Stage] != pTexture)
+		{
+			Textures[Stage] = pTexture;
+			Stats.TextureChanges++;
+			if (pTexture && pTexture->GetType() == D3DRTYPE_TEXTURE)
+			{
+				Stats.TextureBytes += static_cast<MockDirect3DTexture9*>(pTexture)->GetLevel()->GetSize();
+			}
+		}
+		return D3D_OK;
+	}
+	STDMETHOD(SetFVF)(THIS_ DWORD FVF)
+	{
+		this->FVF = FVF;
+		return D3D_OK;
+	}
+	STDMETHOD(DrawPrimitiveUP)(THIS_ D3DPRIMITIVETYPE PrimitiveType, UINT PrimitiveCount, CONST void* pVertexStreamZeroData, UINT VertexStreamZeroStride)
+	{
+		const UINT VertexCount = GetVertexCount(PrimitiveType, PrimitiveCount);
+		if (!InScene || !VertexCount || !pVertexStreamZeroData)
+		{
+			return D3DERR_INVALIDCALL;
+		}
+		UploadToDynamicBuffer(pVertexStreamZeroData, (size_t)VertexCount * VertexStreamZeroStride);
+		Stats.Draws++;
+		return D3D_OK;
+	}
+	STDMETHOD(DrawIndexedPrimitiveUP)(THIS_ D3DPRIMITIVETYPE PrimitiveType, UINT MinVertexIndex, UINT NumVertices, UINT PrimitiveCount, CONST void* pIndexData, D3DFORMAT IndexDataFormat, CONST void* pVertexStreamZeroData, UINT VertexStreamZeroStride)
+	{
+		const UINT IndexCount = GetVertexCount(PrimitiveType, PrimitiveCount);
+		if (!InScene || !IndexCount || !pIndexData || !pVertexStreamZeroData)
+		{
+			return D3DERR_INVALIDCALL;
+		}
+		UploadToDynamicBuffer((const BYTE*)pVertexStreamZeroData + (size_t)MinVertexIndex * VertexStreamZeroStride, (size_t)NumVertices * VertexStreamZeroStride);
+		UploadToDynamicBuffer(pIndexData, (size_t)IndexCount * (IndexDataFormat == D3DFMT_INDEX32 ? 4 : 2));
+		Stats.Draws++;
+		return D3D_OK;
+	}
+	STDMETHOD(Present)(THIS_ CONST RECT* pSourceRect, CONST RECT* pDestRect, HWND hDestWindowOverride, CONST RGNDATA* pDirtyRegion)
+	{
+		Stats.Presents++;
+		return D3D_OK;
+	}
+
+	/*** IDirect3DDevice9 methods the replay does not use ***/
+	STDMETHOD_(UINT, GetAvailableTextureMem)(THIS) { return 0; }
+	STDMETHOD(EvictManagedResources)(THIS) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetDisplayMode)(THIS_ UINT iSwapChain, D3DDISPLAYMODE* pMode) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetCreationParameters)(THIS_ D3DDEVICE_CREATION_PARAMETERS *pParameters) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(SetCursorProperties)(THIS_ UINT XHotSpot, UINT YHotSpot, IDirect3DSurface9* pCursorBitmap) { return D3DERR_INVALIDCALL; }
+	STDMETHOD_(void, SetCursorPosition)(THIS_ int X, int Y, DWORD Flags) {}
+	STDMETHOD_(BOOL, ShowCursor)(THIS_ BOOL bShow) { return 0; }
+	STDMETHOD(CreateAdditionalSwapChain)(THIS_ D3DPRESENT_PARAMETERS* pPresentationParameters, IDirect3DSwapChain9** pSwapChain) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetSwapChain)(THIS_ UINT iSwapChain, IDirect3DSwapChain9** pSwapChain) { return D3DERR_INVALIDCALL; }
+	STDMETHOD_(UINT, GetNumberOfSwapChains)(THIS) { return 0; }
+	STDMETHOD(Reset)(THIS_ D3DPRESENT_PARAMETERS* pPresentationParameters) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetBackBuffer)(THIS_ UINT iSwapChain, UINT iBackBuffer, D3DBACKBUFFER_TYPE Type, IDirect3DSurface9** ppBackBuffer) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetRasterStatus)(THIS_ UINT iSwapChain, D3DRASTER_STATUS* pRasterStatus) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(SetDialogBoxMode)(THIS_ BOOL bEnableDialogs) { return D3DERR_INVALIDCALL; }
+	STDMETHOD_(void, SetGammaRamp)(THIS_ UINT iSwapChain, DWORD Flags, CONST D3DGAMMARAMP* pRamp) {}
+	STDMETHOD_(void, GetGammaRamp)(THIS_ UINT iSwapChain, D3DGAMMARAMP* pRamp) {}
+	STDMETHOD(CreateVolumeTexture)(THIS_ UINT Width, UINT Height, UINT Depth, UINT Levels, DWORD Usage, D3DFORMAT Format, D3DPOOL Pool, IDirect3DVolumeTexture9** ppVolumeTexture, HANDLE* pSharedHandle) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(CreateCubeTexture)(THIS_ UINT EdgeLength, UINT Levels, DWORD Usage, D3DFORMAT Format, D3DPOOL Pool, IDirect3DCubeTexture9** ppCubeTexture, HANDLE* pSharedHandle) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(CreateVertexBuffer)(THIS_ UINT Length, DWORD Usage, DWORD FVF, D3DPOOL Pool, IDirect3DVertexBuffer9** ppVertexBuffer, HANDLE* pSharedHandle) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(CreateIndexBuffer)(THIS_ UINT Length, DWORD Usage, D3DFORMAT Format, D3DPOOL Pool, IDirect3DIndexBuffer9** ppIndexBuffer, HANDLE* pSharedHandle) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(CreateRenderTarget)(THIS_ UINT Width, UINT Height, D3DFORMAT Format, D3DMULTISAMPLE_TYPE MultiSample, DWORD MultisampleQuality, BOOL Lockable, IDirect3DSurface9** ppSurface, HANDLE* pSharedHandle) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(CreateDepthStencilSurface)(THIS_ UINT Width, UINT Height, D3DFORMAT Format, D3DMULTISAMPLE_TYPE MultiSample, DWORD MultisampleQuality, BOOL Discard, IDirect3DSurface9** ppSurface, HANDLE* pSharedHandle) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(UpdateSurface)(THIS_ IDirect3DSurface9* pSourceSurface, CONST RECT* pSourceRect, IDirect3DSurface9* pDestinationSurface, CONST POINT* pDestPoint) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(UpdateTexture)(THIS_ IDirect3DBaseTexture9* pSourceTexture, IDirect3DBaseTexture9* pDestinationTexture) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetRenderTargetData)(THIS_ IDirect3DSurface9* pRenderTarget, IDirect3DSurface9* pDestSurface) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetFrontBufferData)(THIS_ UINT iSwapChain, IDirect3DSurface9* pDestSurface) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(SetRenderTarget)(THIS_ DWORD RenderTargetIndex, IDirect3DSurface9* pRenderTarget) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetRenderTarget)(THIS_ DWORD RenderTargetIndex, IDirect3DSurface9** ppRenderTarget) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(SetDepthStencilSurface)(THIS_ IDirect3DSurface9* pNewZStencil) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetDepthStencilSurface)(THIS_ IDirect3DSurface9** ppZStencilSurface) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(Clear)(THIS_ DWORD Count, CONST D3DRECT* pRects, DWORD Flags, D3DCOLOR Color, float Z, DWORD Stencil) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(SetTransform)(THIS_ D3DTRANSFORMSTATETYPE State, CONST D3DMATRIX* pMatrix) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetTransform)(THIS_ D3DTRANSFORMSTATETYPE State, D3DMATRIX* pMatrix) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(MultiplyTransform)(THIS_ D3DTRANSFORMSTATETYPE State, CONST D3DMATRIX *pMatrix) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(SetViewport)(THIS_ CONST D3DVIEWPORT9* pViewport) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetViewport)(THIS_ D3DVIEWPORT9* pViewport) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(SetMaterial)(THIS_ CONST D3DMATERIAL9* pMaterial) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetMaterial)(THIS_ D3DMATERIAL9* pMaterial) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(SetLight)(THIS_ DWORD Index, CONST D3DLIGHT9* pLight) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetLight)(THIS_ DWORD Index, D3DLIGHT9* pLight) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(LightEnable)(THIS_ DWORD Index, BOOL Enable) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetLightEnable)(THIS_ DWORD Index, BOOL* pEnable) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(SetClipPlane)(THIS_ DWORD Index, CONST float* pPlane) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetClipPlane)(THIS_ DWORD Index, float* pPlane) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(CreateStateBlock)(THIS_ D3DSTATEBLOCKTYPE Type, IDirect3DStateBlock9** ppSB) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(BeginStateBlock)(THIS) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(EndStateBlock)(THIS_ IDirect3DStateBlock9** ppSB) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(SetClipStatus)(THIS_ CONST D3DCLIPSTATUS9* pClipStatus) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetClipStatus)(THIS_ D3DCLIPSTATUS9* pClipStatus) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetTexture)(THIS_ DWORD Stage, IDirect3DBaseTexture9** ppTexture) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetTextureStageState)(THIS_ DWORD Stage, D3DTEXTURESTAGESTATETYPE Type, DWORD* pValue) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(SetTextureStageState)(THIS_ DWORD Stage, D3DTEXTURESTAGESTATETYPE Type, DWORD Value) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetSamplerState)(THIS_ DWORD Sampler, D3DSAMPLERSTATETYPE Type, DWORD* pValue) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(SetSamplerState)(THIS_ DWORD Sampler, D3DSAMPLERSTATETYPE Type, DWORD Value) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(ValidateDevice)(THIS_ DWORD* pNumPasses) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(SetPaletteEntries)(THIS_ UINT PaletteNumber, CONST PALETTEENTRY* pEntries) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetPaletteEntries)(THIS_ UINT PaletteNumber, PALETTEENTRY* pEntries) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(SetCurrentTexturePalette)(THIS_ UINT PaletteNumber) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetCurrentTexturePalette)(THIS_ UINT *PaletteNumber) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(SetScissorRect)(THIS_ CONST RECT* pRect) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetScissorRect)(THIS_ RECT* pRect) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(SetSoftwareVertexProcessing)(THIS_ BOOL bSoftware) { return D3DERR_INVALIDCALL; }
+	STDMETHOD_(BOOL, GetSoftwareVertexProcessing)(THIS) { return 0; }
+	STDMETHOD(SetNPatchMode)(THIS_ float nSegments) { return D3DERR_INVALIDCALL; }
+	STDMETHOD_(float, GetNPatchMode)(THIS) { return 0; }
+	STDMETHOD(DrawPrimitive)(THIS_ D3DPRIMITIVETYPE PrimitiveType, UINT StartVertex, UINT PrimitiveCount) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(DrawIndexedPrimitive)(THIS_ D3DPRIMITIVETYPE, INT BaseVertexIndex, UINT MinVertexIndex, UINT NumVertices, UINT startIndex, UINT primCount) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(ProcessVertices)(THIS_ UINT SrcStartIndex, UINT DestIndex, UINT VertexCount, IDirect3DVertexBuffer9* pDestBuffer, IDirect3DVertexDeclaration9* pVertexDecl, DWORD Flags) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(CreateVertexDeclaration)(THIS_ CONST D3DVERTEXELEMENT9* pVertexElements, IDirect3DVertexDeclaration9** ppDecl) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(SetVertexDeclaration)(THIS_ IDirect3DVertexDeclaration9* pDecl) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetVertexDeclaration)(THIS_ IDirect3DVertexDeclaration9** ppDecl) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetFVF)(THIS_ DWORD* pFVF) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(CreateVertexShader)(THIS_ CONST DWORD* pFunction, IDirect3DVertexShader9** ppShader) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(SetVertexShader)(THIS_ IDirect3DVertexShader9* pShader) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetVertexShader)(THIS_ IDirect3DVertexShader9** ppShader) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(SetVertexShaderConstantF)(THIS_ UINT StartRegister, CONST float* pConstantData, UINT Vector4fCount) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetVertexShaderConstantF)(THIS_ UINT StartRegister, float* pConstantData, UINT Vector4fCount) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(SetVertexShaderConstantI)(THIS_ UINT StartRegister, CONST int* pConstantData, UINT Vector4iCount) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetVertexShaderConstantI)(THIS_ UINT StartRegister, int* pConstantData, UINT Vector4iCount) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(SetVertexShaderConstantB)(THIS_ UINT StartRegister, CONST BOOL* pConstantData, UINT  BoolCount) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetVertexShaderConstantB)(THIS_ UINT StartRegister, BOOL* pConstantData, UINT BoolCount) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(SetStreamSource)(THIS_ UINT StreamNumber, IDirect3DVertexBuffer9* pStreamData, UINT OffsetInBytes, UINT Stride) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetStreamSource)(THIS_ UINT StreamNumber, IDirect3DVertexBuffer9** ppStreamData, UINT* pOffsetInBytes, UINT* pStride) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(SetStreamSourceFreq)(THIS_ UINT StreamNumber, UINT Setting) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetStreamSourceFreq)(THIS_ UINT StreamNumber, UINT* pSetting) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(SetIndices)(THIS_ IDirect3DIndexBuffer9* pIndexData) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetIndices)(THIS_ IDirect3DIndexBuffer9** ppIndexData) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(CreatePixelShader)(THIS_ CONST DWORD* pFunction, IDirect3DPixelShader9** ppShader) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(SetPixelShader)(THIS_ IDirect3DPixelShader9* pShader) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetPixelShader)(THIS_ IDirect3DPixelShader9** ppShader) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(SetPixelShaderConstantF)(THIS_ UINT StartRegister, CONST float* pConstantData, UINT Vector4fCount) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetPixelShaderConstantF)(THIS_ UINT StartRegister, float* pConstantData, UINT Vector4fCount) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(SetPixelShaderConstantI)(THIS_ UINT StartRegister, CONST int* pConstantData, UINT Vector4iCount) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetPixelShaderConstantI)(THIS_ UINT StartRegister, int* pConstantData, UINT Vector4iCount) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(SetPixelShaderConstantB)(THIS_ UINT StartRegister, CONST BOOL* pConstantData, UINT  BoolCount) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(GetPixelShaderConstantB)(THIS_ UINT StartRegister, BOOL* pConstantData, UINT BoolCount) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(DrawRectPatch)(THIS_ UINT Handle, CONST float* pNumSegs, CONST D3DRECTPATCH_INFO* pRectPatchInfo) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(DrawTriPatch)(THIS_ UINT Handle, CONST float* pNumSegs, CONST D3DTRIPATCH_INFO* pTriPatchInfo) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(DeletePatch)(THIS_ UINT Handle) { return D3DERR_INVALIDCALL; }
+	STDMETHOD(CreateQuery)(THIS_ D3DQUERYTYPE Type, IDirect3DQuery9** ppQuery) { return D3DERR_INVALIDCALL; }
+};
+
+inline HRESULT MockDirect3DSurface9::GetDevice(IDirect3DDevice9** ppDevice)
+{
+	if (!ppDevice)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	pDevice->AddRef();
+	*ppDevice = pDevice;
+	return D3D_OK;
+}
+
+inline HRESULT MockDirect3DTexture9::GetDevice(IDirect3DDevice9** ppDevice)
+{
+	if (!ppDevice)
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	pDevice->AddRef();
+	*ppDevice = pDevice;
+	return D3D_OK;
+}
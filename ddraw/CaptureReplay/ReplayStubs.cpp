@@ -0,0 +1,61 @@
+/**
+* Copyright (C) 2022 Elisha Riedlinger
+*
+* This software is  provided 'as-is', without any express  or implied  warranty. In no event will the
+* authors be held liable for any damages arising from the use of this software.
+* Permission  is granted  to anyone  to use  this software  for  any  purpose,  including  commercial
+* applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*   1. The origin of this software must not be misrepresented; you must not claim that you  wrote the
+*      original  software. If you use this  software  in a product, an  acknowledgment in the product
+*      documentation would be appreciated but is not required.
+*   2. Altered source versions must  be plainly  marked as such, and  must not be  misrepresented  as
+*      being the original software.
+*   3. This notice may not be removed or altered from any source distribution.
+*
+* The parts of dxwrapper the d3d9 wrapper sources link against, so CaptureReplay can build them without
+* the rest of the dll. The settings keep their defaults and the screen functions match Utils\Fullscreen.cpp.
+*/
+
+#include "../../Settings/Settings.h"
+#include "../../Utils/Utils.h"
+#include "../../Libraries/d3dx9.h"
+
+CONFIG Config;
+
+HMONITOR Utils::GetMonitorHandle(HWND hWnd)
+{
+	return MonitorFromWindow(IsWindow(hWnd) ? hWnd : GetDesktopWindow(), MONITOR_DEFAULTTONEAREST);
+}
+
+DWORD Utils::GetRefreshRate(HWND)
+{
+	HDC hdc = GetDC(nullptr);
+	DWORD RefreshRate = GetDeviceCaps(hdc, VREFRESH);
+	ReleaseDC(nullptr, hdc);
+
+	return RefreshRate;
+}
+
+void Utils::GetScreenSize(HWND hwnd, LONG &screenWidth, LONG &screenHeight)
+{
+	MONITORINFO info = {};
+	info.cbSize = sizeof(MONITORINFO);
+	GetMonitorInfo(GetMonitorHandle(hwnd), &info);
+	screenWidth = info.rcMonitor.right - info.rcMonitor.left;
+	screenHeight = info.rcMonitor.bottom - info.rcMonitor.top;
+}
+
+void Utils::GetDesktopRect(HWND hWnd, RECT& screenRect)
+{
+	MONITORINFO info = {};
+	info.cbSize = sizeof(MONITORINFO);
+	GetMonitorInfo(GetMonitorHandle(hWnd), &info);
+	screenRect = info.rcMonitor;
+}
+
+// Only used by CopyRects for format conversions, which the replay does not make
+HRESULT WINAPI D3DXLoadSurfaceFromSurface(LPDIRECT3DSURFACE9, const PALETTEENTRY*, const RECT*, LPDIRECT3DSURFACE9, const PALETTEENTRY*, const RECT*, DWORD, D3DCOLOR)
+{
+	return D3DERR_INVALIDCALL;
+}
@@ -79,6 +79,12 @@ void DebugOverlay::Setup(HWND hwnd, LPDIRECT3DDEVICE9 d3d9Device)
 		SetWindowLongPtr(hwnd, GWLP_WNDPROC, (LONG_PTR)OverrideWndProc);
 	}
 
+	// Reset frame timing for the new device
+	LARGE_INTEGER Frequency;
+	QueryPerformanceFrequency(&Frequency);
+	Telemetry.SetFrequency(Frequency.QuadPart);
+	Telemetry.Reset();
+
 	// Context is setup
 	IsContextSetup = true;
 }
@@ -188,6 +194,8 @@ void DebugOverlay::EndScene()
 		}
 		ImGui::End();
 
+		DrawFrameTimingPanel();
+
 		ImGui::Render();
 		ImGui_ImplDX9_RenderDrawData(ImGui::GetDrawData());
 	}
@@ -197,6 +205,48 @@ void DebugOverlay::EndScene()
 	}
 }
 
+// Called right after the d3d9 present that ends the frame
+void DebugOverlay::EndFrame(LONGLONG PresentStart)
+{
+	LARGE_INTEGER PresentEnd;
+	QueryPerformanceCounter(&PresentEnd);
+	Telemetry.EndFrame(PresentStart, PresentEnd.QuadPart);
+
+#ifdef ENABLE_DEBUGOVERLAY
+	// Waiting in present is not CPU time, take it back out of the wrapped call that presented
+	if (OverlayWrapperTimer::Depth)
+	{
+		Telemetry.AddWrapperTime(PresentStart - PresentEnd.QuadPart);
+	}
+#endif
+}
+
+void DebugOverlay::DrawFrameTimingPanel()
+{
+	const auto& History = Telemetry.GetHistory();
+	const FRAMESUMMARY Summary = Telemetry.GetSummary();
+
+	ImGui::Begin("Frame Timing");
+	if (Summary.Frames < 1)
+	{
+		ImGui::Text("No frames presented");
+		ImGui::End();
+		return;
+	}
+
+	const FRAMESTATS& Last = History[History.GetCount() - 1];
+	ImGui::Text("Frame time: %.2f ms  avg %.2f  min %.2f  max %.2f  99%% %.2f", Last.FrameTimeMs,
+		Summary.AverageFrameTimeMs, Summary.MinFrameTimeMs, Summary.MaxFrameTimeMs, Summary.Percentile99FrameTimeMs);
+	ImGui::Text("Present latency: %.2f ms  avg %.2f", Last.PresentLatencyMs, Summary.AveragePresentLatencyMs);
+	ImGui::Text("Wrapper: %.2f ms  Game: %.2f ms  (%.1f%% in wrapper)", Last.WrapperTimeMs, Last.GameTimeMs, Summary.WrapperPercent);
+	ImGui::Text("Blits: %u  Locks: %u  Draws: %u  Uploads: %u", Last.Blits, Last.Locks, Last.Draws, Last.Uploads);
+
+	ImGui::PlotLines("##FrameTimes",
+		[](void* data, int idx) -> float { return (*(const FrameRing<FRAMESTATS, FrameTelemetry::HistorySize>*)data)[idx].FrameTimeMs; },
+		(void*)&History, (int)History.GetCount(), 0, nullptr, 0.0f, Summary.MaxFrameTimeMs * 1.1f, ImVec2(0.0f, 80.0f));
+	ImGui::End();
+}
+
 void DebugOverlay::SetTransform(D3DTRANSFORMSTATETYPE dtstTransformStateType, LPD3DMATRIX lpD3DMatrix)
 {
 	switch ((int)dtstTransformStateType)
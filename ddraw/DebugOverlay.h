@@ -1,6 +1,10 @@
 #pragma once
 
 #include "ddraw.h"
+#include "FrameStats.h"
+
+// Enable for testing only
+//#define ENABLE_DEBUGOVERLAY
 
 class DebugOverlay
 {
@@ -41,7 +45,12 @@ private:
 
 	std::vector<LightDebugInfo> LightDebugInfos;
 
+	void DrawFrameTimingPanel();
+
 public:
+	// Frame timing shown in the frame timing panel
+	FrameTelemetry Telemetry;
+
 	// Initialize
 	void Setup(HWND hwnd, LPDIRECT3DDEVICE9 d3d9Device);
 	void Shutdown();
@@ -49,9 +58,47 @@ public:
 	// Frame functions
 	void BeginScene();
 	void EndScene();
+	void EndFrame(LONGLONG PresentStart);
 
 	// Functions
 	void SetTransform(D3DTRANSFORMSTATETYPE dtstTransformStateType, LPD3DMATRIX lpD3DMatrix);
 	void SetLight(DWORD dwLightIndex, LPD3DLIGHT7 lpLight);
 	void LightEnable(DWORD dwLightIndex, BOOL bEnable);
 };
+
+#ifdef ENABLE_DEBUGOVERLAY
+extern DebugOverlay DOverlay;
+
+// Adds the time spent in the outermost wrapped call of the calling thread to the frame telemetry
+class OverlayWrapperTimer
+{
+private:
+	LARGE_INTEGER Start = {};
+
+public:
+	inline static thread_local DWORD Depth = 0;
+
+	OverlayWrapperTimer()
+	{
+		if (Depth++ == 0)
+		{
+			QueryPerformanceCounter(&Start);
+		}
+	}
+	~OverlayWrapperTimer()
+	{
+		if (--Depth == 0)
+		{
+			LARGE_INTEGER End;
+			QueryPerformanceCounter(&End);
+			DOverlay.Telemetry.AddWrapperTime(End.QuadPart - Start.QuadPart);
+		}
+	}
+};
+
+#define OVERLAY_WRAPPER_TIME() OverlayWrapperTimer OverlayTimer
+#define OVERLAY_COUNT(Counter) DOverlay.Telemetry.Count ## Counter()
+#else
+#define OVERLAY_WRAPPER_TIME()
+#define OVERLAY_COUNT(Counter)
+#endif
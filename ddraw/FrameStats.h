@@ -0,0 +1,149 @@
+#pragma once
+
+// Frame timing history used by the debug overlay. Only standard headers may be used here so the
+// statistics can be built and checked without Windows or imgui.
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Fixed size history that overwrites the oldest entry once full
+template <typename T, size_t Size>
+class FrameRing
+{
+private:
+	T Entries[Size] = {};
+	size_t Next = 0;
+	size_t Count = 0;
+
+public:
+	void Push(const T &Entry)
+	{
+		Entries[Next] = Entry;
+		Next = (Next + 1) % Size;
+		Count = std::min<size_t>(Count + 1, Size);
+	}
+
+	void Clear() { Next = 0; Count = 0; }
+	size_t GetCount() const { return Count; }
+	static constexpr size_t GetCapacity() { return Size; }
+
+	// Index 0 is the oldest entry still stored
+	const T &operator[](size_t Index) const { return Entries[(Next + Size - Count + Index) % Size]; }
+};
+
+struct FRAMESTATS
+{
+	float FrameTimeMs = 0.0f;		// Time from the previous present to this one
+	float PresentLatencyMs = 0.0f;	// Time spent inside the d3d9 present call
+	float WrapperTimeMs = 0.0f;		// Time spent inside wrapped calls during the frame
+	float GameTimeMs = 0.0f;		// Rest of the frame, spent in the game itself
+	uint32_t Blits = 0;
+	uint32_t Locks = 0;
+	uint32_t Draws = 0;
+	uint32_t Uploads = 0;			// Texture loads and writable surface unlocks
+};
+
+struct FRAMESUMMARY
+{
+	size_t Frames = 0;
+	float AverageFrameTimeMs = 0.0f;
+	float MinFrameTimeMs = 0.0f;
+	float MaxFrameTimeMs = 0.0f;
+	float Percentile99FrameTimeMs = 0.0f;
+	float AveragePresentLatencyMs = 0.0f;
+	float WrapperPercent = 0.0f;		// Share of the frame time spent inside the wrapper
+};
+
+class FrameTelemetry
+{
+public:
+	static constexpr size_t HistorySize = 240;
+
+private:
+	FrameRing<FRAMESTATS, HistorySize> History;
+
+	int64_t Frequency = 0;
+	int64_t LastPresentEnd = 0;
+
+	// Updated from any thread that calls into the wrapper, read and reset once per frame
+	std::atomic<uint32_t> Blits = 0;
+	std::atomic<uint32_t> Locks = 0;
+	std::atomic<uint32_t> Draws = 0;
+	std::atomic<uint32_t> Uploads = 0;
+	std::atomic<int64_t> WrapperTicks = 0;
+
+	float TicksToMs(int64_t Ticks) const { return Frequency ? static_cast<float>(Ticks * 1000.0 / Frequency) : 0.0f; }
+
+public:
+	void SetFrequency(int64_t TicksPerSecond) { Frequency = TicksPerSecond; }
+
+	void CountBlit() { Blits.fetch_add(1, std::memory_order_relaxed); }
+	void CountLock() { Locks.fetch_add(1, std::memory_order_relaxed); }
+	void CountDraw() { Draws.fetch_add(1, std::memory_order_relaxed); }
+	void CountUpload() { Uploads.fetch_add(1, std::memory_order_relaxed); }
+	void AddWrapperTime(int64_t Ticks) { WrapperTicks.fetch_add(Ticks, std::memory_order_relaxed); }
+
+	// Closes the current frame at the end of a present, the first present only starts the clock
+	void EndFrame(int64_t PresentStart, int64_t PresentEnd)
+	{
+		FRAMESTATS Frame;
+		Frame.Blits = Blits.exchange(0, std::memory_order_relaxed);
+		Frame.Locks = Locks.exchange(0, std::memory_order_relaxed);
+		Frame.Draws = Draws.exchange(0, std::memory_order_relaxed);
+		Frame.Uploads = Uploads.exchange(0, std::memory_order_relaxed);
+		const int64_t Wrapper = WrapperTicks.exchange(0, std::memory_order_relaxed);
+
+		if (LastPresentEnd)
+		{
+			const int64_t FrameTicks = PresentEnd - LastPresentEnd;
+			Frame.FrameTimeMs = TicksToMs(FrameTicks);
+			Frame.PresentLatencyMs = TicksToMs(PresentEnd - PresentStart);
+			Frame.WrapperTimeMs = TicksToMs(std::max<int64_t>(0, std::min<int64_t>(Wrapper, FrameTicks)));
+			Frame.GameTimeMs = Frame.FrameTimeMs - Frame.WrapperTimeMs;
+			History.Push(Frame);
+		}
+		LastPresentEnd = PresentEnd;
+	}
+
+	void Reset()
+	{
+		History.Clear();
+		LastPresentEnd = 0;
+	}
+
+	const FrameRing<FRAMESTATS, HistorySize> &GetHistory() const { return History; }
+
+	FRAMESUMMARY GetSummary() const
+	{
+		FRAMESUMMARY Summary;
+		Summary.Frames = History.GetCount();
+		if (!Summary.Frames)
+		{
+			return Summary;
+		}
+
+		float FrameTimes[HistorySize];
+		double TotalFrameTime = 0.0, TotalLatency = 0.0, TotalWrapper = 0.0;
+		for (size_t x = 0; x < Summary.Frames; x++)
+		{
+			const FRAMESTATS &Frame = History[x];
+			FrameTimes[x] = Frame.FrameTimeMs;
+			TotalFrameTime += Frame.FrameTimeMs;
+			TotalLatency += Frame.PresentLatencyMs;
+			TotalWrapper += Frame.WrapperTimeMs;
+		}
+
+		Summary.AverageFrameTimeMs = static_cast<float>(TotalFrameTime / Summary.Frames);
+		Summary.AveragePresentLatencyMs = static_cast<float>(TotalLatency / Summary.Frames);
+		Summary.WrapperPercent = TotalFrameTime > 0.0 ? static_cast<float>(TotalWrapper * 100.0 / TotalFrameTime) : 0.0f;
+
+		const size_t Percentile99 = (Summary.Frames * 99 - 1) / 100;
+		std::nth_element(FrameTimes, FrameTimes + Percentile99, FrameTimes + Summary.Frames);
+		Summary.Percentile99FrameTimeMs = FrameTimes[Percentile99];
+		Summary.MinFrameTimeMs = *std::min_element(FrameTimes, FrameTimes + Summary.Frames);
+		Summary.MaxFrameTimeMs = *std::max_element(FrameTimes, FrameTimes + Summary.Frames);
+		return Summary;
+	}
+};
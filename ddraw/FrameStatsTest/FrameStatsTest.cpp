@@ -0,0 +1,260 @@
+/**
+* Copyright (C) 2022 Elisha Riedlinger
+*
+* This software is  provided 'as-is', without any express  or implied  warranty. In no event will the
+* authors be held liable for any damages arising from the use of this software.
+* Permission  is granted  to anyone  to use  this software  for  any  purpose,  including  commercial
+* applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*   1. The origin of this software must not be misrepresented; you must not claim that you  wrote the
+*      original  software. If you use this  software  in a product, an  acknowledgment in the product
+*      documentation would be appreciated but is not required.
+*   2. Altered source versions must  be plainly  marked as such, and  must not be  misrepresented  as
+*      being the original software.
+*   3. This notice may not be removed or altered from any source distribution.
+*
+* Tests for the frame history and summary in FrameStats.h that the debug overlay shows. Counters are
+* bumped from several threads while frames are closed, so the per-frame counts must add up to the total.
+* Standalone, builds on Windows and Linux:
+*   g++ -std=c++17 -O2 -pthread -o framestatstest FrameStatsTest.cpp
+*   cl /std:c++17 /EHsc /O2 FrameStatsTest.cpp
+*
+* Usage: framestatstest
+*/
+
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <thread>
+#include <vector>
+#include "../FrameStats.h"
+
+static int Failures = 0;
+
+static void Check(bool Condition, const char *Expr, int Line)
+{
+	if (!Condition)
+	{
+		printf("FAILED line %d: %s\n", Line, Expr);
+		Failures++;
+	}
+}
+
+#define CHECK(Expr) Check(Expr, #Expr, __LINE__)
+
+static bool Near(float Value, float Expected)
+{
+	return std::fabs(Value - Expected) < 0.001f;
+}
+
+// 1 tick is 1 ms, so tick counts read as milliseconds below. A present ending at tick 0 would look like
+// the clock was never started, which a real QueryPerformanceCounter value never is.
+static const int64_t Frequency = 1000;
+
+static void TestRing()
+{
+	FrameRing<int, 4> Ring;
+	CHECK(Ring.GetCount() == 0);
+	CHECK(Ring.GetCapacity() == 4);
+
+	Ring.Push(1);
+	Ring.Push(2);
+	Ring.Push(3);
+	CHECK(Ring.GetCount() == 3);
+	CHECK(Ring[0] == 1 && Ring[2] == 3);
+
+	// Once full the oldest entry is overwritten and index 0 moves with it
+	Ring.Push(4);
+	Ring.Push(5);
+	Ring.Push(6);
+	CHECK(Ring.GetCount() == 4);
+	CHECK(Ring[0] == 3 && Ring[1] == 4 && Ring[2] == 5 && Ring[3] == 6);
+
+	Ring.Clear();
+	CHECK(Ring.GetCount() == 0);
+	Ring.Push(7);
+	CHECK(Ring.GetCount() == 1 && Ring[0] == 7);
+}
+
+static void TestEndFrame()
+{
+	FrameTelemetry Telemetry;
+	Telemetry.SetFrequency(Frequency);
+
+	// The first present only starts the clock, its counters are dropped with it
+	Telemetry.CountBlit();
+	Telemetry.EndFrame(90, 100);
+	CHECK(Telemetry.GetHistory().GetCount() == 0);
+
+	Telemetry.CountBlit();
+	Telemetry.CountBlit();
+	Telemetry.CountLock();
+	Telemetry.CountDraw();
+	Telemetry.CountUpload();
+	Telemetry.CountUpload();
+	Telemetry.CountUpload();
+	Telemetry.AddWrapperTime(4);
+	Telemetry.EndFrame(112, 116);
+	CHECK(Telemetry.GetHistory().GetCount() == 1);
+
+	const FRAMESTATS &Frame = Telemetry.GetHistory()[0];
+	CHECK(Near(Frame.FrameTimeMs, 16.0f));
+	CHECK(Near(Frame.PresentLatencyMs, 4.0f));
+	CHECK(Near(Frame.WrapperTimeMs, 4.0f));
+	CHECK(Near(Frame.GameTimeMs, 12.0f));
+	CHECK(Frame.Blits == 2 && Frame.Locks == 1 && Frame.Draws == 1 && Frame.Uploads == 3);
+
+	// Counters start again from zero for the next frame
+	Telemetry.EndFrame(130, 132);
+	const FRAMESTATS &Next = Telemetry.GetHistory()[1];
+	CHECK(Next.Blits == 0 && Next.Locks == 0 && Next.Draws == 0 && Next.Uploads == 0);
+	CHECK(Near(Next.WrapperTimeMs, 0.0f));
+}
+
+static void TestWrapperTimeClamp()
+{
+	FrameTelemetry Telemetry;
+	Telemetry.SetFrequency(Frequency);
+	Telemetry.EndFrame(0, 100);
+
+	// Time counted on several threads can add up to more than the frame
+	Telemetry.AddWrapperTime(50);
+	Telemetry.EndFrame(105, 110);
+	CHECK(Near(Telemetry.GetHistory()[0].WrapperTimeMs, 10.0f));
+	CHECK(Near(Telemetry.GetHistory()[0].GameTimeMs, 0.0f));
+
+	// DebugOverlay::EndFrame takes the present itself back out, which can go below zero
+	Telemetry.AddWrapperTime(-5);
+	Telemetry.EndFrame(115, 120);
+	CHECK(Near(Telemetry.GetHistory()[1].WrapperTimeMs, 0.0f));
+	CHECK(Near(Telemetry.GetHistory()[1].GameTimeMs, 10.0f));
+}
+
+static void TestNoFrequency()
+{
+	FrameTelemetry Telemetry;
+	Telemetry.EndFrame(0, 100);
+	Telemetry.EndFrame(110, 116);
+	CHECK(Telemetry.GetHistory().GetCount() == 1);
+	CHECK(Near(Telemetry.GetHistory()[0].FrameTimeMs, 0.0f));
+	CHECK(Telemetry.GetSummary().WrapperPercent == 0.0f);
+}
+
+static void TestSummary()
+{
+	FrameTelemetry Telemetry;
+	Telemetry.SetFrequency(Frequency);
+	CHECK(Telemetry.GetSummary().Frames == 0);
+
+	// 99 frames of 10 ms and one of 100 ms, with 2 ms of present and 5 ms of wrapper time each
+	int64_t Time = 1000;
+	Telemetry.EndFrame(Time - 2, Time);
+	for (int x = 0; x < 100; x++)
+	{
+		Time += (x == 50) ? 100 : 10;
+		Telemetry.AddWrapperTime(5);
+		Telemetry.EndFrame(Time - 2, Time);
+	}
+
+	const FRAMESUMMARY Summary = Telemetry.GetSummary();
+	CHECK(Summary.Frames == 100);
+	CHECK(Near(Summary.AverageFrameTimeMs, 10.9f));
+	CHECK(Near(Summary.MinFrameTimeMs, 10.0f));
+	CHECK(Near(Summary.MaxFrameTimeMs, 100.0f));
+	CHECK(Near(Summary.Percentile99FrameTimeMs, 10.0f));
+	CHECK(Near(Summary.AveragePresentLatencyMs, 2.0f));
+	CHECK(Near(Summary.WrapperPercent, 500.0f / 1090.0f * 100.0f));
+
+	// A second slow frame moves the 99th percentile onto it
+	Time += 100;
+	Telemetry.EndFrame(Time - 2, Time);
+	CHECK(Near(Telemetry.GetSummary().Percentile99FrameTimeMs, 100.0f));
+
+	Telemetry.Reset();
+	CHECK(Telemetry.GetSummary().Frames == 0);
+	Telemetry.EndFrame(Time + 8, Time + 10);
+	CHECK(Telemetry.GetHistory().GetCount() == 0);
+}
+
+static void TestHistoryWraps()
+{
+	FrameTelemetry Telemetry;
+	Telemetry.SetFrequency(Frequency);
+	int64_t Time = 1000;
+	Telemetry.EndFrame(Time, Time);
+	for (size_t x = 0; x < FrameTelemetry::HistorySize + 10; x++)
+	{
+		Time += 1 + x;
+		Telemetry.EndFrame(Time, Time);
+	}
+
+	// Only the newest frames are kept, the oldest kept one is the 11th frame
+	const auto &History = Telemetry.GetHistory();
+	CHECK(History.GetCount() == FrameTelemetry::HistorySize);
+	CHECK(Near(History[0].FrameTimeMs, 11.0f));
+	CHECK(Near(History[History.GetCount() - 1].FrameTimeMs, static_cast<float>(FrameTelemetry::HistorySize + 10)));
+	CHECK(Near(Telemetry.GetSummary().MinFrameTimeMs, 11.0f));
+}
+
+static void TestConcurrentCounters()
+{
+	FrameTelemetry Telemetry;
+	Telemetry.SetFrequency(Frequency);
+	Telemetry.EndFrame(1000, 1000);
+
+	const int Threads = 4;
+	const int CountsPerThread = 100000;
+	std::atomic<int> Running(Threads);
+	std::vector<std::thread> Workers;
+	for (int t = 0; t < Threads; t++)
+	{
+		Workers.emplace_back([&]()
+		{
+			for (int x = 0; x < CountsPerThread; x++)
+			{
+				Telemetry.CountBlit();
+				Telemetry.CountUpload();
+			}
+			Running--;
+		});
+	}
+
+	// Frames are closed while the counters are being bumped, no count may be lost or counted twice
+	int64_t Time = 1000;
+	uint64_t Blits = 0, Uploads = 0;
+	bool Done = false;
+	while (!Done)
+	{
+		Done = (Running == 0);
+		Time += 16;
+		Telemetry.EndFrame(Time, Time);
+		const auto &History = Telemetry.GetHistory();
+		Blits += History[History.GetCount() - 1].Blits;
+		Uploads += History[History.GetCount() - 1].Uploads;
+	}
+	for (auto &Worker : Workers)
+	{
+		Worker.join();
+	}
+
+	CHECK(Blits == static_cast<uint64_t>(Threads) * CountsPerThread);
+	CHECK(Uploads == static_cast<uint64_t>(Threads) * CountsPerThread);
+}
+
+int main()
+{
+	TestRing();
+	TestEndFrame();
+	TestWrapperTimeClamp();
+	TestNoFrequency();
+	TestSummary();
+	TestHistoryWraps();
+	TestConcurrentCounters();
+	if (Failures)
+	{
+		printf("%d check(s) failed\n", Failures);
+		return 1;
+	}
+	printf("All tests passed\n");
+	return 0;
+}
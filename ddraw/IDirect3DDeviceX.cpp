@@ -16,12 +16,12 @@
 
 #include "ddraw.h"
 #include <d3dhal.h>
-
-// Enable for testing only
-//#define ENABLE_DEBUGOVERLAY
+#include "Logging\CallStats.h"
+#include "Logging\ChromeTrace.h"
+#include "DebugOverlay.h"
+#include "Capture.h"
 
 #ifdef ENABLE_DEBUGOVERLAY
-#include "DebugOverlay.h"
 DebugOverlay DOverlay;
 #endif
 
@@ -32,7 +32,7 @@ extern DWORD ScaleDDPadY;
 
 HRESULT m_IDirect3DDeviceX::QueryInterface(REFIID riid, LPVOID FAR * ppvObj, DWORD DirectXVersion)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ") " << riid;
+	LOG_DBG << __FUNCTION__ << " (" << this << ") " << riid;
 
 	if (!ppvObj)
 	{
@@ -90,7 +90,7 @@ void *m_IDirect3DDeviceX::GetWrapperInterfaceX(DWORD DirectXVersion)
 
 ULONG m_IDirect3DDeviceX::AddRef(DWORD DirectXVersion)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ") v" << DirectXVersion;
+	LOG_DBG << __FUNCTION__ << " (" << this << ") v" << DirectXVersion;
 
 	if (Config.Dd7to9)
 	{
@@ -115,7 +115,7 @@ ULONG m_IDirect3DDeviceX::AddRef(DWORD DirectXVersion)
 
 ULONG m_IDirect3DDeviceX::Release(DWORD DirectXVersion)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ") v" << DirectXVersion;
+	LOG_DBG << __FUNCTION__ << " (" << this << ") v" << DirectXVersion;
 
 	ULONG ref;
 
@@ -161,7 +161,8 @@ ULONG m_IDirect3DDeviceX::Release(DWORD DirectXVersion)
 
 HRESULT m_IDirect3DDeviceX::Initialize(LPDIRECT3D lpd3d, LPGUID lpGUID, LPD3DDEVICEDESC lpd3ddvdesc)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (ProxyDirectXVersion != 1)
 	{
@@ -178,7 +179,8 @@ HRESULT m_IDirect3DDeviceX::Initialize(LPDIRECT3D lpd3d, LPGUID lpGUID, LPD3DDEV
 
 HRESULT m_IDirect3DDeviceX::CreateExecuteBuffer(LPD3DEXECUTEBUFFERDESC lpDesc, LPDIRECT3DEXECUTEBUFFER * lplpDirect3DExecuteBuffer, IUnknown * pUnkOuter)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (ProxyDirectXVersion != 1)
 	{
@@ -198,7 +200,8 @@ HRESULT m_IDirect3DDeviceX::CreateExecuteBuffer(LPD3DEXECUTEBUFFERDESC lpDesc, L
 
 HRESULT m_IDirect3DDeviceX::Execute(LPDIRECT3DEXECUTEBUFFER lpDirect3DExecuteBuffer, LPDIRECT3DVIEWPORT lpDirect3DViewport, DWORD dwFlags)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (ProxyDirectXVersion != 1)
 	{
@@ -220,7 +223,8 @@ HRESULT m_IDirect3DDeviceX::Execute(LPDIRECT3DEXECUTEBUFFER lpDirect3DExecuteBuf
 
 HRESULT m_IDirect3DDeviceX::Pick(LPDIRECT3DEXECUTEBUFFER lpDirect3DExecuteBuffer, LPDIRECT3DVIEWPORT lpDirect3DViewport, DWORD dwFlags, LPD3DRECT lpRect)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (ProxyDirectXVersion != 1)
 	{
@@ -242,7 +246,8 @@ HRESULT m_IDirect3DDeviceX::Pick(LPDIRECT3DEXECUTEBUFFER lpDirect3DExecuteBuffer
 
 HRESULT m_IDirect3DDeviceX::GetPickRecords(LPDWORD lpCount, LPD3DPICKRECORD lpD3DPickRec)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (ProxyDirectXVersion != 1)
 	{
@@ -255,7 +260,8 @@ HRESULT m_IDirect3DDeviceX::GetPickRecords(LPDWORD lpCount, LPD3DPICKRECORD lpD3
 
 HRESULT m_IDirect3DDeviceX::CreateMatrix(LPD3DMATRIXHANDLE lpD3DMatHandle)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (ProxyDirectXVersion != 1)
 	{
@@ -268,7 +274,8 @@ HRESULT m_IDirect3DDeviceX::CreateMatrix(LPD3DMATRIXHANDLE lpD3DMatHandle)
 
 HRESULT m_IDirect3DDeviceX::SetMatrix(D3DMATRIXHANDLE d3dMatHandle, const LPD3DMATRIX lpD3DMatrix)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (ProxyDirectXVersion != 1)
 	{
@@ -281,7 +288,8 @@ HRESULT m_IDirect3DDeviceX::SetMatrix(D3DMATRIXHANDLE d3dMatHandle, const LPD3DM
 
 HRESULT m_IDirect3DDeviceX::GetMatrix(D3DMATRIXHANDLE lpD3DMatHandle, LPD3DMATRIX lpD3DMatrix)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (ProxyDirectXVersion != 1)
 	{
@@ -294,7 +302,8 @@ HRESULT m_IDirect3DDeviceX::GetMatrix(D3DMATRIXHANDLE lpD3DMatHandle, LPD3DMATRI
 
 HRESULT m_IDirect3DDeviceX::DeleteMatrix(D3DMATRIXHANDLE d3dMatHandle)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (ProxyDirectXVersion != 1)
 	{
@@ -307,7 +316,9 @@ HRESULT m_IDirect3DDeviceX::DeleteMatrix(D3DMATRIXHANDLE d3dMatHandle)
 
 HRESULT m_IDirect3DDeviceX::SetTransform(D3DTRANSFORMSTATETYPE dtstTransformStateType, LPD3DMATRIX lpD3DMatrix)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
+	OVERLAY_WRAPPER_TIME();
 
 	if (Config.Dd7to9)
 	{
@@ -366,7 +377,8 @@ HRESULT m_IDirect3DDeviceX::SetTransform(D3DTRANSFORMSTATETYPE dtstTransformStat
 
 HRESULT m_IDirect3DDeviceX::GetTransform(D3DTRANSFORMSTATETYPE dtstTransformStateType, LPD3DMATRIX lpD3DMatrix)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -416,7 +428,8 @@ HRESULT m_IDirect3DDeviceX::GetTransform(D3DTRANSFORMSTATETYPE dtstTransformStat
 
 HRESULT m_IDirect3DDeviceX::PreLoad(LPDIRECTDRAWSURFACE7 lpddsTexture)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -435,7 +448,10 @@ HRESULT m_IDirect3DDeviceX::PreLoad(LPDIRECTDRAWSURFACE7 lpddsTexture)
 
 HRESULT m_IDirect3DDeviceX::Load(LPDIRECTDRAWSURFACE7 lpDestTex, LPPOINT lpDestPoint, LPDIRECTDRAWSURFACE7 lpSrcTex, LPRECT lprcSrcRect, DWORD dwFlags)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
+	OVERLAY_WRAPPER_TIME();
+	OVERLAY_COUNT(Upload);
 
 	if (Config.Dd7to9)
 	{
@@ -517,7 +533,8 @@ HRESULT m_IDirect3DDeviceX::Load(LPDIRECTDRAWSURFACE7 lpDestTex, LPPOINT lpDestP
 
 HRESULT m_IDirect3DDeviceX::SwapTextureHandles(LPDIRECT3DTEXTURE2 lpD3DTex1, LPDIRECT3DTEXTURE2 lpD3DTex2)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (ProxyDirectXVersion > 2)
 	{
@@ -547,7 +564,8 @@ HRESULT m_IDirect3DDeviceX::SwapTextureHandles(LPDIRECT3DTEXTURE2 lpD3DTex1, LPD
 
 HRESULT m_IDirect3DDeviceX::EnumTextureFormats(LPD3DENUMTEXTUREFORMATSCALLBACK lpd3dEnumTextureProc, LPVOID lpArg)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	switch (ProxyDirectXVersion)
 	{
@@ -594,7 +612,8 @@ HRESULT m_IDirect3DDeviceX::EnumTextureFormats(LPD3DENUMTEXTUREFORMATSCALLBACK l
 
 HRESULT m_IDirect3DDeviceX::EnumTextureFormats(LPD3DENUMPIXELFORMATSCALLBACK lpd3dEnumPixelProc, LPVOID lpArg)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -655,7 +674,7 @@ HRESULT m_IDirect3DDeviceX::EnumTextureFormats(LPD3DENUMPIXELFORMATSCALLBACK lpd
 			}
 			else
 			{
-				Logging::LogDebug() << __FUNCTION__ << " " << format << " " << (DDERR)hr;
+				LOG_DBG << __FUNCTION__ << " " << format << " " << (DDERR)hr;
 			}
 		}
 
@@ -677,7 +696,8 @@ HRESULT m_IDirect3DDeviceX::EnumTextureFormats(LPD3DENUMPIXELFORMATSCALLBACK lpd
 
 HRESULT m_IDirect3DDeviceX::GetTexture(DWORD dwStage, LPDIRECT3DTEXTURE2* lplpTexture)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (ProxyDirectXVersion > 3)
 	{
@@ -738,7 +758,8 @@ HRESULT m_IDirect3DDeviceX::GetTexture(DWORD dwStage, LPDIRECT3DTEXTURE2* lplpTe
 
 HRESULT m_IDirect3DDeviceX::GetTexture(DWORD dwStage, LPDIRECTDRAWSURFACE7* lplpTexture)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -782,7 +803,9 @@ HRESULT m_IDirect3DDeviceX::GetTexture(DWORD dwStage, LPDIRECTDRAWSURFACE7* lplp
 
 HRESULT m_IDirect3DDeviceX::SetTexture(DWORD dwStage, LPDIRECT3DTEXTURE2 lpTexture)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
+	OVERLAY_WRAPPER_TIME();
 
 	if (ProxyDirectXVersion > 3)
 	{
@@ -821,7 +844,9 @@ HRESULT m_IDirect3DDeviceX::SetTexture(DWORD dwStage, LPDIRECT3DTEXTURE2 lpTextu
 
 HRESULT m_IDirect3DDeviceX::SetTexture(DWORD dwStage, LPDIRECTDRAWSURFACE7 lpSurface)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
+	OVERLAY_WRAPPER_TIME();
 
 	if (Config.Dd7to9)
 	{
@@ -835,6 +860,8 @@ HRESULT m_IDirect3DDeviceX::SetTexture(DWORD dwStage, LPDIRECTDRAWSURFACE7 lpSur
 
 		if (!lpSurface)
 		{
+			CAPTURE_CALL(SetTexture, dwStage, nullptr, nullptr);
+
 			hr = (*d3d9Device)->SetTexture(dwStage, nullptr);
 		}
 		else
@@ -849,6 +876,8 @@ HRESULT m_IDirect3DDeviceX::SetTexture(DWORD dwStage, LPDIRECTDRAWSURFACE7 lpSur
 				return DDERR_GENERIC;
 			}
 
+			CAPTURE_CALL(SetTexture, dwStage, lpDDSrcSurfaceX, &lpDDSrcSurfaceX->GetCurrentSurfaceDesc());
+
 			IDirect3DTexture9* pTexture9 = lpDDSrcSurfaceX->Get3DTexture();
 
 			if (!pTexture9)
@@ -878,7 +907,8 @@ HRESULT m_IDirect3DDeviceX::SetTexture(DWORD dwStage, LPDIRECTDRAWSURFACE7 lpSur
 
 HRESULT m_IDirect3DDeviceX::SetRenderTarget(LPDIRECTDRAWSURFACE7 lpNewRenderTarget, DWORD dwFlags)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -936,7 +966,8 @@ HRESULT m_IDirect3DDeviceX::SetRenderTarget(LPDIRECTDRAWSURFACE7 lpNewRenderTarg
 
 HRESULT m_IDirect3DDeviceX::GetRenderTarget(LPDIRECTDRAWSURFACE7 * lplpRenderTarget, DWORD DirectXVersion)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -969,7 +1000,8 @@ HRESULT m_IDirect3DDeviceX::GetRenderTarget(LPDIRECTDRAWSURFACE7 * lplpRenderTar
 
 HRESULT m_IDirect3DDeviceX::GetTextureStageState(DWORD dwStage, D3DTEXTURESTAGESTATETYPE dwState, LPDWORD lpdwValue)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -1048,7 +1080,8 @@ HRESULT m_IDirect3DDeviceX::GetTextureStageState(DWORD dwStage, D3DTEXTURESTAGES
 
 HRESULT m_IDirect3DDeviceX::SetTextureStageState(DWORD dwStage, D3DTEXTURESTAGESTATETYPE dwState, DWORD dwValue)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -1115,7 +1148,8 @@ HRESULT m_IDirect3DDeviceX::SetTextureStageState(DWORD dwStage, D3DTEXTURESTAGES
 
 HRESULT m_IDirect3DDeviceX::GetCaps(LPD3DDEVICEDESC lpD3DHWDevDesc, LPD3DDEVICEDESC lpD3DHELDevDesc)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	switch (ProxyDirectXVersion)
 	{
@@ -1161,7 +1195,8 @@ HRESULT m_IDirect3DDeviceX::GetCaps(LPD3DDEVICEDESC lpD3DHWDevDesc, LPD3DDEVICED
 
 HRESULT m_IDirect3DDeviceX::GetCaps(LPD3DDEVICEDESC7 lpD3DDevDesc)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -1193,7 +1228,8 @@ HRESULT m_IDirect3DDeviceX::GetCaps(LPD3DDEVICEDESC7 lpD3DDevDesc)
 
 HRESULT m_IDirect3DDeviceX::GetStats(LPD3DSTATS lpD3DStats)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	switch (ProxyDirectXVersion)
 	{
@@ -1211,7 +1247,8 @@ HRESULT m_IDirect3DDeviceX::GetStats(LPD3DSTATS lpD3DStats)
 
 HRESULT m_IDirect3DDeviceX::AddViewport(LPDIRECT3DVIEWPORT3 lpDirect3DViewport)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9 || ProxyDirectXVersion == 7)
 	{
@@ -1259,7 +1296,8 @@ HRESULT m_IDirect3DDeviceX::AddViewport(LPDIRECT3DVIEWPORT3 lpDirect3DViewport)
 
 HRESULT m_IDirect3DDeviceX::DeleteViewport(LPDIRECT3DVIEWPORT3 lpDirect3DViewport)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (ProxyDirectXVersion > 3)
 	{
@@ -1287,7 +1325,8 @@ HRESULT m_IDirect3DDeviceX::DeleteViewport(LPDIRECT3DVIEWPORT3 lpDirect3DViewpor
 
 HRESULT m_IDirect3DDeviceX::NextViewport(LPDIRECT3DVIEWPORT3 lpDirect3DViewport, LPDIRECT3DVIEWPORT3* lplpDirect3DViewport, DWORD dwFlags, DWORD DirectXVersion)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (ProxyDirectXVersion > 3)
 	{
@@ -1325,7 +1364,8 @@ HRESULT m_IDirect3DDeviceX::NextViewport(LPDIRECT3DVIEWPORT3 lpDirect3DViewport,
 
 HRESULT m_IDirect3DDeviceX::SetCurrentViewport(LPDIRECT3DVIEWPORT3 lpd3dViewport)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9 || ProxyDirectXVersion == 7)
 	{
@@ -1355,7 +1395,8 @@ HRESULT m_IDirect3DDeviceX::SetCurrentViewport(LPDIRECT3DVIEWPORT3 lpd3dViewport
 
 HRESULT m_IDirect3DDeviceX::GetCurrentViewport(LPDIRECT3DVIEWPORT3* lplpd3dViewport, DWORD DirectXVersion)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9 || ProxyDirectXVersion == 7)
 	{
@@ -1398,7 +1439,8 @@ HRESULT m_IDirect3DDeviceX::GetCurrentViewport(LPDIRECT3DVIEWPORT3* lplpd3dViewp
 
 HRESULT m_IDirect3DDeviceX::SetViewport(LPD3DVIEWPORT7 lpViewport)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -1432,7 +1474,8 @@ HRESULT m_IDirect3DDeviceX::SetViewport(LPD3DVIEWPORT7 lpViewport)
 
 HRESULT m_IDirect3DDeviceX::GetViewport(LPD3DVIEWPORT7 lpViewport)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -1455,7 +1498,8 @@ HRESULT m_IDirect3DDeviceX::GetViewport(LPD3DVIEWPORT7 lpViewport)
 
 HRESULT m_IDirect3DDeviceX::Begin(D3DPRIMITIVETYPE d3dpt, DWORD d3dvt, DWORD dwFlags)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (ProxyDirectXVersion > 3)
 	{
@@ -1477,7 +1521,8 @@ HRESULT m_IDirect3DDeviceX::Begin(D3DPRIMITIVETYPE d3dpt, DWORD d3dvt, DWORD dwF
 
 HRESULT m_IDirect3DDeviceX::BeginIndexed(D3DPRIMITIVETYPE dptPrimitiveType, DWORD dvtVertexType, LPVOID lpvVertices, DWORD dwNumVertices, DWORD dwFlags)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (ProxyDirectXVersion > 3)
 	{
@@ -1499,7 +1544,8 @@ HRESULT m_IDirect3DDeviceX::BeginIndexed(D3DPRIMITIVETYPE dptPrimitiveType, DWOR
 
 HRESULT m_IDirect3DDeviceX::Vertex(LPVOID lpVertexType)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (ProxyDirectXVersion > 3)
 	{
@@ -1521,7 +1567,8 @@ HRESULT m_IDirect3DDeviceX::Vertex(LPVOID lpVertexType)
 
 HRESULT m_IDirect3DDeviceX::Index(WORD wVertexIndex)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (ProxyDirectXVersion > 3)
 	{
@@ -1543,7 +1590,8 @@ HRESULT m_IDirect3DDeviceX::Index(WORD wVertexIndex)
 
 HRESULT m_IDirect3DDeviceX::End(DWORD dwFlags)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (ProxyDirectXVersion > 3)
 	{
@@ -1565,7 +1613,10 @@ HRESULT m_IDirect3DDeviceX::End(DWORD dwFlags)
 
 HRESULT m_IDirect3DDeviceX::BeginScene()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
+	OVERLAY_WRAPPER_TIME();
+	LOG_CHROMETRACE();
 
 	if (Config.Dd7to9)
 	{
@@ -1606,7 +1657,10 @@ HRESULT m_IDirect3DDeviceX::BeginScene()
 
 HRESULT m_IDirect3DDeviceX::EndScene()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
+	OVERLAY_WRAPPER_TIME();
+	LOG_CHROMETRACE();
 
 	if (Config.Dd7to9)
 	{
@@ -1625,7 +1679,19 @@ HRESULT m_IDirect3DDeviceX::EndScene()
 
 		(*d3d9Device)->EndScene();
 
-		return (*d3d9Device)->Present(nullptr, nullptr, nullptr, nullptr);
+#ifdef ENABLE_DEBUGOVERLAY
+		LARGE_INTEGER PresentStart;
+		QueryPerformanceCounter(&PresentStart);
+#endif
+
+		HRESULT hr = (*d3d9Device)->Present(nullptr, nullptr, nullptr, nullptr);
+
+#ifdef ENABLE_DEBUGOVERLAY
+		DOverlay.EndFrame(PresentStart.QuadPart);
+#endif
+		CAPTURE_CALL(EndFrame);
+
+		return hr;
 	}
 
 	switch (ProxyDirectXVersion)
@@ -1645,7 +1711,8 @@ HRESULT m_IDirect3DDeviceX::EndScene()
 
 HRESULT m_IDirect3DDeviceX::Clear(DWORD dwCount, LPD3DRECT lpRects, DWORD dwFlags, D3DCOLOR dwColor, D3DVALUE dvZ, DWORD dwStencil)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -1663,7 +1730,8 @@ HRESULT m_IDirect3DDeviceX::Clear(DWORD dwCount, LPD3DRECT lpRects, DWORD dwFlag
 
 HRESULT m_IDirect3DDeviceX::GetDirect3D(LPDIRECT3D7 * lplpD3D, DWORD DirectXVersion)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -1700,7 +1768,8 @@ HRESULT m_IDirect3DDeviceX::GetDirect3D(LPDIRECT3D7 * lplpD3D, DWORD DirectXVers
 
 HRESULT m_IDirect3DDeviceX::GetLightState(D3DLIGHTSTATETYPE dwLightStateType, LPDWORD lpdwLightState)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (ProxyDirectXVersion > 3)
 	{
@@ -1758,7 +1827,8 @@ HRESULT m_IDirect3DDeviceX::GetLightState(D3DLIGHTSTATETYPE dwLightStateType, LP
 
 HRESULT m_IDirect3DDeviceX::SetLightState(D3DLIGHTSTATETYPE dwLightStateType, DWORD dwLightState)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (ProxyDirectXVersion > 3)
 	{
@@ -1816,7 +1886,8 @@ HRESULT m_IDirect3DDeviceX::SetLightState(D3DLIGHTSTATETYPE dwLightStateType, DW
 
 HRESULT m_IDirect3DDeviceX::SetLight(DWORD dwLightIndex, LPD3DLIGHT7 lpLight)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -1860,7 +1931,8 @@ HRESULT m_IDirect3DDeviceX::SetLight(DWORD dwLightIndex, LPD3DLIGHT7 lpLight)
 
 HRESULT m_IDirect3DDeviceX::GetLight(DWORD dwLightIndex, LPD3DLIGHT7 lpLight)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -1883,7 +1955,8 @@ HRESULT m_IDirect3DDeviceX::GetLight(DWORD dwLightIndex, LPD3DLIGHT7 lpLight)
 
 HRESULT m_IDirect3DDeviceX::LightEnable(DWORD dwLightIndex, BOOL bEnable)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -1910,7 +1983,8 @@ HRESULT m_IDirect3DDeviceX::LightEnable(DWORD dwLightIndex, BOOL bEnable)
 
 HRESULT m_IDirect3DDeviceX::GetLightEnable(DWORD dwLightIndex, BOOL* pbEnable)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -1933,7 +2007,8 @@ HRESULT m_IDirect3DDeviceX::GetLightEnable(DWORD dwLightIndex, BOOL* pbEnable)
 
 HRESULT m_IDirect3DDeviceX::MultiplyTransform(D3DTRANSFORMSTATETYPE dtstTransformStateType, LPD3DMATRIX lpD3DMatrix)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -1978,7 +2053,8 @@ HRESULT m_IDirect3DDeviceX::MultiplyTransform(D3DTRANSFORMSTATETYPE dtstTransfor
 
 HRESULT m_IDirect3DDeviceX::SetMaterial(LPD3DMATERIAL7 lpMaterial)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2001,7 +2077,8 @@ HRESULT m_IDirect3DDeviceX::SetMaterial(LPD3DMATERIAL7 lpMaterial)
 
 HRESULT m_IDirect3DDeviceX::GetMaterial(LPD3DMATERIAL7 lpMaterial)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2024,7 +2101,9 @@ HRESULT m_IDirect3DDeviceX::GetMaterial(LPD3DMATERIAL7 lpMaterial)
 
 HRESULT m_IDirect3DDeviceX::SetRenderState(D3DRENDERSTATETYPE dwRenderStateType, DWORD dwRenderState)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
+	OVERLAY_WRAPPER_TIME();
 
 	if (Config.Dd7to9)
 	{
@@ -2034,6 +2113,8 @@ HRESULT m_IDirect3DDeviceX::SetRenderState(D3DRENDERSTATETYPE dwRenderStateType,
 			return DDERR_GENERIC;
 		}
 
+		CAPTURE_CALL(SetRenderState, dwRenderStateType, dwRenderState);
+
 		switch ((DWORD)dwRenderStateType)
 		{
 		case D3DRENDERSTATE_ANTIALIAS:
@@ -2096,7 +2177,8 @@ HRESULT m_IDirect3DDeviceX::SetRenderState(D3DRENDERSTATETYPE dwRenderStateType,
 
 HRESULT m_IDirect3DDeviceX::GetRenderState(D3DRENDERSTATETYPE dwRenderStateType, LPDWORD lpdwRenderState)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2178,7 +2260,8 @@ HRESULT m_IDirect3DDeviceX::GetRenderState(D3DRENDERSTATETYPE dwRenderStateType,
 
 HRESULT m_IDirect3DDeviceX::BeginStateBlock()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2196,7 +2279,8 @@ HRESULT m_IDirect3DDeviceX::BeginStateBlock()
 
 HRESULT m_IDirect3DDeviceX::EndStateBlock(LPDWORD lpdwBlockHandle)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2220,7 +2304,11 @@ HRESULT m_IDirect3DDeviceX::EndStateBlock(LPDWORD lpdwBlockHandle)
 
 HRESULT m_IDirect3DDeviceX::DrawPrimitive(D3DPRIMITIVETYPE dptPrimitiveType, DWORD dwVertexTypeDesc, LPVOID lpVertices, DWORD dwVertexCount, DWORD dwFlags, DWORD DirectXVersion)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
+	OVERLAY_WRAPPER_TIME();
+	OVERLAY_COUNT(Draw);
+	LOG_CHROMETRACE();
 
 	if (Config.Dd7to9)
 	{
@@ -2241,6 +2329,8 @@ HRESULT m_IDirect3DDeviceX::DrawPrimitive(D3DPRIMITIVETYPE dptPrimitiveType, DWO
 		DWORD rsClipping = 0, rsLighting = 0, rsExtents = 0;
 		SetDrawFlags(rsClipping, rsLighting, rsExtents, dwVertexTypeDesc, dwFlags, DirectXVersion);
 
+		CAPTURE_CALL(Draw, dptPrimitiveType, dwVertexTypeDesc, lpVertices, dwVertexCount, GetVertexStride(dwVertexTypeDesc), nullptr, 0);
+
 		HRESULT hr;
 		if (D3DFVF_LVERTEX == dwVertexTypeDesc)
 		{
@@ -2318,10 +2408,16 @@ HRESULT m_IDirect3DDeviceX::DrawPrimitive(D3DPRIMITIVETYPE dptPrimitiveType, DWO
 
 HRESULT m_IDirect3DDeviceX::DrawPrimitiveStrided(D3DPRIMITIVETYPE dptPrimitiveType, DWORD dwVertexTypeDesc, LPD3DDRAWPRIMITIVESTRIDEDDATA lpVertexArray, DWORD dwVertexCount, DWORD dwFlags, DWORD DirectXVersion)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
+	OVERLAY_WRAPPER_TIME();
+	OVERLAY_COUNT(Draw);
+	LOG_CHROMETRACE();
 
 	if (Config.Dd7to9)
 	{
+		CAPTURE_CALL(DrawStrided, dptPrimitiveType, dwVertexTypeDesc, dwVertexCount, nullptr, 0);
+
 		LOG_LIMIT(100, __FUNCTION__ << " Not Implemented");
 		return DDERR_UNSUPPORTED;
 	}
@@ -2357,10 +2453,16 @@ HRESULT m_IDirect3DDeviceX::DrawPrimitiveStrided(D3DPRIMITIVETYPE dptPrimitiveTy
 
 HRESULT m_IDirect3DDeviceX::DrawPrimitiveVB(D3DPRIMITIVETYPE d3dptPrimitiveType, LPDIRECT3DVERTEXBUFFER7 lpd3dVertexBuffer, DWORD dwStartVertex, DWORD dwNumVertices, DWORD dwFlags, DWORD DirectXVersion)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
+	OVERLAY_WRAPPER_TIME();
+	OVERLAY_COUNT(Draw);
+	LOG_CHROMETRACE();
 
 	if (Config.Dd7to9)
 	{
+		CAPTURE_CALL(DrawVB, d3dptPrimitiveType, lpd3dVertexBuffer, dwNumVertices, nullptr, 0);
+
 		LOG_LIMIT(100, __FUNCTION__ << " Not Implemented");
 		return DDERR_UNSUPPORTED;
 	}
@@ -2407,7 +2509,11 @@ HRESULT m_IDirect3DDeviceX::DrawPrimitiveVB(D3DPRIMITIVETYPE d3dptPrimitiveType,
 
 HRESULT m_IDirect3DDeviceX::DrawIndexedPrimitive(D3DPRIMITIVETYPE dptPrimitiveType, DWORD dwVertexTypeDesc, LPVOID lpVertices, DWORD dwVertexCount, LPWORD lpIndices, DWORD dwIndexCount, DWORD dwFlags, DWORD DirectXVersion)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
+	OVERLAY_WRAPPER_TIME();
+	OVERLAY_COUNT(Draw);
+	LOG_CHROMETRACE();
 
 	if (Config.Dd7to9)
 	{
@@ -2428,6 +2534,8 @@ HRESULT m_IDirect3DDeviceX::DrawIndexedPrimitive(D3DPRIMITIVETYPE dptPrimitiveTy
 		DWORD rsClipping = 0, rsLighting = 0, rsExtents = 0;
 		SetDrawFlags(rsClipping, rsLighting, rsExtents, dwVertexTypeDesc, dwFlags, DirectXVersion);
 
+		CAPTURE_CALL(Draw, dptPrimitiveType, dwVertexTypeDesc, lpVertices, dwVertexCount, GetVertexStride(dwVertexTypeDesc), lpIndices, dwIndexCount);
+
 		HRESULT hr;
 		if (D3DFVF_LVERTEX == dwVertexTypeDesc)
 		{
@@ -2505,10 +2613,16 @@ HRESULT m_IDirect3DDeviceX::DrawIndexedPrimitive(D3DPRIMITIVETYPE dptPrimitiveTy
 
 HRESULT m_IDirect3DDeviceX::DrawIndexedPrimitiveStrided(D3DPRIMITIVETYPE d3dptPrimitiveType, DWORD dwVertexTypeDesc, LPD3DDRAWPRIMITIVESTRIDEDDATA lpVertexArray, DWORD dwVertexCount, LPWORD lpwIndices, DWORD dwIndexCount, DWORD dwFlags, DWORD DirectXVersion)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
+	OVERLAY_WRAPPER_TIME();
+	OVERLAY_COUNT(Draw);
+	LOG_CHROMETRACE();
 
 	if (Config.Dd7to9)
 	{
+		CAPTURE_CALL(DrawStrided, d3dptPrimitiveType, dwVertexTypeDesc, dwVertexCount, lpwIndices, dwIndexCount);
+
 		LOG_LIMIT(100, __FUNCTION__ << " Not Implemented");
 		return DDERR_UNSUPPORTED;
 	}
@@ -2544,10 +2658,16 @@ HRESULT m_IDirect3DDeviceX::DrawIndexedPrimitiveStrided(D3DPRIMITIVETYPE d3dptPr
 
 HRESULT m_IDirect3DDeviceX::DrawIndexedPrimitiveVB(D3DPRIMITIVETYPE d3dptPrimitiveType, LPDIRECT3DVERTEXBUFFER7 lpd3dVertexBuffer, DWORD dwStartVertex, DWORD dwNumVertices, LPWORD lpwIndices, DWORD dwIndexCount, DWORD dwFlags, DWORD DirectXVersion)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
+	OVERLAY_WRAPPER_TIME();
+	OVERLAY_COUNT(Draw);
+	LOG_CHROMETRACE();
 
 	if (Config.Dd7to9)
 	{
+		CAPTURE_CALL(DrawVB, d3dptPrimitiveType, lpd3dVertexBuffer, dwNumVertices, lpwIndices, dwIndexCount);
+
 		LOG_LIMIT(100, __FUNCTION__ << " Not Implemented");
 		return DDERR_UNSUPPORTED;
 	}
@@ -2594,7 +2714,8 @@ HRESULT m_IDirect3DDeviceX::DrawIndexedPrimitiveVB(D3DPRIMITIVETYPE d3dptPrimiti
 
 HRESULT m_IDirect3DDeviceX::ComputeSphereVisibility(LPD3DVECTOR lpCenters, LPD3DVALUE lpRadii, DWORD dwNumSpheres, DWORD dwFlags, LPDWORD lpdwReturnValues)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2617,7 +2738,8 @@ HRESULT m_IDirect3DDeviceX::ComputeSphereVisibility(LPD3DVECTOR lpCenters, LPD3D
 
 HRESULT m_IDirect3DDeviceX::ValidateDevice(LPDWORD lpdwPasses)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2647,7 +2769,8 @@ HRESULT m_IDirect3DDeviceX::ValidateDevice(LPDWORD lpdwPasses)
 
 HRESULT m_IDirect3DDeviceX::ApplyStateBlock(DWORD dwBlockHandle)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2665,7 +2788,8 @@ HRESULT m_IDirect3DDeviceX::ApplyStateBlock(DWORD dwBlockHandle)
 
 HRESULT m_IDirect3DDeviceX::CaptureStateBlock(DWORD dwBlockHandle)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2683,7 +2807,8 @@ HRESULT m_IDirect3DDeviceX::CaptureStateBlock(DWORD dwBlockHandle)
 
 HRESULT m_IDirect3DDeviceX::DeleteStateBlock(DWORD dwBlockHandle)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2703,7 +2828,8 @@ HRESULT m_IDirect3DDeviceX::DeleteStateBlock(DWORD dwBlockHandle)
 
 HRESULT m_IDirect3DDeviceX::CreateStateBlock(D3DSTATEBLOCKTYPE d3dsbtype, LPDWORD lpdwBlockHandle)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2727,7 +2853,8 @@ HRESULT m_IDirect3DDeviceX::CreateStateBlock(D3DSTATEBLOCKTYPE d3dsbtype, LPDWOR
 
 HRESULT m_IDirect3DDeviceX::SetClipStatus(LPD3DCLIPSTATUS lpD3DClipStatus)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2751,7 +2878,8 @@ HRESULT m_IDirect3DDeviceX::SetClipStatus(LPD3DCLIPSTATUS lpD3DClipStatus)
 
 HRESULT m_IDirect3DDeviceX::GetClipStatus(LPD3DCLIPSTATUS lpD3DClipStatus)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2775,7 +2903,8 @@ HRESULT m_IDirect3DDeviceX::GetClipStatus(LPD3DCLIPSTATUS lpD3DClipStatus)
 
 HRESULT m_IDirect3DDeviceX::SetClipPlane(DWORD dwIndex, D3DVALUE* pPlaneEquation)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2793,7 +2922,8 @@ HRESULT m_IDirect3DDeviceX::SetClipPlane(DWORD dwIndex, D3DVALUE* pPlaneEquation
 
 HRESULT m_IDirect3DDeviceX::GetClipPlane(DWORD dwIndex, D3DVALUE* pPlaneEquation)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2816,7 +2946,8 @@ HRESULT m_IDirect3DDeviceX::GetClipPlane(DWORD dwIndex, D3DVALUE* pPlaneEquation
 
 HRESULT m_IDirect3DDeviceX::GetInfo(DWORD dwDevInfoID, LPVOID pDevInfoStruct, DWORD dwSize)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
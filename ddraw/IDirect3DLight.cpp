@@ -18,7 +18,7 @@
 
 HRESULT m_IDirect3DLight::QueryInterface(REFIID riid, LPVOID FAR * ppvObj)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ") " << riid;
+	LOG_DBG << __FUNCTION__ << " (" << this << ") " << riid;
 
 	if (!ppvObj)
 	{
@@ -50,7 +50,7 @@ HRESULT m_IDirect3DLight::QueryInterface(REFIID riid, LPVOID FAR * ppvObj)
 
 ULONG m_IDirect3DLight::AddRef()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	if (!ProxyInterface)
 	{
@@ -62,7 +62,7 @@ ULONG m_IDirect3DLight::AddRef()
 
 ULONG m_IDirect3DLight::Release()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	LONG ref;
 
@@ -85,7 +85,7 @@ ULONG m_IDirect3DLight::Release()
 
 HRESULT m_IDirect3DLight::Initialize(LPDIRECT3D lpDirect3D)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	if (!ProxyInterface)
 	{
@@ -103,7 +103,7 @@ HRESULT m_IDirect3DLight::Initialize(LPDIRECT3D lpDirect3D)
 
 HRESULT m_IDirect3DLight::SetLight(LPD3DLIGHT lpLight)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	if (!ProxyInterface)
 	{
@@ -116,7 +116,7 @@ HRESULT m_IDirect3DLight::SetLight(LPD3DLIGHT lpLight)
 
 HRESULT m_IDirect3DLight::GetLight(LPD3DLIGHT lpLight)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	if (!ProxyInterface)
 	{
@@ -93,4 +93,5 @@ public:
 	void *GetWrapperInterfaceX(DWORD DirectXVersion);
 	ULONG AddRef(DWORD DirectXVersion);
 	ULONG Release(DWORD DirectXVersion);
+	inline DWORD GetFVF() { return VBDesc.dwFVF; }
 };
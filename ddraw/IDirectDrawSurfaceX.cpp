@@ -23,6 +23,11 @@
 #include "d3d9ShaderPalette.h"
 #include "d3dx9.h"
 #include "Utils\Utils.h"
+#include "Logging\CallStats.h"
+#include "Logging\ChromeTrace.h"
+#include "DebugOverlay.h"
+#include "Capture.h"
+#include "Settings\LiveConfig.h"
 
 extern float ScaleDDWidthRatio;
 extern float ScaleDDHeightRatio;
@@ -47,7 +52,7 @@ std::vector<EMUSURFACE*> memorySurfaces;
 
 HRESULT m_IDirectDrawSurfaceX::QueryInterface(REFIID riid, LPVOID FAR * ppvObj, DWORD DirectXVersion)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ") " << riid;
+	LOG_DBG << __FUNCTION__ << " (" << this << ") " << riid;
 
 	if (!ppvObj)
 	{
@@ -196,7 +201,7 @@ void *m_IDirectDrawSurfaceX::GetWrapperInterfaceX(DWORD DirectXVersion)
 
 ULONG m_IDirectDrawSurfaceX::AddRef(DWORD DirectXVersion)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ") v" << DirectXVersion;
+	LOG_DBG << __FUNCTION__ << " (" << this << ") v" << DirectXVersion;
 
 	if (Config.Dd7to9)
 	{
@@ -223,7 +228,7 @@ ULONG m_IDirectDrawSurfaceX::AddRef(DWORD DirectXVersion)
 
 ULONG m_IDirectDrawSurfaceX::Release(DWORD DirectXVersion)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ") v" << DirectXVersion;
+	LOG_DBG << __FUNCTION__ << " (" << this << ") v" << DirectXVersion;
 
 	ULONG ref;
 
@@ -284,7 +289,8 @@ ULONG m_IDirectDrawSurfaceX::Release(DWORD DirectXVersion)
 
 HRESULT m_IDirectDrawSurfaceX::AddAttachedSurface(LPDIRECTDRAWSURFACE7 lpDDSurface)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -348,7 +354,8 @@ HRESULT m_IDirectDrawSurfaceX::AddAttachedSurface(LPDIRECTDRAWSURFACE7 lpDDSurfa
 
 HRESULT m_IDirectDrawSurfaceX::AddOverlayDirtyRect(LPRECT lpRect)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -361,7 +368,11 @@ HRESULT m_IDirectDrawSurfaceX::AddOverlayDirtyRect(LPRECT lpRect)
 
 HRESULT m_IDirectDrawSurfaceX::Blt(LPRECT lpDestRect, LPDIRECTDRAWSURFACE7 lpDDSrcSurface, LPRECT lpSrcRect, DWORD dwFlags, LPDDBLTFX lpDDBltFx, bool isSkipScene)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
+	OVERLAY_WRAPPER_TIME();
+	OVERLAY_COUNT(Blit);
+	LOG_CHROMETRACE();
 
 	// Check if source Surface exists
 	if (lpDDSrcSurface && !CheckSurfaceExists(lpDDSrcSurface))
@@ -441,6 +452,17 @@ HRESULT m_IDirectDrawSurfaceX::Blt(LPRECT lpDestRect, LPDIRECTDRAWSURFACE7 lpDDS
 
 		IsInBlt = true;
 
+		// Record the blit before it is split into color fills and copies
+		if (DdrawCapture::IsCapturing)
+		{
+			m_IDirectDrawSurfaceX* lpCaptureSrcX = (m_IDirectDrawSurfaceX*)lpDDSrcSurface;
+			if (lpCaptureSrcX)
+			{
+				lpCaptureSrcX->QueryInterface(IID_GetInterfaceX, (LPVOID*)&lpCaptureSrcX);
+			}
+			DdrawCapture::Blt(this, surfaceDesc2, lpDestRect, lpCaptureSrcX, lpCaptureSrcX ? &lpCaptureSrcX->surfaceDesc2 : nullptr, lpSrcRect, dwFlags, lpDDBltFx);
+		}
+
 		HRESULT hr = DD_OK;
 
 		do {
@@ -615,7 +637,8 @@ HRESULT m_IDirectDrawSurfaceX::BltBatch(LPDDBLTBATCH lpDDBltBatch, DWORD dwCount
 {
 	UNREFERENCED_PARAMETER(dwFlags);
 
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!lpDDBltBatch)
 	{
@@ -638,7 +661,10 @@ HRESULT m_IDirectDrawSurfaceX::BltBatch(LPDDBLTBATCH lpDDBltBatch, DWORD dwCount
 
 HRESULT m_IDirectDrawSurfaceX::BltFast(DWORD dwX, DWORD dwY, LPDIRECTDRAWSURFACE7 lpDDSrcSurface, LPRECT lpSrcRect, DWORD dwFlags)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
+	OVERLAY_WRAPPER_TIME();
+	LOG_CHROMETRACE();
 
 	// Check if source Surface exists
 	if (lpDDSrcSurface && !CheckSurfaceExists(lpDDSrcSurface))
@@ -757,7 +783,8 @@ HRESULT m_IDirectDrawSurfaceX::BltFast(DWORD dwX, DWORD dwY, LPDIRECTDRAWSURFACE
 
 HRESULT m_IDirectDrawSurfaceX::DeleteAttachedSurface(DWORD dwFlags, LPDIRECTDRAWSURFACE7 lpDDSAttachedSurface)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -800,7 +827,8 @@ HRESULT m_IDirectDrawSurfaceX::DeleteAttachedSurface(DWORD dwFlags, LPDIRECTDRAW
 
 HRESULT m_IDirectDrawSurfaceX::EnumAttachedSurfaces(LPVOID lpContext, LPDDENUMSURFACESCALLBACK lpEnumSurfacesCallback, DWORD DirectXVersion)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!lpEnumSurfacesCallback)
 	{
@@ -839,7 +867,8 @@ HRESULT m_IDirectDrawSurfaceX::EnumAttachedSurfaces(LPVOID lpContext, LPDDENUMSU
 
 HRESULT m_IDirectDrawSurfaceX::EnumAttachedSurfaces2(LPVOID lpContext, LPDDENUMSURFACESCALLBACK7 lpEnumSurfacesCallback7, DWORD DirectXVersion)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!lpEnumSurfacesCallback7)
 	{
@@ -901,7 +930,8 @@ HRESULT m_IDirectDrawSurfaceX::EnumAttachedSurfaces2(LPVOID lpContext, LPDDENUMS
 
 HRESULT m_IDirectDrawSurfaceX::EnumOverlayZOrders(DWORD dwFlags, LPVOID lpContext, LPDDENUMSURFACESCALLBACK lpfnCallback, DWORD DirectXVersion)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!lpfnCallback)
 	{
@@ -940,7 +970,8 @@ HRESULT m_IDirectDrawSurfaceX::EnumOverlayZOrders(DWORD dwFlags, LPVOID lpContex
 
 HRESULT m_IDirectDrawSurfaceX::EnumOverlayZOrders2(DWORD dwFlags, LPVOID lpContext, LPDDENUMSURFACESCALLBACK7 lpfnCallback7, DWORD DirectXVersion)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!lpfnCallback7)
 	{
@@ -1043,7 +1074,10 @@ HRESULT m_IDirectDrawSurfaceX::FlipBackBuffer()
 
 HRESULT m_IDirectDrawSurfaceX::Flip(LPDIRECTDRAWSURFACE7 lpDDSurfaceTargetOverride, DWORD dwFlags, DWORD DirectXVersion)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
+	OVERLAY_WRAPPER_TIME();
+	LOG_CHROMETRACE();
 
 	if (Config.Dd7to9)
 	{
@@ -1089,6 +1123,8 @@ HRESULT m_IDirectDrawSurfaceX::Flip(LPDIRECTDRAWSURFACE7 lpDDSurfaceTargetOverri
 		// Set flip flag
 		IsInFlip = true;
 
+		CAPTURE_CALL(Flip, this, surfaceDesc2, dwFlags);
+
 		HRESULT hr = DD_OK;
 
 		do {
@@ -1202,7 +1238,8 @@ HRESULT m_IDirectDrawSurfaceX::Flip(LPDIRECTDRAWSURFACE7 lpDDSurfaceTargetOverri
 
 HRESULT m_IDirectDrawSurfaceX::GetAttachedSurface(LPDDSCAPS lpDDSCaps, LPDIRECTDRAWSURFACE7 FAR * lplpDDAttachedSurface, DWORD DirectXVersion)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	// Game using old DirectX, Convert DDSCAPS to DDSCAPS2
 	if (ProxyDirectXVersion > 3)
@@ -1230,7 +1267,8 @@ HRESULT m_IDirectDrawSurfaceX::GetAttachedSurface(LPDDSCAPS lpDDSCaps, LPDIRECTD
 
 HRESULT m_IDirectDrawSurfaceX::GetAttachedSurface2(LPDDSCAPS2 lpDDSCaps2, LPDIRECTDRAWSURFACE7 FAR * lplpDDAttachedSurface, DWORD DirectXVersion)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -1320,7 +1358,8 @@ HRESULT m_IDirectDrawSurfaceX::GetAttachedSurface2(LPDDSCAPS2 lpDDSCaps2, LPDIRE
 
 HRESULT m_IDirectDrawSurfaceX::GetBltStatus(DWORD dwFlags)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -1351,7 +1390,8 @@ HRESULT m_IDirectDrawSurfaceX::GetBltStatus(DWORD dwFlags)
 
 HRESULT m_IDirectDrawSurfaceX::GetCaps(LPDDSCAPS lpDDSCaps)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	// Game using old DirectX, Convert DDSCAPS to DDSCAPS2
 	if (ProxyDirectXVersion > 3)
@@ -1379,7 +1419,8 @@ HRESULT m_IDirectDrawSurfaceX::GetCaps(LPDDSCAPS lpDDSCaps)
 
 HRESULT m_IDirectDrawSurfaceX::GetCaps2(LPDDSCAPS2 lpDDSCaps2)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -1398,7 +1439,8 @@ HRESULT m_IDirectDrawSurfaceX::GetCaps2(LPDDSCAPS2 lpDDSCaps2)
 
 HRESULT m_IDirectDrawSurfaceX::GetClipper(LPDIRECTDRAWCLIPPER FAR * lplpDDClipper)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -1436,7 +1478,8 @@ HRESULT m_IDirectDrawSurfaceX::GetClipper(LPDIRECTDRAWCLIPPER FAR * lplpDDClippe
 
 HRESULT m_IDirectDrawSurfaceX::GetColorKey(DWORD dwFlags, LPDDCOLORKEY lpDDColorKey)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -1498,7 +1541,10 @@ HRESULT m_IDirectDrawSurfaceX::GetColorKey(DWORD dwFlags, LPDDCOLORKEY lpDDColor
 
 HRESULT m_IDirectDrawSurfaceX::GetDC(HDC FAR * lphDC)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
+	OVERLAY_WRAPPER_TIME();
+	LOG_CHROMETRACE();
 
 	if (Config.Dd7to9)
 	{
@@ -1601,7 +1647,8 @@ HRESULT m_IDirectDrawSurfaceX::GetDC(HDC FAR * lphDC)
 
 HRESULT m_IDirectDrawSurfaceX::GetFlipStatus(DWORD dwFlags)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -1644,7 +1691,8 @@ HRESULT m_IDirectDrawSurfaceX::GetFlipStatus(DWORD dwFlags)
 
 HRESULT m_IDirectDrawSurfaceX::GetOverlayPosition(LPLONG lplX, LPLONG lplY)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -1667,7 +1715,8 @@ HRESULT m_IDirectDrawSurfaceX::GetOverlayPosition(LPLONG lplX, LPLONG lplY)
 
 HRESULT m_IDirectDrawSurfaceX::GetPalette(LPDIRECTDRAWPALETTE FAR * lplpDDPalette)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -1705,7 +1754,8 @@ HRESULT m_IDirectDrawSurfaceX::GetPalette(LPDIRECTDRAWPALETTE FAR * lplpDDPalett
 
 HRESULT m_IDirectDrawSurfaceX::GetPixelFormat(LPDDPIXELFORMAT lpDDPixelFormat)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -1729,7 +1779,8 @@ HRESULT m_IDirectDrawSurfaceX::GetPixelFormat(LPDDPIXELFORMAT lpDDPixelFormat)
 
 HRESULT m_IDirectDrawSurfaceX::GetSurfaceDesc(LPDDSURFACEDESC lpDDSurfaceDesc)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	// Game using old DirectX, Convert to LPDDSURFACEDESC2
 	if (ProxyDirectXVersion > 3)
@@ -1759,7 +1810,8 @@ HRESULT m_IDirectDrawSurfaceX::GetSurfaceDesc(LPDDSURFACEDESC lpDDSurfaceDesc)
 
 HRESULT m_IDirectDrawSurfaceX::GetSurfaceDesc2(LPDDSURFACEDESC2 lpDDSurfaceDesc2)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -1797,7 +1849,8 @@ HRESULT m_IDirectDrawSurfaceX::GetSurfaceDesc2(LPDDSURFACEDESC2 lpDDSurfaceDesc2
 
 HRESULT m_IDirectDrawSurfaceX::Initialize(LPDIRECTDRAW lpDD, LPDDSURFACEDESC lpDDSurfaceDesc)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (ProxyDirectXVersion > 3)
 	{
@@ -1826,7 +1879,8 @@ HRESULT m_IDirectDrawSurfaceX::Initialize(LPDIRECTDRAW lpDD, LPDDSURFACEDESC lpD
 
 HRESULT m_IDirectDrawSurfaceX::Initialize2(LPDIRECTDRAW lpDD, LPDDSURFACEDESC2 lpDDSurfaceDesc2)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -1844,7 +1898,8 @@ HRESULT m_IDirectDrawSurfaceX::Initialize2(LPDIRECTDRAW lpDD, LPDDSURFACEDESC2 l
 
 HRESULT m_IDirectDrawSurfaceX::IsLost()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -1875,7 +1930,10 @@ HRESULT m_IDirectDrawSurfaceX::IsLost()
 
 HRESULT m_IDirectDrawSurfaceX::Lock(LPRECT lpDestRect, LPDDSURFACEDESC lpDDSurfaceDesc, DWORD dwFlags, HANDLE hEvent, DWORD DirectXVersion)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
+	OVERLAY_WRAPPER_TIME();
+	LOG_CHROMETRACE();
 
 	// Game using old DirectX, Convert to LPDDSURFACEDESC2
 	if (ProxyDirectXVersion > 3)
@@ -1913,7 +1971,11 @@ HRESULT m_IDirectDrawSurfaceX::Lock(LPRECT lpDestRect, LPDDSURFACEDESC lpDDSurfa
 
 HRESULT m_IDirectDrawSurfaceX::Lock2(LPRECT lpDestRect, LPDDSURFACEDESC2 lpDDSurfaceDesc2, DWORD dwFlags, HANDLE hEvent, DWORD DirectXVersion)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
+	OVERLAY_WRAPPER_TIME();
+	OVERLAY_COUNT(Lock);
+	LOG_CHROMETRACE();
 
 	if (Config.Dd7to9)
 	{
@@ -2070,8 +2132,10 @@ HRESULT m_IDirectDrawSurfaceX::Lock2(LPRECT lpDestRect, LPDDSURFACEDESC2 lpDDSur
 		LastLock.LockedRect.pBits = LockedRect.pBits;
 		LastLock.LockedRect.Pitch = LockedRect.Pitch;
 
+		CAPTURE_CALL(Lock, this, surfaceDesc2, lpDestRect, dwFlags);
+
 		// Restore scanlines before returing surface memory
-		if (Config.DdrawRemoveScanlines)
+		if (LIVE_CONFIG(DdrawRemoveScanlines))
 		{
 			RestoreScanlines(LastLock);
 		}
@@ -2117,7 +2181,10 @@ inline HRESULT m_IDirectDrawSurfaceX::LockD39Surface(D3DLOCKED_RECT* pLockedRect
 
 HRESULT m_IDirectDrawSurfaceX::ReleaseDC(HDC hDC)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
+	OVERLAY_WRAPPER_TIME();
+	LOG_CHROMETRACE();
 
 	if (Config.Dd7to9)
 	{
@@ -2185,7 +2252,8 @@ HRESULT m_IDirectDrawSurfaceX::ReleaseDC(HDC hDC)
 
 HRESULT m_IDirectDrawSurfaceX::Restore()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2221,7 +2289,8 @@ HRESULT m_IDirectDrawSurfaceX::Restore()
 
 HRESULT m_IDirectDrawSurfaceX::SetClipper(LPDIRECTDRAWCLIPPER lpDDClipper)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2277,7 +2346,8 @@ HRESULT m_IDirectDrawSurfaceX::SetClipper(LPDIRECTDRAWCLIPPER lpDDClipper)
 
 HRESULT m_IDirectDrawSurfaceX::SetColorKey(DWORD dwFlags, LPDDCOLORKEY lpDDColorKey)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2357,7 +2427,8 @@ HRESULT m_IDirectDrawSurfaceX::SetColorKey(DWORD dwFlags, LPDDCOLORKEY lpDDColor
 
 HRESULT m_IDirectDrawSurfaceX::SetOverlayPosition(LONG lX, LONG lY)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2375,7 +2446,8 @@ HRESULT m_IDirectDrawSurfaceX::SetOverlayPosition(LONG lX, LONG lY)
 
 HRESULT m_IDirectDrawSurfaceX::SetPalette(LPDIRECTDRAWPALETTE lpDDPalette)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2444,7 +2516,10 @@ HRESULT m_IDirectDrawSurfaceX::SetPalette(LPDIRECTDRAWPALETTE lpDDPalette)
 
 HRESULT m_IDirectDrawSurfaceX::Unlock(LPRECT lpRect)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
+	OVERLAY_WRAPPER_TIME();
+	LOG_CHROMETRACE();
 
 	// Fix issue with some games that ignore the pitch size
 	if (EmuLock.Locked && EmuLock.Addr)
@@ -2503,8 +2578,10 @@ HRESULT m_IDirectDrawSurfaceX::Unlock(LPRECT lpRect)
 			return c_hr;
 		}
 
+		CAPTURE_CALL(Unlock, this, surfaceDesc2, LastLock.Rect, LastLock.LockedRect.pBits, LastLock.LockedRect.Pitch, LastLock.ReadOnly || ISDXTEX(surfaceFormat));
+
 		// Remove scanlines before unlocking surface
-		if (Config.DdrawRemoveScanlines)
+		if (LIVE_CONFIG(DdrawRemoveScanlines))
 		{
 			RemoveScanlines(LastLock);
 		}
@@ -2516,6 +2593,7 @@ HRESULT m_IDirectDrawSurfaceX::Unlock(LPRECT lpRect)
 			{
 				// Copy emulated surface to real texture
 				CopyFromEmulatedSurface(&LastLock.Rect);
+				OVERLAY_COUNT(Upload);
 
 				// Blt surface directly to GDI
 				if (Config.DdrawWriteToGDI && (IsPrimarySurface() || IsBackBuffer()))
@@ -2535,6 +2613,10 @@ HRESULT m_IDirectDrawSurfaceX::Unlock(LPRECT lpRect)
 					(hr == D3DERR_WASSTILLDRAWING) ? DDERR_WASSTILLDRAWING :
 					DDERR_SURFACELOST;
 			}
+			if (!LastLock.ReadOnly)
+			{
+				OVERLAY_COUNT(Upload);
+			}
 		}
 		else
 		{
@@ -2581,7 +2663,8 @@ inline HRESULT m_IDirectDrawSurfaceX::UnlockD39Surface()
 
 HRESULT m_IDirectDrawSurfaceX::UpdateOverlay(LPRECT lpSrcRect, LPDIRECTDRAWSURFACE7 lpDDDestSurface, LPRECT lpDestRect, DWORD dwFlags, LPDDOVERLAYFX lpDDOverlayFx)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2605,7 +2688,8 @@ HRESULT m_IDirectDrawSurfaceX::UpdateOverlay(LPRECT lpSrcRect, LPDIRECTDRAWSURFA
 
 HRESULT m_IDirectDrawSurfaceX::UpdateOverlayDisplay(DWORD dwFlags)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2618,7 +2702,8 @@ HRESULT m_IDirectDrawSurfaceX::UpdateOverlayDisplay(DWORD dwFlags)
 
 HRESULT m_IDirectDrawSurfaceX::UpdateOverlayZOrder(DWORD dwFlags, LPDIRECTDRAWSURFACE7 lpDDSReference)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2640,7 +2725,8 @@ HRESULT m_IDirectDrawSurfaceX::UpdateOverlayZOrder(DWORD dwFlags, LPDIRECTDRAWSU
 
 HRESULT m_IDirectDrawSurfaceX::GetDDInterface(LPVOID FAR * lplpDD, DWORD DirectXVersion)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2690,7 +2776,8 @@ HRESULT m_IDirectDrawSurfaceX::GetDDInterface(LPVOID FAR * lplpDD, DWORD DirectX
 
 HRESULT m_IDirectDrawSurfaceX::PageLock(DWORD dwFlags)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2704,7 +2791,8 @@ HRESULT m_IDirectDrawSurfaceX::PageLock(DWORD dwFlags)
 
 HRESULT m_IDirectDrawSurfaceX::PageUnlock(DWORD dwFlags)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2722,7 +2810,8 @@ HRESULT m_IDirectDrawSurfaceX::PageUnlock(DWORD dwFlags)
 
 HRESULT m_IDirectDrawSurfaceX::SetSurfaceDesc(LPDDSURFACEDESC lpDDSurfaceDesc, DWORD dwFlags)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	// Game using old DirectX, Convert to LPDDSURFACEDESC2
 	if (ProxyDirectXVersion > 3)
@@ -2751,7 +2840,8 @@ HRESULT m_IDirectDrawSurfaceX::SetSurfaceDesc(LPDDSURFACEDESC lpDDSurfaceDesc, D
 
 HRESULT m_IDirectDrawSurfaceX::SetSurfaceDesc2(LPDDSURFACEDESC2 lpDDSurfaceDesc2, DWORD dwFlags)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2794,7 +2884,8 @@ HRESULT m_IDirectDrawSurfaceX::SetSurfaceDesc2(LPDDSURFACEDESC2 lpDDSurfaceDesc2
 
 HRESULT m_IDirectDrawSurfaceX::SetPrivateData(REFGUID guidTag, LPVOID lpData, DWORD cbSize, DWORD dwFlags)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2825,7 +2916,8 @@ HRESULT m_IDirectDrawSurfaceX::SetPrivateData(REFGUID guidTag, LPVOID lpData, DW
 
 HRESULT m_IDirectDrawSurfaceX::GetPrivateData(REFGUID guidTag, LPVOID lpBuffer, LPDWORD lpcbBufferSize)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2856,7 +2948,8 @@ HRESULT m_IDirectDrawSurfaceX::GetPrivateData(REFGUID guidTag, LPVOID lpBuffer,
 
 HRESULT m_IDirectDrawSurfaceX::FreePrivateData(REFGUID guidTag)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2887,7 +2980,8 @@ HRESULT m_IDirectDrawSurfaceX::FreePrivateData(REFGUID guidTag)
 
 HRESULT m_IDirectDrawSurfaceX::GetUniquenessValue(LPDWORD lpValue)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2913,7 +3007,8 @@ HRESULT m_IDirectDrawSurfaceX::GetUniquenessValue(LPDWORD lpValue)
 
 HRESULT m_IDirectDrawSurfaceX::ChangeUniquenessValue()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2931,7 +3026,8 @@ HRESULT m_IDirectDrawSurfaceX::ChangeUniquenessValue()
 
 HRESULT m_IDirectDrawSurfaceX::SetPriority(DWORD dwPriority)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2951,7 +3047,8 @@ HRESULT m_IDirectDrawSurfaceX::SetPriority(DWORD dwPriority)
 
 HRESULT m_IDirectDrawSurfaceX::GetPriority(LPDWORD lpdwPriority)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2976,7 +3073,8 @@ HRESULT m_IDirectDrawSurfaceX::GetPriority(LPDWORD lpdwPriority)
 
 HRESULT m_IDirectDrawSurfaceX::SetLOD(DWORD dwMaxLOD)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -2996,7 +3094,8 @@ HRESULT m_IDirectDrawSurfaceX::SetLOD(DWORD dwMaxLOD)
 
 HRESULT m_IDirectDrawSurfaceX::GetLOD(LPDWORD lpdwMaxLOD)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.Dd7to9)
 	{
@@ -3242,7 +3341,7 @@ HRESULT m_IDirectDrawSurfaceX::CreateD3d9Surface()
 	const DWORD Width = GetByteAlignedWidth(surfaceDesc2.dwWidth, surfaceBitCount);
 	const DWORD Height = surfaceDesc2.dwHeight;
 
-	Logging::LogDebug() << __FUNCTION__ " (" << this << ") D3d9 Surface. Size: " << Width << "x" << Height << " Format: " << surfaceFormat << " dwCaps: " << Logging::hex(surfaceDesc2.ddsCaps.dwCaps);
+	LOG_DBG << __FUNCTION__ " (" << this << ") D3d9 Surface. Size: " << Width << "x" << Height << " Format: " << surfaceFormat << " dwCaps: " << Logging::hex(surfaceDesc2.ddsCaps.dwCaps);
 
 	HRESULT hr = DD_OK;
 
@@ -3445,7 +3544,7 @@ HRESULT m_IDirectDrawSurfaceX::CreateD3d9Surface()
 		ypad = (DisplayBufferHeight - BackBufferHeight) / 2;
 	}
 
-	Logging::LogDebug() << __FUNCTION__ << " D3d9 Vertex size: " << BackBufferWidth << "x" << BackBufferHeight <<
+	LOG_DBG << __FUNCTION__ << " D3d9 Vertex size: " << BackBufferWidth << "x" << BackBufferHeight <<
 		" pad: " << xpad << "x" << ypad;
 
 	// Set vertex points
@@ -3585,7 +3684,7 @@ HRESULT m_IDirectDrawSurfaceX::CreateDCSurface()
 		}
 	}
 
-	Logging::LogDebug() << __FUNCTION__ " (" << this << ") creating emulated surface. Size: " << Width << "x" << Height << " Format: " << surfaceFormat << " dwCaps: " << Logging::hex(surfaceDesc2.ddsCaps.dwCaps);
+	LOG_DBG << __FUNCTION__ " (" << this << ") creating emulated surface. Size: " << Width << "x" << Height << " Format: " << surfaceFormat << " dwCaps: " << Logging::hex(surfaceDesc2.ddsCaps.dwCaps);
 
 	// Create new emulated surface structure
 	emu = new EMUSURFACE;
@@ -3739,7 +3838,7 @@ void m_IDirectDrawSurfaceX::ReleaseD9Surface(bool BackupData)
 			D3DLOCKED_RECT LockRect = {};
 			if (SUCCEEDED(LockD39Surface(&LockRect, nullptr, 0)))
 			{
-				Logging::LogDebug() << __FUNCTION__ << " Storing Direct3D9 texture surface data";
+				LOG_DBG << __FUNCTION__ << " Storing Direct3D9 texture surface data";
 
 				size_t size = surfaceDesc2.dwHeight * LockRect.Pitch;
 
@@ -3774,7 +3873,7 @@ void m_IDirectDrawSurfaceX::ReleaseD9Surface(bool BackupData)
 	// Release d3d9 3D surface
 	if (surface3D)
 	{
-		Logging::LogDebug() << __FUNCTION__ << " Releasing Direct3D9 surface";
+		LOG_DBG << __FUNCTION__ << " Releasing Direct3D9 surface";
 		ULONG ref = surface3D->Release();
 		if (ref)
 		{
@@ -3786,7 +3885,7 @@ void m_IDirectDrawSurfaceX::ReleaseD9Surface(bool BackupData)
 	// Release d3d9 context surface
 	if (contextSurface)
 	{
-		Logging::LogDebug() << __FUNCTION__ << " Releasing Direct3D9 context surface";
+		LOG_DBG << __FUNCTION__ << " Releasing Direct3D9 context surface";
 		ULONG ref = contextSurface->Release();
 		if (ref > 1)	// Ref count is higher becasue it is a surface of 'surfaceTexture'
 		{
@@ -3798,7 +3897,7 @@ void m_IDirectDrawSurfaceX::ReleaseD9Surface(bool BackupData)
 	// Release d3d9 surface texture
 	if (surfaceTexture)
 	{
-		Logging::LogDebug() << __FUNCTION__ << " Releasing Direct3D9 texture surface";
+		LOG_DBG << __FUNCTION__ << " Releasing Direct3D9 texture surface";
 		ULONG ref = surfaceTexture->Release();
 		if (ref)
 		{
@@ -3810,7 +3909,7 @@ void m_IDirectDrawSurfaceX::ReleaseD9Surface(bool BackupData)
 	// Release d3d9 palette surface texture
 	if (paletteTexture)
 	{
-		Logging::LogDebug() << __FUNCTION__ << " Releasing Direct3D9 palette texture surface";
+		LOG_DBG << __FUNCTION__ << " Releasing Direct3D9 palette texture surface";
 		if (d3d9Device && *d3d9Device)
 		{
 			(*d3d9Device)->SetTexture(1, nullptr);
@@ -3826,7 +3925,7 @@ void m_IDirectDrawSurfaceX::ReleaseD9Surface(bool BackupData)
 	// Release d3d9 pixel shader
 	if (pixelShader)
 	{
-		Logging::LogDebug() << __FUNCTION__ << " Releasing Direct3D9 pixel shader";
+		LOG_DBG << __FUNCTION__ << " Releasing Direct3D9 pixel shader";
 		if (d3d9Device && *d3d9Device)
 		{
 			(*d3d9Device)->SetPixelShader(nullptr);
@@ -3842,7 +3941,7 @@ void m_IDirectDrawSurfaceX::ReleaseD9Surface(bool BackupData)
 	// Release d3d9 vertex buffer
 	if (vertexBuffer)
 	{
-		Logging::LogDebug() << __FUNCTION__ << " Releasing Direct3D9 vertext buffer";
+		LOG_DBG << __FUNCTION__ << " Releasing Direct3D9 vertext buffer";
 		ULONG ref = vertexBuffer->Release();
 		if (ref)
 		{
@@ -3896,7 +3995,7 @@ HRESULT m_IDirectDrawSurfaceX::PresentSurface(bool isSkipScene)
 	}
 	else if ((isSkipScene && !SceneReady) || IsPresentRunning)
 	{
-		Logging::LogDebug() << __FUNCTION__ << " Skipping scene!";
+		LOG_DBG << __FUNCTION__ << " Skipping scene!";
 		return DDERR_GENERIC;
 	}
 
@@ -3906,7 +4005,7 @@ HRESULT m_IDirectDrawSurfaceX::PresentSurface(bool isSkipScene)
 	// Check if surface is locked or has an open DC
 	if (IsSurfaceLocked() || IsSurfaceInDC())
 	{
-		Logging::LogDebug() << __FUNCTION__ << " Surface is busy!";
+		LOG_DBG << __FUNCTION__ << " Surface is busy!";
 		return DDERR_SURFACEBUSY;
 	}
 
@@ -3915,7 +4014,7 @@ HRESULT m_IDirectDrawSurfaceX::PresentSurface(bool isSkipScene)
 
 	HRESULT hr = DD_OK;
 
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ") ";
+	LOG_DBG << __FUNCTION__ << " (" << this << ") ";
 	// Preset surface
 	do {
 		// Set texture
@@ -4562,7 +4661,7 @@ bool m_IDirectDrawSurfaceX::DoesFlipBackBufferExist(m_IDirectDrawSurfaceX* lpSur
 
 HRESULT m_IDirectDrawSurfaceX::ColorFill(RECT* pRect, D3DCOLOR dwFillColor)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	// Check for device interface
 	HRESULT c_hr = CheckInterface(__FUNCTION__, true, true);
@@ -5194,7 +5293,7 @@ HRESULT m_IDirectDrawSurfaceX::CopySurface(m_IDirectDrawSurfaceX* pSourceSurface
 	} while (false);
 
 	// Remove scanlines before unlocking surface
-	if (SUCCEEDED(hr) && Config.DdrawRemoveScanlines)
+	if (SUCCEEDED(hr) && LIVE_CONFIG(DdrawRemoveScanlines))
 	{
 		// Set last rect before removing scanlines
 		LASTLOCK LLock;
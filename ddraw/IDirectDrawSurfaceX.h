@@ -219,6 +219,7 @@ private:
 	inline DWORD GetWidth() { return surfaceDesc2.dwWidth; }
 	inline DWORD GetHeight() { return surfaceDesc2.dwHeight; }
 	inline DDSCAPS2 GetSurfaceCaps() { return surfaceDesc2.ddsCaps; }
+	inline const DDSURFACEDESC2 &GetCurrentSurfaceDesc() { return surfaceDesc2; }
 	inline D3DFORMAT GetSurfaceFormat() { return surfaceFormat; }
 	inline bool CheckSurfaceExists(LPDIRECTDRAWSURFACE7 lpDDSrcSurface) { return
 		(ProxyAddressLookupTable.IsValidWrapperAddress((m_IDirectDrawSurface*)lpDDSrcSurface) ||
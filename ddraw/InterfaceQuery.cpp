@@ -94,7 +94,7 @@ REFIID DdrawWrapper::ConvertREFIID(REFIID riid)
 
 HRESULT DdrawWrapper::ProxyQueryInterface(LPVOID ProxyInterface, REFIID riid, LPVOID * ppvObj, REFIID WrapperID)
 {
-	Logging::LogDebug() << __FUNCTION__ << " Query for " << riid << " from " << WrapperID;
+	LOG_DBG << __FUNCTION__ << " Query for " << riid << " from " << WrapperID;
 
 	if (!ppvObj)
 	{
@@ -27,6 +27,7 @@
 #include "Dllmain\Dllmain.h"
 #include "IClassFactory\IClassFactory.h"
 #include "d3d9\d3d9External.h"
+#include "Capture.h"
 
 AddressLookupTableDdraw<void> ProxyAddressLookupTable = AddressLookupTableDdraw<void>();
 
@@ -60,6 +61,7 @@ void InitDDraw()
 	{
 		InitializeCriticalSection(&ddcs);
 		IsInitialized = true;
+		DdrawCapture::Start(Config.DdrawCaptureFrames);
 	}
 }
 
@@ -68,6 +70,7 @@ void ExitDDraw()
 	if (IsInitialized)
 	{
 		IsInitialized = false;
+		DdrawCapture::Stop();
 		DeleteCriticalSection(&ddcs);
 	}
 }
@@ -18,7 +18,7 @@
 
 HRESULT m_IDirectSound3DBuffer8::QueryInterface(REFIID riid, LPVOID * ppvObj)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	if (!ppvObj)
 	{
@@ -46,14 +46,14 @@ HRESULT m_IDirectSound3DBuffer8::QueryInterface(REFIID riid, LPVOID * ppvObj)
 
 ULONG m_IDirectSound3DBuffer8::AddRef()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->AddRef();
 }
 
 ULONG m_IDirectSound3DBuffer8::Release()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	ULONG x = ProxyInterface->Release();
 
@@ -68,126 +68,126 @@ ULONG m_IDirectSound3DBuffer8::Release()
 // IDirectSound3DBuffer methods
 HRESULT m_IDirectSound3DBuffer8::GetAllParameters(_Out_ LPDS3DBUFFER pDs3dBuffer)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->GetAllParameters(pDs3dBuffer);
 }
 
 HRESULT m_IDirectSound3DBuffer8::GetConeAngles(_Out_ LPDWORD pdwInsideConeAngle, _Out_ LPDWORD pdwOutsideConeAngle)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->GetConeAngles(pdwInsideConeAngle, pdwOutsideConeAngle);
 }
 
 HRESULT m_IDirectSound3DBuffer8::GetConeOrientation(_Out_ D3DVECTOR* pvOrientation)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->GetConeOrientation(pvOrientation);
 }
 
 HRESULT m_IDirectSound3DBuffer8::GetConeOutsideVolume(_Out_ LPLONG plConeOutsideVolume)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->GetConeOutsideVolume(plConeOutsideVolume);
 }
 
 HRESULT m_IDirectSound3DBuffer8::GetMaxDistance(_Out_ D3DVALUE* pflMaxDistance)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->GetMaxDistance(pflMaxDistance);
 }
 
 HRESULT m_IDirectSound3DBuffer8::GetMinDistance(_Out_ D3DVALUE* pflMinDistance)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->GetMinDistance(pflMinDistance);
 }
 
 HRESULT m_IDirectSound3DBuffer8::GetMode(_Out_ LPDWORD pdwMode)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->GetMode(pdwMode);
 }
 
 HRESULT m_IDirectSound3DBuffer8::GetPosition(_Out_ D3DVECTOR* pvPosition)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->GetPosition(pvPosition);
 }
 
 HRESULT m_IDirectSound3DBuffer8::GetVelocity(_Out_ D3DVECTOR* pvVelocity)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->GetVelocity(pvVelocity);
 }
 
 HRESULT m_IDirectSound3DBuffer8::SetAllParameters(_In_ LPCDS3DBUFFER pcDs3dBuffer, DWORD dwApply)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->SetAllParameters(pcDs3dBuffer, dwApply);
 }
 
 HRESULT m_IDirectSound3DBuffer8::SetConeAngles(DWORD dwInsideConeAngle, DWORD dwOutsideConeAngle, DWORD dwApply)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->SetConeAngles(dwInsideConeAngle, dwOutsideConeAngle, dwApply);
 }
 
 HRESULT m_IDirectSound3DBuffer8::SetConeOrientation(D3DVALUE x, D3DVALUE y, D3DVALUE z, DWORD dwApply)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->SetConeOrientation(x, y, z, dwApply);
 }
 
 HRESULT m_IDirectSound3DBuffer8::SetConeOutsideVolume(LONG lConeOutsideVolume, DWORD dwApply)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->SetConeOutsideVolume(lConeOutsideVolume, dwApply);
 }
 
 HRESULT m_IDirectSound3DBuffer8::SetMaxDistance(D3DVALUE flMaxDistance, DWORD dwApply)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->SetMaxDistance(flMaxDistance, dwApply);
 }
 
 HRESULT m_IDirectSound3DBuffer8::SetMinDistance(D3DVALUE flMinDistance, DWORD dwApply)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->SetMinDistance(flMinDistance, dwApply);
 }
 
 HRESULT m_IDirectSound3DBuffer8::SetMode(DWORD dwMode, DWORD dwApply)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->SetMode(dwMode, dwApply);
 }
 
 HRESULT m_IDirectSound3DBuffer8::SetPosition(D3DVALUE x, D3DVALUE y, D3DVALUE z, DWORD dwApply)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->SetPosition(x, y, z, dwApply);
 }
 
 HRESULT m_IDirectSound3DBuffer8::SetVelocity(D3DVALUE x, D3DVALUE y, D3DVALUE z, DWORD dwApply)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->SetVelocity(x, y, z, dwApply);
 }
@@ -18,7 +18,7 @@
 
 HRESULT m_IDirectSound8::QueryInterface(REFIID riid, LPVOID * ppvObj)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	if (!ppvObj)
 	{
@@ -46,14 +46,14 @@ HRESULT m_IDirectSound8::QueryInterface(REFIID riid, LPVOID * ppvObj)
 
 ULONG m_IDirectSound8::AddRef()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->AddRef();
 }
 
 ULONG m_IDirectSound8::Release()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	ULONG x = ProxyInterface->Release();
 
@@ -68,7 +68,7 @@ ULONG m_IDirectSound8::Release()
 // IDirectSound methods
 HRESULT m_IDirectSound8::CreateSoundBuffer(_In_ LPCDSBUFFERDESC pcDSBufferDesc, _Out_ LPDIRECTSOUNDBUFFER* ppDSBuffer, _Pre_null_ LPUNKNOWN pUnkOuter)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	if (pcDSBufferDesc && pcDSBufferDesc->dwSize)
 	{
@@ -131,7 +131,7 @@ HRESULT m_IDirectSound8::CreateSoundBuffer(_In_ LPCDSBUFFERDESC pcDSBufferDesc,
 
 HRESULT m_IDirectSound8::GetCaps(_Out_ LPDSCAPS pDSCaps)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	HRESULT hr = ProxyInterface->GetCaps(pDSCaps);
 
@@ -180,7 +180,7 @@ HRESULT m_IDirectSound8::GetCaps(_Out_ LPDSCAPS pDSCaps)
 
 HRESULT m_IDirectSound8::DuplicateSoundBuffer(_In_ LPDIRECTSOUNDBUFFER pDSBufferOriginal, _Out_ LPDIRECTSOUNDBUFFER* ppDSBufferDuplicate)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	if (pDSBufferOriginal)
 	{
@@ -199,7 +199,7 @@ HRESULT m_IDirectSound8::DuplicateSoundBuffer(_In_ LPDIRECTSOUNDBUFFER pDSBuffer
 
 HRESULT m_IDirectSound8::SetCooperativeLevel(HWND hwnd, DWORD dwLevel)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	if (Config.ForceExclusiveMode && dwLevel == DSSCL_NORMAL)
 	{
@@ -211,14 +211,14 @@ HRESULT m_IDirectSound8::SetCooperativeLevel(HWND hwnd, DWORD dwLevel)
 
 HRESULT m_IDirectSound8::Compact()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->Compact();
 }
 
 HRESULT m_IDirectSound8::GetSpeakerConfig(_Out_ LPDWORD pdwSpeakerConfig)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	HRESULT hr = ProxyInterface->GetSpeakerConfig(pdwSpeakerConfig);
 
@@ -233,14 +233,14 @@ HRESULT m_IDirectSound8::GetSpeakerConfig(_Out_ LPDWORD pdwSpeakerConfig)
 
 HRESULT m_IDirectSound8::SetSpeakerConfig(DWORD dwSpeakerConfig)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->SetSpeakerConfig(dwSpeakerConfig);
 }
 
 HRESULT m_IDirectSound8::Initialize(_In_opt_ LPCGUID pcGuidDevice)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->Initialize(pcGuidDevice);
 }
@@ -248,7 +248,7 @@ HRESULT m_IDirectSound8::Initialize(_In_opt_ LPCGUID pcGuidDevice)
 // IDirectSound8 methods
 HRESULT  m_IDirectSound8::VerifyCertification(_Out_ LPDWORD pdwCertified)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	HRESULT hr = ProxyInterface->VerifyCertification(pdwCertified);
 
@@ -15,12 +15,16 @@
 */
 
 #include "dsound.h"
+#include "Logging\CallStats.h"
+#include "Logging\ChromeTrace.h"
+#include "Settings\LiveConfig.h"
 
 DWORD WINAPI ResetPending(LPVOID pvParam);
 
 HRESULT m_IDirectSoundBuffer8::QueryInterface(REFIID riid, LPVOID * ppvObj)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (!ppvObj)
 	{
@@ -48,14 +52,16 @@ HRESULT m_IDirectSoundBuffer8::QueryInterface(REFIID riid, LPVOID * ppvObj)
 
 ULONG m_IDirectSoundBuffer8::AddRef()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->AddRef();
 }
 
 ULONG m_IDirectSoundBuffer8::Release()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (CheckThreadRunning())
 	{
@@ -74,14 +80,17 @@ ULONG m_IDirectSoundBuffer8::Release()
 
 HRESULT m_IDirectSoundBuffer8::GetCaps(_Out_ LPDSBCAPS pDSBufferCaps)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetCaps(pDSBufferCaps);
 }
 
 HRESULT m_IDirectSoundBuffer8::GetCurrentPosition(_Out_opt_ LPDWORD pdwCurrentPlayCursor, _Out_opt_ LPDWORD pdwCurrentWriteCursor)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
+	LOG_CHROMETRACE();
 
 	HRESULT hr = ProxyInterface->GetCurrentPosition(pdwCurrentPlayCursor, pdwCurrentWriteCursor);
 
@@ -115,14 +124,16 @@ HRESULT m_IDirectSoundBuffer8::GetCurrentPosition(_Out_opt_ LPDWORD pdwCurrentPl
 
 HRESULT m_IDirectSoundBuffer8::GetFormat(_Out_writes_bytes_opt_(dwSizeAllocated) LPWAVEFORMATEX pwfxFormat, DWORD dwSizeAllocated, _Out_opt_ LPDWORD pdwSizeWritten)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetFormat(pwfxFormat, dwSizeAllocated, pdwSizeWritten);
 }
 
 HRESULT m_IDirectSoundBuffer8::GetVolume(_Out_ LPLONG plVolume)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.AudioClipDetection)
 	{
@@ -150,28 +161,32 @@ HRESULT m_IDirectSoundBuffer8::GetVolume(_Out_ LPLONG plVolume)
 
 HRESULT m_IDirectSoundBuffer8::GetPan(_Out_ LPLONG plPan)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetPan(plPan);
 }
 
 HRESULT m_IDirectSoundBuffer8::GetFrequency(_Out_ LPDWORD pdwFrequency)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetFrequency(pdwFrequency);
 }
 
 HRESULT m_IDirectSoundBuffer8::GetStatus(_Out_ LPDWORD pdwStatus)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->GetStatus(pdwStatus);
 }
 
 HRESULT m_IDirectSoundBuffer8::Initialize(_In_ LPDIRECTSOUND pDirectSound, _In_ LPCDSBUFFERDESC pcDSBufferDesc)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (pDirectSound)
 	{
@@ -185,14 +200,18 @@ HRESULT m_IDirectSoundBuffer8::Lock(DWORD dwOffset, DWORD dwBytes,
 	_Outptr_result_bytebuffer_(*pdwAudioBytes1) LPVOID* ppvAudioPtr1, _Out_ LPDWORD pdwAudioBytes1,
 	_Outptr_opt_result_bytebuffer_(*pdwAudioBytes2) LPVOID* ppvAudioPtr2, _Out_opt_ LPDWORD pdwAudioBytes2, DWORD dwFlags)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
+	LOG_CHROMETRACE();
 
 	return ProxyInterface->Lock(dwOffset, dwBytes, ppvAudioPtr1, pdwAudioBytes1, ppvAudioPtr2, pdwAudioBytes2, dwFlags);
 }
 
 HRESULT m_IDirectSoundBuffer8::Play(DWORD dwReserved1, DWORD dwPriority, DWORD dwFlags)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
+	LOG_CHROMETRACE();
 
 	if (CheckThreadRunning())
 	{
@@ -211,14 +230,17 @@ HRESULT m_IDirectSoundBuffer8::Play(DWORD dwReserved1, DWORD dwPriority, DWORD d
 
 HRESULT m_IDirectSoundBuffer8::SetCurrentPosition(DWORD dwNewPosition)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
+	LOG_CHROMETRACE();
 
 	return ProxyInterface->SetCurrentPosition(dwNewPosition);
 }
 
 HRESULT m_IDirectSoundBuffer8::SetFormat(_In_ LPCWAVEFORMATEX pcfxFormat)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	if (Config.ForcePrimaryBufferFormat && this->GetPrimaryBuffer())
 	{
@@ -243,7 +265,9 @@ HRESULT m_IDirectSoundBuffer8::SetFormat(_In_ LPCWAVEFORMATEX pcfxFormat)
 
 HRESULT m_IDirectSoundBuffer8::SetVolume(LONG lVolume)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
+	LOG_CHROMETRACE();
 
 	if (Config.AudioClipDetection)
 	{
@@ -271,21 +295,27 @@ HRESULT m_IDirectSoundBuffer8::SetVolume(LONG lVolume)
 
 HRESULT m_IDirectSoundBuffer8::SetPan(LONG lPan)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
+	LOG_CHROMETRACE();
 
 	return ProxyInterface->SetPan(lPan);
 }
 
 HRESULT m_IDirectSoundBuffer8::SetFrequency(DWORD dwFrequency)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
+	LOG_CHROMETRACE();
 
 	return ProxyInterface->SetFrequency(dwFrequency);
 }
 
 HRESULT m_IDirectSoundBuffer8::Stop()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
+	LOG_CHROMETRACE();
 
 	if (Config.AudioClipDetection)
 	{
@@ -330,34 +360,41 @@ HRESULT m_IDirectSoundBuffer8::Stop()
 HRESULT m_IDirectSoundBuffer8::Unlock(_In_reads_bytes_(dwAudioBytes1) LPVOID pvAudioPtr1, DWORD dwAudioBytes1,
 	_In_reads_bytes_opt_(dwAudioBytes2) LPVOID pvAudioPtr2, DWORD dwAudioBytes2)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
+	LOG_CHROMETRACE();
 
 	return ProxyInterface->Unlock(pvAudioPtr1, dwAudioBytes1, pvAudioPtr2, dwAudioBytes2);
 }
 
 HRESULT m_IDirectSoundBuffer8::Restore()
 {
+	LOG_CALLSTATS();
+
 	return ProxyInterface->Restore();
 }
 
 // IDirectSoundBuffer8 methods
 HRESULT m_IDirectSoundBuffer8::SetFX(DWORD dwEffectsCount, _In_reads_opt_(dwEffectsCount) LPDSEFFECTDESC pDSFXDesc, _Out_writes_opt_(dwEffectsCount) LPDWORD pdwResultCodes)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->SetFX(dwEffectsCount, pDSFXDesc, pdwResultCodes);
 }
 
 HRESULT m_IDirectSoundBuffer8::AcquireResources(DWORD dwFlags, DWORD dwEffectsCount, _Out_writes_(dwEffectsCount) LPDWORD pdwResultCodes)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	return ProxyInterface->AcquireResources(dwFlags, dwEffectsCount, pdwResultCodes);
 }
 
 HRESULT m_IDirectSoundBuffer8::GetObjectInPath(_In_ REFGUID rguidObject, DWORD dwIndex, _In_ REFGUID rguidInterface, _Outptr_ LPVOID* ppObject)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
+	LOG_CALLSTATS();
 
 	HRESULT hr = ProxyInterface->GetObjectInPath(rguidObject, dwIndex, rguidInterface, ppObject);
 
@@ -416,7 +453,8 @@ DWORD WINAPI ResetPending(LPVOID pvParam)
 	AUDIOCLIP &AudioClip = *(AUDIOCLIP*)pvParam;
 
 	// Add slight delay
-	WaitForSingleObject(AudioClip.hTriggerEvent, ((Config.AudioFadeOutDelayMS) ? Config.AudioFadeOutDelayMS : 20));
+	const DWORD FadeOutDelay = LIVE_CONFIG(AudioFadeOutDelayMS);
+	WaitForSingleObject(AudioClip.hTriggerEvent, ((FadeOutDelay) ? FadeOutDelay : 20));
 
 	EnterCriticalSection(&AudioClip.dics);
 
@@ -18,7 +18,7 @@
 
 HRESULT m_IDirectSoundCapture8::QueryInterface(REFIID riid, LPVOID * ppvObj)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	if (!ppvObj)
 	{
@@ -46,14 +46,14 @@ HRESULT m_IDirectSoundCapture8::QueryInterface(REFIID riid, LPVOID * ppvObj)
 
 ULONG m_IDirectSoundCapture8::AddRef()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->AddRef();
 }
 
 ULONG m_IDirectSoundCapture8::Release()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	ULONG x = ProxyInterface->Release();
 
@@ -68,7 +68,7 @@ ULONG m_IDirectSoundCapture8::Release()
 // IDirectSoundCapture methods
 HRESULT m_IDirectSoundCapture8::CreateCaptureBuffer(_In_ LPCDSCBUFFERDESC pcDSCBufferDesc, _Outptr_ LPDIRECTSOUNDCAPTUREBUFFER* ppDSCBuffer, _Pre_null_ LPUNKNOWN pUnkOuter)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	HRESULT hr = ProxyInterface->CreateCaptureBuffer(pcDSCBufferDesc, ppDSCBuffer, pUnkOuter);
 
@@ -82,14 +82,14 @@ HRESULT m_IDirectSoundCapture8::CreateCaptureBuffer(_In_ LPCDSCBUFFERDESC pcDSCB
 
 HRESULT m_IDirectSoundCapture8::GetCaps(_Out_ LPDSCCAPS pDSCCaps)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->GetCaps(pDSCCaps);
 }
 
 HRESULT m_IDirectSoundCapture8::Initialize(_In_opt_ LPCGUID pcGuidDevice)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->Initialize(pcGuidDevice);
 }
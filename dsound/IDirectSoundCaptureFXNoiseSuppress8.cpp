@@ -18,7 +18,7 @@
 
 HRESULT m_IDirectSoundCaptureFXNoiseSuppress8::QueryInterface(REFIID riid, LPVOID * ppvObj)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	if (!ppvObj)
 	{
@@ -46,14 +46,14 @@ HRESULT m_IDirectSoundCaptureFXNoiseSuppress8::QueryInterface(REFIID riid, LPVOI
 
 ULONG m_IDirectSoundCaptureFXNoiseSuppress8::AddRef()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->AddRef();
 }
 
 ULONG m_IDirectSoundCaptureFXNoiseSuppress8::Release()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	ULONG x = ProxyInterface->Release();
 
@@ -68,21 +68,21 @@ ULONG m_IDirectSoundCaptureFXNoiseSuppress8::Release()
 // IDirectSoundCaptureFXNoiseSuppress methods
 HRESULT m_IDirectSoundCaptureFXNoiseSuppress8::SetAllParameters(_In_ LPCDSCFXNoiseSuppress pcDscFxNoiseSuppress)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->SetAllParameters(pcDscFxNoiseSuppress);
 }
 
 HRESULT m_IDirectSoundCaptureFXNoiseSuppress8::GetAllParameters(_Out_ LPDSCFXNoiseSuppress pDscFxNoiseSuppress)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->GetAllParameters(pDscFxNoiseSuppress);
 }
 
 HRESULT m_IDirectSoundCaptureFXNoiseSuppress8::Reset()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->Reset();
 }
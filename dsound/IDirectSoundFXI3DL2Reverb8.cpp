@@ -18,7 +18,7 @@
 
 HRESULT m_IDirectSoundFXI3DL2Reverb8::QueryInterface(REFIID riid, LPVOID * ppvObj)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	if (!ppvObj)
 	{
@@ -46,14 +46,14 @@ HRESULT m_IDirectSoundFXI3DL2Reverb8::QueryInterface(REFIID riid, LPVOID * ppvOb
 
 ULONG m_IDirectSoundFXI3DL2Reverb8::AddRef()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->AddRef();
 }
 
 ULONG m_IDirectSoundFXI3DL2Reverb8::Release()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	ULONG x = ProxyInterface->Release();
 
@@ -68,42 +68,42 @@ ULONG m_IDirectSoundFXI3DL2Reverb8::Release()
 // IDirectSoundFXI3DL2Reverb methods
 HRESULT m_IDirectSoundFXI3DL2Reverb8::SetAllParameters(_In_ LPCDSFXI3DL2Reverb pcDsFxI3DL2Reverb)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->SetAllParameters(pcDsFxI3DL2Reverb);
 }
 
 HRESULT m_IDirectSoundFXI3DL2Reverb8::GetAllParameters(_Out_ LPDSFXI3DL2Reverb pDsFxI3DL2Reverb)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->GetAllParameters(pDsFxI3DL2Reverb);
 }
 
 HRESULT m_IDirectSoundFXI3DL2Reverb8::SetPreset(DWORD dwPreset)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->SetPreset(dwPreset);
 }
 
 HRESULT m_IDirectSoundFXI3DL2Reverb8::GetPreset(_Out_ LPDWORD pdwPreset)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->GetPreset(pdwPreset);
 }
 
 HRESULT m_IDirectSoundFXI3DL2Reverb8::SetQuality(LONG lQuality)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->SetQuality(lQuality);
 }
 
 HRESULT m_IDirectSoundFXI3DL2Reverb8::GetQuality(_Out_ LONG *plQuality)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->GetQuality(plQuality);
 }
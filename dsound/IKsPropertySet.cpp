@@ -18,7 +18,7 @@
 
 HRESULT m_IKsPropertySet::QueryInterface(REFIID riid, LPVOID * ppvObj)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	if (!ppvObj)
 	{
@@ -46,14 +46,14 @@ HRESULT m_IKsPropertySet::QueryInterface(REFIID riid, LPVOID * ppvObj)
 
 ULONG m_IKsPropertySet::AddRef()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->AddRef();
 }
 
 ULONG m_IKsPropertySet::Release()
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	ULONG x = ProxyInterface->Release();
 
@@ -69,7 +69,7 @@ ULONG m_IKsPropertySet::Release()
 HRESULT m_IKsPropertySet::Get(_In_ REFGUID rguidPropSet, ULONG ulId, _In_reads_bytes_opt_(ulInstanceLength) LPVOID pInstanceData, ULONG ulInstanceLength,
 	_Out_writes_bytes_(ulDataLength) LPVOID pPropertyData, ULONG ulDataLength, _Out_opt_ PULONG pulBytesReturned)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->Get(rguidPropSet, ulId, pInstanceData, ulInstanceLength, pPropertyData, ulDataLength, pulBytesReturned);
 }
@@ -77,14 +77,14 @@ HRESULT m_IKsPropertySet::Get(_In_ REFGUID rguidPropSet, ULONG ulId, _In_reads_b
 HRESULT m_IKsPropertySet::Set(_In_ REFGUID rguidPropSet, ULONG ulId, _In_reads_bytes_opt_(ulInstanceLength)  LPVOID pInstanceData, ULONG ulInstanceLength,
 	_In_reads_bytes_(ulDataLength) LPVOID pPropertyData, ULONG ulDataLength)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->Set(rguidPropSet, ulId, pInstanceData, ulInstanceLength, pPropertyData, ulDataLength);
 }
 
 HRESULT m_IKsPropertySet::QuerySupport(_In_ REFGUID rguidPropSet, ULONG ulId, _Out_ PULONG pulTypeSupport)
 {
-	Logging::LogDebug() << __FUNCTION__ << " (" << this << ")";
+	LOG_DBG << __FUNCTION__ << " (" << this << ")";
 
 	return ProxyInterface->QuerySupport(rguidPropSet, ulId, pulTypeSupport);
 }